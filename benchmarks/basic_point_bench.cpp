@@ -0,0 +1,81 @@
+// benchmarks/basic_point_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/geometry.h>
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Трек bench::make_xy_track в точках нужного типа; z — рельеф поля
+template <class P>
+std::vector<P> make_track(std::size_t n)
+{
+    using T = typename P::value_type;
+    const auto xy = bench::make_xy_track(n);
+    std::vector<P> pts(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        if constexpr (P::dimension == 2) {
+            pts[i] = P{static_cast<T>(xy[i].x), static_cast<T>(xy[i].y)};
+        } else {
+            pts[i] = P{static_cast<T>(xy[i].x), static_cast<T>(xy[i].y), static_cast<T>(1e-3 * xy[i].x)};
+        }
+    }
+    return pts;
+}
+
+// Накопленные длины в буфер вызывающего; bytes — прочитанные точки и записанные длины
+template <class P>
+void BM_BasicPolylineLengths(benchmark::State& state)
+{
+    using T = typename P::value_type;
+    const auto pts = make_track<P>(static_cast<std::size_t>(state.range(0)));
+    std::vector<T> s(pts.size());
+    for (auto _: state) {
+        polyline_lengths(span<const P>(pts), span<T>(s));
+        benchmark::DoNotOptimize(s.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0)
+                            * static_cast<int64_t>(sizeof(P) + sizeof(T)));
+}
+
+// Площадь контура поля: ring_signed_area на double против BasicPolygon<float> (без кэша, считает каждый раз)
+void BM_BasicPolygon_Area_Double(benchmark::State& state)
+{
+    const auto ring = bench::make_field_ring(static_cast<std::size_t>(state.range(0)));
+    for (auto _: state) {
+        benchmark::DoNotOptimize(ring_signed_area(ring));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_BasicPolygon_Area_Float(benchmark::State& state)
+{
+    // Локальные координаты: float рассчитан на метры от центра поля, а не на абсолютный UTM
+    auto ring = bench::make_field_ring(static_cast<std::size_t>(state.range(0)));
+    std::vector<Point2f> local(ring.size());
+    for (std::size_t i = 0; i < ring.size(); ++i) {
+        local[i] = {static_cast<float>(ring[i].x - 412345.0), static_cast<float>(ring[i].y - 6178901.0)};
+    }
+    const Polygon2f poly(std::move(local));
+    for (auto _: state) {
+        benchmark::DoNotOptimize(poly.area());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_BasicPolylineLengths, Point2f)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK_TEMPLATE(BM_BasicPolylineLengths, Point2d)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK_TEMPLATE(BM_BasicPolylineLengths, Point3f)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK_TEMPLATE(BM_BasicPolylineLengths, Point3d)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_BasicPolygon_Area_Double)->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(BM_BasicPolygon_Area_Float)->RangeMultiplier(10)->Range(10, 1000000);
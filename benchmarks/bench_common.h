@@ -0,0 +1,58 @@
+// benchmarks/bench_common.h
+#pragma once
+
+#include <mylib/geometry.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace bench {
+
+// Центр синтетических данных: поле под Москвой
+inline const mylib::GeoPoint kCenter{55.751244, 37.618423, std::nullopt};
+
+// Синтетический GNSS-трек: челнок по полю ~1x1 км с шумом приёмника, шаг ~1 м
+inline std::vector<mylib::GeoPoint> make_geo_track(std::size_t n, unsigned seed = 42)
+{
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> noise(0.0, 1e-6);
+
+    constexpr double kStepDeg = 1e-5;
+    constexpr std::size_t kPointsPerPass = 1000;
+
+    std::vector<mylib::GeoPoint> track;
+    track.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t pass = i / kPointsPerPass;
+        const std::size_t k = i % kPointsPerPass;
+        const double along = static_cast<double>(pass % 2 == 0 ? k : kPointsPerPass - 1 - k) * kStepDeg;
+        const double across = static_cast<double>(pass % 1000) * 3.0 * kStepDeg;
+        track.push_back({kCenter.lat + across + noise(rng), kCenter.lon + along + noise(rng), std::nullopt});
+    }
+    return track;
+}
+
+// Тот же трек в метрических координатах
+inline std::vector<mylib::Point> make_xy_track(std::size_t n, unsigned seed = 42)
+{
+    const auto geo = make_geo_track(n, seed);
+    std::vector<mylib::Point> xy(n);
+    mylib::GeoToXYEquirectangular{}.geo_to_xy_batch(kCenter, geo, xy);
+    return xy;
+}
+
+// Контур поля ~1x1 км в координатах UTM (большие абсолютные значения): n вершин по искажённой окружности
+inline std::vector<mylib::Point> make_field_ring(std::size_t n)
+{
+    std::vector<mylib::Point> ring(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double a = 2.0 * mylib::kPI * static_cast<double>(i) / static_cast<double>(n);
+        const double r = 500.0 + 37.0 * std::sin(7.0 * a);
+        ring[i] = {412345.0 + r * std::cos(a), 6178901.0 + r * std::sin(a)};
+    }
+    return ring;
+}
+
+} // namespace bench
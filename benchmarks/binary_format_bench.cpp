@@ -0,0 +1,130 @@
+// benchmarks/binary_format_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/binary_format.h>
+#include <mylib/track_stream.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+constexpr std::size_t kPoints = 1000000;
+
+// Файлы с одним и тем же треком на 1M точек в CSV и бинарном виде; создаются один раз на процесс.
+// Замеры — при прогретом кэше страниц ОС, т. е. без учёта чтения с диска.
+struct TrackFiles {
+    std::string csv;
+    std::string bin;
+
+    TrackFiles()
+    {
+        const auto dir = std::filesystem::temp_directory_path();
+        csv = (dir / "mylib_bench_track.csv").string();
+        bin = (dir / "mylib_bench_track.bin").string();
+
+        auto track = bench::make_geo_track(kPoints);
+        for (std::size_t i = 0; i < track.size(); i += 2) {
+            track[i].alt = 150.0 + static_cast<double>(i % 100) * 0.1;
+        }
+        std::ofstream out(csv);
+        out.precision(17);
+        for (const GeoPoint& p: track) {
+            out << p.lat << ',' << p.lon;
+            if (p.alt) out << ',' << *p.alt;
+            out << '\n';
+        }
+        write_geo_points_file(bin, track);
+    }
+
+    ~TrackFiles()
+    {
+        std::remove(csv.c_str());
+        std::remove(bin.c_str());
+    }
+};
+
+const TrackFiles& files()
+{
+    static const TrackFiles f;
+    return f;
+}
+
+// Типичный самописный разбор через iostream
+void BM_LoadTrack_Iostream(benchmark::State& state)
+{
+    const auto& f = files();
+    for (auto _: state) {
+        std::ifstream in(f.csv);
+        std::vector<GeoPoint> pts;
+        std::string line;
+        while (std::getline(in, line)) {
+            std::istringstream ls(line);
+            GeoPoint p;
+            char comma = 0;
+            double alt = 0.0;
+            ls >> p.lat >> comma >> p.lon;
+            if (ls >> comma >> alt) p.alt = alt;
+            pts.push_back(p);
+        }
+        benchmark::DoNotOptimize(pts.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kPoints));
+}
+
+void BM_LoadTrack_CsvSource(benchmark::State& state)
+{
+    const auto& f = files();
+    for (auto _: state) {
+        std::ifstream in(f.csv, std::ios::binary);
+        CsvGeoPointSource source(in);
+        std::vector<GeoPoint> pts(kPoints);
+        std::size_t n = 0;
+        while (const std::size_t got = source.read(span<GeoPoint>(pts).subspan(n))) {
+            n += got;
+        }
+        benchmark::DoNotOptimize(pts.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kPoints));
+}
+
+// Открытие отображения и один проход по столбцам: данные готовы к SoA-ядрам
+void BM_LoadTrack_Mapped(benchmark::State& state)
+{
+    const auto& f = files();
+    for (auto _: state) {
+        const GeoPointsFile file(f.bin);
+        double sum = 0.0;
+        for (std::size_t i = 0; i < file.size(); ++i) {
+            sum += file.lat()[i] + file.lon()[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kPoints));
+}
+
+// То же с полной сборкой std::vector<GeoPoint>
+void BM_LoadTrack_MappedToVector(benchmark::State& state)
+{
+    const auto& f = files();
+    for (auto _: state) {
+        const GeoPointsFile file(f.bin);
+        benchmark::DoNotOptimize(file.to_vector().data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kPoints));
+}
+
+} // namespace
+
+BENCHMARK(BM_LoadTrack_Iostream)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadTrack_CsvSource)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadTrack_Mapped)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadTrack_MappedToVector)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,75 @@
+// benchmarks/coverage_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/coverage.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+constexpr double kWidth = 24.0;
+
+// Телеметрия 20 Гц на 3 м/с (шаг 0.15 м): челнок через поле bench::make_field_ring с шагом в ширину захвата.
+// 44 гона по 1040 м — около 305 тыс. точек, четыре с лишним часа работы.
+std::vector<Point> make_telemetry()
+{
+    std::mt19937 rng(7);
+    std::normal_distribution<double> noise(0.0, 0.02);
+    constexpr double kStep = 0.15;
+    constexpr double kHalf = 520.0;
+    const Point c{412345.0, 6178901.0};
+
+    std::vector<Point> track;
+    bool forward = true;
+    for (double y = -kHalf + 0.5 * kWidth; y < kHalf; y += kWidth, forward = !forward) {
+        for (double s = 0.0; s <= 2.0 * kHalf; s += kStep) {
+            const double x = forward ? -kHalf + s : kHalf - s;
+            track.push_back({c.x + x + noise(rng), c.y + y + noise(rng)});
+        }
+    }
+    return track;
+}
+
+// Стоимость одного обновления после state.range(0) уже принятых точек: не должна расти с историей
+void BM_CoverageUpdate(benchmark::State& state)
+{
+    static const std::vector<Point> track = make_telemetry();
+    const Polygon field(bench::make_field_ring(1000));
+    CoverageAccumulator acc(field, 0.25);
+
+    const auto history = static_cast<std::size_t>(state.range(0));
+    acc.add(span<const Point>(track.data(), history), kWidth);
+    std::size_t i = history;
+    for (auto _: state) {
+        acc.add(track[i], kWidth);
+        if (++i == track.size()) i = history;
+    }
+    benchmark::DoNotOptimize(acc.covered_area());
+    state.counters["coverage"] = acc.coverage_ratio();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Наивный вариант: пересчёт покрытия по всему накопленному треку при каждом запросе
+void BM_CoverageRecompute(benchmark::State& state)
+{
+    static const std::vector<Point> track = make_telemetry();
+    const Polygon field(bench::make_field_ring(1000));
+    const auto history = static_cast<std::size_t>(state.range(0));
+    for (auto _: state) {
+        CoverageAccumulator acc(field, 0.25);
+        acc.add(span<const Point>(track.data(), history), kWidth);
+        benchmark::DoNotOptimize(acc.covered_area());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+} // namespace
+
+// История: 0, 1 ч и 4 ч телеметрии 20 Гц
+BENCHMARK(BM_CoverageUpdate)->Arg(0)->Arg(72000)->Arg(288000);
+BENCHMARK(BM_CoverageRecompute)->Arg(72000)->Arg(288000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,92 @@
+// benchmarks/geo_reader_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/geo_reader.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+std::string make_csv(std::size_t n)
+{
+    std::ostringstream out;
+    out.precision(12);
+    std::size_t i = 0;
+    for (const GeoPoint& p: bench::make_geo_track(n)) {
+        out << p.lat << ',' << p.lon;
+        if (i++ % 2 == 0) out << ',' << 150.25;
+        out << '\n';
+    }
+    return out.str();
+}
+
+// FeatureCollection из n полей по k вершин со свойствами, как в выгрузках ГИС
+std::string make_geojson(std::size_t n, std::size_t k)
+{
+    std::ostringstream out;
+    out.precision(12);
+    out << R"({"type": "FeatureCollection", "features": [)";
+    for (std::size_t i = 0; i < n; ++i) {
+        const double lat0 = bench::kCenter.lat + static_cast<double>(i / 100) * 0.01;
+        const double lon0 = bench::kCenter.lon + static_cast<double>(i % 100) * 0.01;
+        out << (i ? ",\n" : "\n") << R"({"type": "Feature", "properties": {"id": )" << i
+            << R"(, "crop": "пшеница"}, "geometry": {"type": "Polygon", "coordinates": [[)";
+        for (std::size_t j = 0; j <= k; ++j) {
+            const double a = 2.0 * kPI * static_cast<double>(j % k) / static_cast<double>(k);
+            out << (j ? ", [" : "[") << lon0 + 0.004 * std::cos(a) << ", " << lat0 + 0.004 * std::sin(a) << "]";
+        }
+        out << "]]}}";
+    }
+    out << "\n]}";
+    return out.str();
+}
+
+void BM_ReadCsv(benchmark::State& state)
+{
+    const std::string text = make_csv(static_cast<std::size_t>(state.range(0)));
+    std::vector<GeoPoint> pts;
+    for (auto _: state) {
+        read_csv(text, pts);
+        benchmark::DoNotOptimize(pts.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_ReadGeoJson(benchmark::State& state)
+{
+    const std::string text = make_geojson(static_cast<std::size_t>(state.range(0)), 100);
+    GeoJsonGeometries g;
+    for (auto _: state) {
+        read_geojson(text, g);
+        benchmark::DoNotOptimize(g.points.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Порционный режим: память под геометрии ограничена batch_points
+void BM_ReadGeoJson_Batched(benchmark::State& state)
+{
+    const std::string text = make_geojson(static_cast<std::size_t>(state.range(0)), 100);
+    for (auto _: state) {
+        std::size_t polygons = 0;
+        read_geojson(text, [&](const GeoJsonGeometries& g) { polygons += g.polygon_count(); }, 1 << 16);
+        benchmark::DoNotOptimize(polygons);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_ReadCsv)->Arg(1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadGeoJson)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadGeoJson_Batched)->Arg(10000)->Unit(benchmark::kMillisecond);
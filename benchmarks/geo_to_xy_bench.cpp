@@ -0,0 +1,235 @@
+// benchmarks/geo_to_xy_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/geometry.h>
+#include <mylib/projection.h>
+
+#include <benchmark/benchmark.h>
+
+#include <exception>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Поточечный цикл через интерфейс: один виртуальный вызов на точку
+void run_per_point(benchmark::State& state, const IGeoPointToXY& prj)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto track = bench::make_geo_track(n);
+    std::vector<Point> out(n);
+
+    try {
+        for (auto _: state) {
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = prj.geo_to_xy(bench::kCenter, track[i]);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Пакетный вызов: один виртуальный вызов на весь трек
+void run_batch(benchmark::State& state, const IGeoPointToXY& prj)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto track = bench::make_geo_track(n);
+    std::vector<Point> out(n);
+
+    try {
+        for (auto _: state) {
+            prj.geo_to_xy_batch(bench::kCenter, track, out);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Обратное преобразование: поточечно через интерфейс или одним пакетом
+void run_inverse(benchmark::State& state, const IGeoPointToXY& prj, bool batch)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto xy = bench::make_xy_track(n);
+    std::vector<GeoPoint> out(n);
+
+    try {
+        for (auto _: state) {
+            if (batch) {
+                prj.xy_to_geo_batch(bench::kCenter, xy, out);
+            } else {
+                for (std::size_t i = 0; i < n; ++i) {
+                    out[i] = prj.xy_to_geo(bench::kCenter, xy[i]);
+                }
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_Equirect_PerPoint(benchmark::State& state)
+{
+    run_per_point(state, GeoToXYEquirectangular{});
+}
+
+void BM_Equirect_Batch(benchmark::State& state)
+{
+    run_batch(state, GeoToXYEquirectangular{});
+}
+
+void BM_Aeqd_PerPoint(benchmark::State& state)
+{
+    run_per_point(state, GeoToXYAeqd{});
+}
+
+void BM_Aeqd_Batch(benchmark::State& state)
+{
+    run_batch(state, GeoToXYAeqd{});
+}
+
+void BM_Utm_PerPoint(benchmark::State& state)
+{
+    run_per_point(state, GeoToXYUtm{});
+}
+
+void BM_Utm_Batch(benchmark::State& state)
+{
+    run_batch(state, GeoToXYUtm{});
+}
+
+void BM_Equirect_Inverse_PerPoint(benchmark::State& state)
+{
+    run_inverse(state, GeoToXYEquirectangular{}, false);
+}
+
+void BM_Equirect_Inverse_Batch(benchmark::State& state)
+{
+    run_inverse(state, GeoToXYEquirectangular{}, true);
+}
+
+void BM_Aeqd_Inverse_PerPoint(benchmark::State& state)
+{
+    run_inverse(state, GeoToXYAeqd{}, false);
+}
+
+void BM_Aeqd_Inverse_Batch(benchmark::State& state)
+{
+    run_inverse(state, GeoToXYAeqd{}, true);
+}
+
+void BM_Utm_Inverse_PerPoint(benchmark::State& state)
+{
+    run_inverse(state, GeoToXYUtm{}, false);
+}
+
+void BM_Utm_Inverse_Batch(benchmark::State& state)
+{
+    run_inverse(state, GeoToXYUtm{}, true);
+}
+
+// Встроенные проекции напрямую: вызов встраивается в цикл, без виртуального вызова и кэша
+template <class Engine>
+void run_engine(benchmark::State& state, const Engine& engine, bool inverse)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto track = bench::make_geo_track(n);
+    std::vector<Point> xy(n);
+    engine.forward(track, xy);
+    std::vector<GeoPoint> geo(n);
+
+    for (auto _: state) {
+        if (inverse) {
+            for (std::size_t i = 0; i < n; ++i) {
+                geo[i] = engine.inverse(xy[i]);
+            }
+            benchmark::DoNotOptimize(geo.data());
+        } else {
+            for (std::size_t i = 0; i < n; ++i) {
+                xy[i] = engine.forward(track[i]);
+            }
+            benchmark::DoNotOptimize(xy.data());
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_TransverseMercator_Forward(benchmark::State& state)
+{
+    run_engine(state, TransverseMercator::utm(GeoToXYUtm::utm_zone_from_lon(bench::kCenter.lon), true), false);
+}
+
+void BM_TransverseMercator_Inverse(benchmark::State& state)
+{
+    run_engine(state, TransverseMercator::utm(GeoToXYUtm::utm_zone_from_lon(bench::kCenter.lon), true), true);
+}
+
+void BM_AzimuthalEquidistant_Forward(benchmark::State& state)
+{
+    run_engine(state, AzimuthalEquidistant(bench::kCenter), false);
+}
+
+void BM_AzimuthalEquidistant_Inverse(benchmark::State& state)
+{
+    run_engine(state, AzimuthalEquidistant(bench::kCenter), true);
+}
+
+// Поточечный GeoProjector::forward: Args({вид проекции: 0 — AEQD, 1 — UTM; бэкенд: 0 — встроенный, 1 — PROJ}).
+// Без MYLIB_WITH_PROJ бэкенд PROJ пропускается.
+void BM_Projector_Forward(benchmark::State& state)
+{
+    const auto backend = state.range(1) == 0 ? ProjectorBackend::Native : ProjectorBackend::Proj;
+    const ProjectorKey key = state.range(0) == 0
+                                 ? ProjectorKey::aeqd(bench::kCenter, backend)
+                                 : ProjectorKey::utm(GeoToXYUtm::utm_zone_from_lon(bench::kCenter.lon), true, backend);
+    const auto track = bench::make_geo_track(100000);
+    std::vector<Point> out(track.size());
+    try {
+        const GeoProjector projector(key);
+        for (auto _: state) {
+            for (std::size_t i = 0; i < track.size(); ++i) {
+                out[i] = projector.forward(track[i]);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(track.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_Equirect_PerPoint)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Equirect_Batch)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Aeqd_PerPoint)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Aeqd_Batch)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Utm_PerPoint)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Utm_Batch)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Equirect_Inverse_PerPoint)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Equirect_Inverse_Batch)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Aeqd_Inverse_PerPoint)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Aeqd_Inverse_Batch)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Utm_Inverse_PerPoint)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Utm_Inverse_Batch)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_TransverseMercator_Forward)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_TransverseMercator_Inverse)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_AzimuthalEquidistant_Forward)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_AzimuthalEquidistant_Inverse)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Projector_Forward)->ArgsProduct({{0, 1}, {0, 1}});
@@ -0,0 +1,92 @@
+// benchmarks/geometry_bench.cpp
+#include "bench_common.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Расстояния между соседними точками трека
+void BM_Dist(benchmark::State& state)
+{
+    const auto pts = bench::make_xy_track(static_cast<std::size_t>(state.range(0)));
+    for (auto _: state) {
+        double s = 0.0;
+        for (std::size_t i = 1; i < pts.size(); ++i) {
+            s += dist(pts[i - 1], pts[i]);
+        }
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Скалярные произведения соседних сегментов (проверка разворотов)
+void BM_Dot(benchmark::State& state)
+{
+    const auto pts = bench::make_xy_track(static_cast<std::size_t>(state.range(0)));
+    for (auto _: state) {
+        double s = 0.0;
+        for (std::size_t i = 2; i < pts.size(); ++i) {
+            s += dot(pts[i - 1].x - pts[i - 2].x, pts[i - 1].y - pts[i - 2].y, pts[i].x - pts[i - 1].x,
+                     pts[i].y - pts[i - 1].y);
+        }
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Один запрос в середине пути: point_on_path каждый раз проходит ломаную заново
+void BM_PointOnPath(benchmark::State& state)
+{
+    const auto pts = bench::make_xy_track(static_cast<std::size_t>(state.range(0)));
+    const double half = 0.5 * polyline_lengths(pts).back();
+    for (auto _: state) {
+        benchmark::DoNotOptimize(point_on_path(pts, half));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Метрики полигона после изменения вершины: один проход по контуру
+void BM_Polygon_Metrics(benchmark::State& state)
+{
+    Polygon poly(bench::make_field_ring(static_cast<std::size_t>(state.range(0))));
+    const Point first = poly.vertices().front();
+    for (auto _: state) {
+        poly.set_vertex(0, first); // сброс кэша
+        benchmark::DoNotOptimize(poly.area());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Точка в полигоне: 64 запроса по сетке поперёк поля
+void BM_Polygon_Contains(benchmark::State& state)
+{
+    const Polygon poly(bench::make_field_ring(static_cast<std::size_t>(state.range(0))));
+    const BBox box = poly.bbox();
+    std::vector<Point> queries;
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            queries.push_back({box.min_x + (box.max_x - box.min_x) * (i + 0.5) / 8.0,
+                               box.min_y + (box.max_y - box.min_y) * (j + 0.5) / 8.0});
+        }
+    }
+    for (auto _: state) {
+        std::size_t inside = 0;
+        for (const Point& q: queries) {
+            inside += poly.contains(q) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(inside);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_Dist)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Dot)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_PointOnPath)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Polygon_Metrics)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Polygon_Contains)->RangeMultiplier(10)->Range(10, 10000000);
@@ -0,0 +1,43 @@
+// benchmarks/kernels_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/kernels.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Пропускная способность SoA-ядра equirectangular (точек в секунду) на заданном уровне SIMD
+void BM_EquirectSoa(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto level = static_cast<SimdLevel>(state.range(1));
+    if (!simd_level_supported(level)) {
+        state.SkipWithError("уровень SIMD не поддерживается процессором");
+        return;
+    }
+    state.SetLabel(simd_level_name(level));
+
+    const auto track = bench::make_geo_track(n);
+    std::vector<double> lat(n), lon(n), x(n), y(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        lat[i] = track[i].lat;
+        lon[i] = track[i].lon;
+    }
+
+    for (auto _: state) {
+        equirect_forward_soa(bench::kCenter, lat, lon, x, y, level);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::DoNotOptimize(y.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_EquirectSoa)->ArgsProduct({{1000, 100000, 1000000}, {0, 1, 2}});
@@ -0,0 +1,111 @@
+// benchmarks/path_matcher_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/path_matcher.h>
+#include <mylib/swath.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+constexpr std::size_t kFixes = 10000;
+
+// Фиксы вдоль пути: точки пути через step м (по умолчанию — начало пути через 0,5 м) с шумом приёмника 0,3 м
+std::vector<Point> make_fixes(const PolylineIndex& path, double step = 0.5)
+{
+    std::mt19937 rng(5);
+    std::normal_distribution<double> noise(0.0, 0.3);
+    std::vector<Point> fixes;
+    for (std::size_t i = 0; i < kFixes; ++i) {
+        const Point p = path.point_at(std::min(step * static_cast<double>(i), path.length()));
+        fixes.push_back({p.x + noise(rng), p.y + noise(rng)});
+    }
+    return fixes;
+}
+
+// Последовательные фиксы с подсказкой: обход одной-двух ячеек на фикс
+void BM_PathMatcher_Sequential(benchmark::State& state)
+{
+    const PathMatcher m(bench::make_xy_track(static_cast<std::size_t>(state.range(0))));
+    const auto fixes = make_fixes(m.path());
+    std::vector<PathProjection> out(fixes.size());
+    for (auto _: state) {
+        m.project(fixes, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(fixes.size()));
+}
+
+// Каждый фикс без подсказки: радиус поиска задаёт только сетка
+void BM_PathMatcher_Cold(benchmark::State& state)
+{
+    const PathMatcher m(bench::make_xy_track(static_cast<std::size_t>(state.range(0))));
+    const auto fixes = make_fixes(m.path());
+    for (auto _: state) {
+        for (const Point& p: fixes) {
+            benchmark::DoNotOptimize(m.project(p));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(fixes.size()));
+}
+
+// Плановый путь челнока: квадрат range(0) м, захват 3 м. Сегменты — длинные проходы и короткие
+// переезды; фиксы равномерно по всему пути
+PathMatcher make_swath_matcher(double side)
+{
+    const Polygon field({{0, 0}, {side, 0}, {side, side}, {0, side}});
+    return PathMatcher(plan_swaths(field, {3.0, 0.0, 0.0}).path);
+}
+
+void BM_PathMatcher_SwathPlan_Sequential(benchmark::State& state)
+{
+    const PathMatcher m = make_swath_matcher(static_cast<double>(state.range(0)));
+    const auto fixes = make_fixes(m.path(), m.path().length() / static_cast<double>(kFixes));
+    std::vector<PathProjection> out(fixes.size());
+    for (auto _: state) {
+        m.project(fixes, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(fixes.size()));
+    state.counters["segments"] = static_cast<double>(m.path().points().size() - 1);
+    state.counters["cell_m"] = m.cell_size();
+}
+
+void BM_PathMatcher_SwathPlan_Cold(benchmark::State& state)
+{
+    const PathMatcher m = make_swath_matcher(static_cast<double>(state.range(0)));
+    const auto fixes = make_fixes(m.path(), m.path().length() / static_cast<double>(kFixes));
+    for (auto _: state) {
+        for (const Point& p: fixes) {
+            benchmark::DoNotOptimize(m.project(p));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(fixes.size()));
+}
+
+// Построение сетки сегментов
+void BM_PathMatcher_Build(benchmark::State& state)
+{
+    const auto path = bench::make_xy_track(static_cast<std::size_t>(state.range(0)));
+    for (auto _: state) {
+        const PathMatcher m(path);
+        benchmark::DoNotOptimize(m.cell_size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_PathMatcher_Sequential)->RangeMultiplier(10)->Range(10000, 10000000);
+BENCHMARK(BM_PathMatcher_Cold)->RangeMultiplier(10)->Range(10000, 10000000);
+BENCHMARK(BM_PathMatcher_SwathPlan_Sequential)->Arg(500)->Arg(2000);
+BENCHMARK(BM_PathMatcher_SwathPlan_Cold)->Arg(500)->Arg(2000);
+BENCHMARK(BM_PathMatcher_Build)->RangeMultiplier(10)->Range(1000, 1000000);
@@ -0,0 +1,104 @@
+// benchmarks/polygon_batch_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/polygon_batch.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Поля от 8 до 256 вершин (в среднем ~130), каждое десятое — с дырой
+std::vector<Polygon> make_fields(std::size_t count)
+{
+    std::mt19937 rng(23);
+    std::uniform_int_distribution<std::size_t> size(8, 256);
+    std::vector<Polygon> out;
+    out.reserve(count);
+    for (std::size_t k = 0; k < count; ++k) {
+        Polygon p(bench::make_field_ring(size(rng)));
+        if (k % 10 == 0) {
+            std::vector<Point> hole = bench::make_field_ring(16);
+            for (Point& v: hole) {
+                v.x = 412345.0 + (v.x - 412345.0) * 0.2;
+                v.y = 6178901.0 + (v.y - 6178901.0) * 0.2;
+            }
+            p.add_hole(std::move(hole));
+        }
+        out.push_back(std::move(p));
+    }
+    return out;
+}
+
+struct FlatStorage {
+    std::vector<Point> points;
+    std::vector<std::size_t> ring_offsets{0};
+    std::vector<std::size_t> polygon_rings{0};
+
+    explicit FlatStorage(const std::vector<Polygon>& polygons)
+    {
+        for (const Polygon& p: polygons) {
+            points.insert(points.end(), p.vertices().begin(), p.vertices().end());
+            ring_offsets.push_back(points.size());
+            for (const auto& h: p.holes()) {
+                points.insert(points.end(), h.begin(), h.end());
+                ring_offsets.push_back(points.size());
+            }
+            polygon_rings.push_back(ring_offsets.size() - 1);
+        }
+    }
+};
+
+std::size_t vertex_count(const std::vector<Polygon>& polygons)
+{
+    std::size_t n = 0;
+    for (const Polygon& p: polygons) {
+        n += p.vertices().size();
+        for (const auto& h: p.holes()) {
+            n += h.size();
+        }
+    }
+    return n;
+}
+
+// Прежний путь: метрики каждого Polygon по очереди. Копия без кэша восстанавливается вне замера.
+void BM_PolygonMetrics_PerObject(benchmark::State& state)
+{
+    const auto fresh = make_fields(static_cast<std::size_t>(state.range(0)));
+    std::vector<Polygon> polygons;
+    double sum = 0.0;
+    for (auto _: state) {
+        state.PauseTiming();
+        polygons = fresh;
+        state.ResumeTiming();
+        for (const Polygon& p: polygons) {
+            sum += p.area() + p.perimeter() + p.bbox().max_x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(vertex_count(fresh)));
+}
+
+// Плоский набор (CSR): Args({число полигонов, потоков; 0 — все})
+void BM_PolygonMetrics_Flat(benchmark::State& state)
+{
+    const auto fields = make_fields(static_cast<std::size_t>(state.range(0)));
+    const FlatStorage flat(fields);
+    const FlatPolygons view{flat.points, flat.ring_offsets, flat.polygon_rings};
+    std::vector<PolygonMetrics> out(view.size());
+    for (auto _: state) {
+        polygon_metrics(view, out, static_cast<std::size_t>(state.range(1)));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(flat.points.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_PolygonMetrics_PerObject)->RangeMultiplier(10)->Range(1000, 100000)->UseRealTime();
+BENCHMARK(BM_PolygonMetrics_Flat)->ArgsProduct({{1000, 10000, 100000}, {1, 0}})->UseRealTime();
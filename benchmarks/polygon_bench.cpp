@@ -0,0 +1,70 @@
+// benchmarks/polygon_bench.cpp
+#include "bench_common.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Прежняя реализация Polygon::area: long double и остаток от деления в цикле
+double area_modulo_long_double(const std::vector<Point>& v)
+{
+    const std::size_t n = v.size();
+    long double s = 0.0L;
+    for (std::size_t i = 0; i < n; ++i) {
+        const Point& p1 = v[i];
+        const Point& p2 = v[(i + 1) % n];
+        s += static_cast<long double>(p1.x) * p2.y - static_cast<long double>(p2.x) * p1.y;
+    }
+    return std::abs(static_cast<double>(s * 0.5L));
+}
+
+void BM_RingArea_ModuloLongDouble(benchmark::State& state)
+{
+    const auto ring = bench::make_field_ring(static_cast<std::size_t>(state.range(0)));
+    for (auto _: state) {
+        benchmark::DoNotOptimize(area_modulo_long_double(ring));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_RingArea_LongDouble(benchmark::State& state)
+{
+    const auto ring = bench::make_field_ring(static_cast<std::size_t>(state.range(0)));
+    for (auto _: state) {
+        benchmark::DoNotOptimize(ring_signed_area(ring, AreaSummation::LongDouble));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_RingArea_Compensated(benchmark::State& state)
+{
+    const auto ring = bench::make_field_ring(static_cast<std::size_t>(state.range(0)));
+    for (auto _: state) {
+        benchmark::DoNotOptimize(ring_signed_area(ring, AreaSummation::Compensated));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Повторный запрос метрик одного поля — кэш
+void BM_Polygon_CachedMetrics(benchmark::State& state)
+{
+    const Polygon poly(bench::make_field_ring(static_cast<std::size_t>(state.range(0))));
+    for (auto _: state) {
+        benchmark::DoNotOptimize(poly.area());
+        benchmark::DoNotOptimize(poly.bbox());
+        benchmark::DoNotOptimize(poly.centroid());
+        benchmark::DoNotOptimize(poly.perimeter());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_RingArea_ModuloLongDouble)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_RingArea_LongDouble)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_RingArea_Compensated)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_Polygon_CachedMetrics)->Arg(1000);
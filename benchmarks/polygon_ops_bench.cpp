@@ -0,0 +1,108 @@
+// benchmarks/polygon_ops_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/polygon_ops.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Выпуклое окно из m вершин, перекрывающее часть поля
+std::vector<Point> make_window(std::size_t m)
+{
+    std::vector<Point> window(m);
+    for (std::size_t k = 0; k < m; ++k) {
+        const double a = 0.3 + 2.0 * kPI * static_cast<double>(k) / static_cast<double>(m);
+        window[k] = {412345.0 + 250.0 + 450.0 * std::cos(a), 6178901.0 + 120.0 + 450.0 * std::sin(a)};
+    }
+    return window;
+}
+
+// Наивное отсечение (Сазерленд — Ходжмен): каждое из m рёбер окна проходит по всем вершинам, O(n·m)
+std::vector<Point> clip_naive(const std::vector<Point>& subject, const std::vector<Point>& window)
+{
+    std::vector<Point> cur = subject;
+    std::vector<Point> next;
+    for (std::size_t i = 0; i < window.size() && !cur.empty(); ++i) {
+        const Point& a = window[i];
+        const Point& b = window[(i + 1) % window.size()];
+        const auto side = [&](const Point& p) { return (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x); };
+        next.clear();
+        for (std::size_t k = 0; k < cur.size(); ++k) {
+            const Point& p = cur[k];
+            const Point& q = cur[(k + 1) % cur.size()];
+            const double sp = side(p), sq = side(q);
+            if (sp >= 0.0) next.push_back(p);
+            if ((sp >= 0.0) != (sq >= 0.0)) {
+                const double t = sp / (sp - sq);
+                next.push_back({p.x + t * (q.x - p.x), p.y + t * (q.y - p.y)});
+            }
+        }
+        cur.swap(next);
+    }
+    return cur;
+}
+
+// Аргументы: вершины поля n, вершины окна m
+void BM_ClipNaive(benchmark::State& state)
+{
+    const auto field = bench::make_field_ring(static_cast<std::size_t>(state.range(0)));
+    const auto window = make_window(static_cast<std::size_t>(state.range(1)));
+    for (auto _: state) {
+        benchmark::DoNotOptimize(clip_naive(field, window));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * (state.range(0) + state.range(1)));
+}
+
+void BM_Intersection(benchmark::State& state)
+{
+    const Polygon field(bench::make_field_ring(static_cast<std::size_t>(state.range(0))));
+    const Polygon window(make_window(static_cast<std::size_t>(state.range(1))));
+    for (auto _: state) {
+        benchmark::DoNotOptimize(boolean_op(field, window, BooleanOp::Intersection));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * (state.range(0) + state.range(1)));
+}
+
+// Поле минус 100 полос захвата шириной 6 м под углом 17°
+void BM_DifferenceStrips(benchmark::State& state)
+{
+    const std::vector<Polygon> field{Polygon(bench::make_field_ring(static_cast<std::size_t>(state.range(0))))};
+    const double ux = std::sin(deg2rad(17.0)), uy = std::cos(deg2rad(17.0));
+    std::vector<Polygon> strips;
+    for (int i = 0; i < 100; ++i) {
+        const double off = -600.0 + 12.0 * i;
+        const Point c{412345.0 + off * uy, 6178901.0 - off * ux};
+        const Point a{c.x - 700.0 * ux, c.y - 700.0 * uy};
+        const Point b{c.x + 700.0 * ux, c.y + 700.0 * uy};
+        const double nx = 3.0 * uy, ny = -3.0 * ux;
+        strips.emplace_back(std::vector<Point>{{a.x - nx, a.y - ny}, {b.x - nx, b.y - ny}, {b.x + nx, b.y + ny},
+                                               {a.x + nx, a.y + ny}});
+    }
+    for (auto _: state) {
+        benchmark::DoNotOptimize(boolean_op(field, strips, BooleanOp::Difference));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Поворотная полоса 20 м: сужение контура поля
+void BM_OffsetHeadland(benchmark::State& state)
+{
+    const Polygon field(bench::make_field_ring(static_cast<std::size_t>(state.range(0))));
+    for (auto _: state) {
+        benchmark::DoNotOptimize(offset_polygon(field, -20.0));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_ClipNaive)->Args({10000, 64})->Args({10000, 1024})->Args({50000, 1024})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Intersection)->Args({10000, 64})->Args({10000, 1024})->Args({50000, 1024})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DifferenceStrips)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_OffsetHeadland)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,172 @@
+// benchmarks/polygon_set_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/polygon_set.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+constexpr std::size_t kFieldVertices = 24;
+constexpr std::size_t kTrackPoints = 200;
+
+// Источник загрузки: вершины всех полей подряд, как после разбора файла
+std::vector<Point> make_source(std::size_t fields)
+{
+    const auto ring = bench::make_field_ring(kFieldVertices);
+    std::vector<Point> src;
+    src.reserve(fields * kFieldVertices);
+    for (std::size_t k = 0; k < fields; ++k) {
+        const double dx = 2000.0 * static_cast<double>(k % 1000);
+        const double dy = 2000.0 * static_cast<double>(k / 1000);
+        for (const Point& p: ring) {
+            src.push_back({p.x + dx, p.y + dy});
+        }
+    }
+    return src;
+}
+
+std::vector<Polygon> load_polygons(const std::vector<Point>& src, std::size_t fields)
+{
+    std::vector<Polygon> out;
+    out.reserve(fields);
+    for (std::size_t k = 0; k < fields; ++k) {
+        const auto first = src.begin() + static_cast<std::ptrdiff_t>(k * kFieldVertices);
+        out.emplace_back(std::vector<Point>(first, first + kFieldVertices));
+    }
+    return out;
+}
+
+void load_set(PolygonSet& set, const std::vector<Point>& src, std::size_t fields)
+{
+    for (std::size_t k = 0; k < fields; ++k) {
+        set.add(span<const Point>(src.data() + k * kFieldVertices, kFieldVertices));
+    }
+}
+
+// Загрузка: вектор на каждое поле
+void BM_Load_VectorOfPolygons(benchmark::State& state)
+{
+    const auto fields = static_cast<std::size_t>(state.range(0));
+    const auto src = make_source(fields);
+    for (auto _: state) {
+        auto polygons = load_polygons(src, fields);
+        benchmark::DoNotOptimize(polygons.data());
+        state.PauseTiming();
+        polygons = {};
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Загрузка в PolygonSet из кучи: Args({полей, reserve: 0 — рост трёх буферов, 1 — размеры известны заранее})
+void BM_Load_PolygonSet(benchmark::State& state)
+{
+    const auto fields = static_cast<std::size_t>(state.range(0));
+    const auto src = make_source(fields);
+    for (auto _: state) {
+        PolygonSet set;
+        if (state.range(1) != 0) set.reserve(fields, fields, src.size());
+        load_set(set, src, fields);
+        benchmark::DoNotOptimize(set.flat().points.data());
+        state.PauseTiming();
+        set = PolygonSet();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Повторная загрузка в тот же набор после clear(): память уже выделена
+void BM_Load_PolygonSet_Reused(benchmark::State& state)
+{
+    const auto fields = static_cast<std::size_t>(state.range(0));
+    const auto src = make_source(fields);
+    PolygonSet set;
+    for (auto _: state) {
+        set.clear();
+        load_set(set, src, fields);
+        benchmark::DoNotOptimize(set.flat().points.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Разрушение: вектор полей против набора; загрузка вне замера
+void BM_Teardown_VectorOfPolygons(benchmark::State& state)
+{
+    const auto fields = static_cast<std::size_t>(state.range(0));
+    const auto src = make_source(fields);
+    for (auto _: state) {
+        state.PauseTiming();
+        auto polygons = load_polygons(src, fields);
+        state.ResumeTiming();
+        polygons = {};
+        benchmark::DoNotOptimize(polygons.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_Teardown_PolygonSet(benchmark::State& state)
+{
+    const auto fields = static_cast<std::size_t>(state.range(0));
+    const auto src = make_source(fields);
+    for (auto _: state) {
+        state.PauseTiming();
+        PolygonSet set;
+        load_set(set, src, fields);
+        state.ResumeTiming();
+        set = PolygonSet();
+        benchmark::DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Треки: вектор на трек против TrackStore на арене поверх одного буфера
+void BM_Load_TrackVectors(benchmark::State& state)
+{
+    const auto tracks = static_cast<std::size_t>(state.range(0));
+    const auto src = bench::make_geo_track(kTrackPoints);
+    for (auto _: state) {
+        std::vector<std::vector<GeoPoint>> store;
+        store.reserve(tracks);
+        for (std::size_t k = 0; k < tracks; ++k) {
+            store.emplace_back(src.begin(), src.end());
+        }
+        benchmark::DoNotOptimize(store.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_Load_TrackStore_Arena(benchmark::State& state)
+{
+    const auto tracks = static_cast<std::size_t>(state.range(0));
+    const auto src = bench::make_geo_track(kTrackPoints);
+    // Буфер арены с запасом на выравнивание; повторные итерации пишут в уже отображённые страницы
+    const std::size_t bytes = tracks * kTrackPoints * sizeof(GeoPoint) + (tracks + 1) * sizeof(std::size_t) + 4096;
+    std::vector<std::byte> buffer(bytes);
+    for (auto _: state) {
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+        TrackStore store(&arena);
+        store.reserve(tracks, tracks * kTrackPoints);
+        for (std::size_t k = 0; k < tracks; ++k) {
+            store.add(src);
+        }
+        benchmark::DoNotOptimize(store.points().data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Load_VectorOfPolygons)->RangeMultiplier(10)->Range(1000, 100000)->Arg(500000);
+BENCHMARK(BM_Load_PolygonSet)->ArgsProduct({{1000, 10000, 100000, 500000}, {0, 1}});
+BENCHMARK(BM_Load_PolygonSet_Reused)->RangeMultiplier(10)->Range(1000, 100000)->Arg(500000);
+BENCHMARK(BM_Teardown_VectorOfPolygons)->RangeMultiplier(10)->Range(1000, 100000)->Arg(500000);
+BENCHMARK(BM_Teardown_PolygonSet)->RangeMultiplier(10)->Range(1000, 100000)->Arg(500000);
+BENCHMARK(BM_Load_TrackVectors)->RangeMultiplier(10)->Range(100, 10000);
+BENCHMARK(BM_Load_TrackStore_Arena)->RangeMultiplier(10)->Range(100, 10000);
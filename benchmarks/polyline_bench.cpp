@@ -0,0 +1,134 @@
+// benchmarks/polyline_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/polyline.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Выборка точек через 1 м вдоль всего пути: point_on_path на каждый запрос пересчитывает длины
+void BM_Sample_PointOnPath(benchmark::State& state)
+{
+    const auto pts = bench::make_xy_track(static_cast<std::size_t>(state.range(0)));
+    const double length = polyline_lengths(pts).back();
+    std::size_t samples = 0;
+    for (auto _: state) {
+        for (double d = 0.0; d <= length; d += 1.0) {
+            benchmark::DoNotOptimize(point_on_path(pts, d));
+            ++samples;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(samples));
+}
+
+void BM_Sample_IndexPointAt(benchmark::State& state)
+{
+    const PolylineIndex idx(bench::make_xy_track(static_cast<std::size_t>(state.range(0))));
+    std::size_t samples = 0;
+    for (auto _: state) {
+        for (double d = 0.0; d <= idx.length(); d += 1.0) {
+            benchmark::DoNotOptimize(idx.point_at(d));
+            ++samples;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(samples));
+}
+
+void BM_Sample_IndexCursor(benchmark::State& state)
+{
+    const PolylineIndex idx(bench::make_xy_track(static_cast<std::size_t>(state.range(0))));
+    std::size_t samples = 0;
+    for (auto _: state) {
+        PolylineIndex::Cursor cursor;
+        for (double d = 0.0; d <= idx.length(); d += 1.0) {
+            benchmark::DoNotOptimize(idx.point_at(d, cursor));
+            ++samples;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(samples));
+}
+
+void BM_Sample_IndexResample(benchmark::State& state)
+{
+    const PolylineIndex idx(bench::make_xy_track(static_cast<std::size_t>(state.range(0))));
+    std::size_t samples = 0;
+    for (auto _: state) {
+        const auto out = idx.resample(1.0);
+        benchmark::DoNotOptimize(out.data());
+        samples += out.size();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(samples));
+}
+
+// Накопленные длины: новый вектор на каждый вызов
+void BM_PolylineLengths_Vector(benchmark::State& state)
+{
+    const auto pts = bench::make_xy_track(static_cast<std::size_t>(state.range(0)));
+    for (auto _: state) {
+        auto s = polyline_lengths(pts);
+        benchmark::DoNotOptimize(s.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Буфер вызывающего, AoS
+void BM_PolylineLengths_Buffer(benchmark::State& state)
+{
+    const auto pts = bench::make_xy_track(static_cast<std::size_t>(state.range(0)));
+    std::vector<double> s(pts.size());
+    for (auto _: state) {
+        polyline_lengths(pts, s);
+        benchmark::DoNotOptimize(s.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Буфер вызывающего, SoA + векторизованное ядро
+void BM_PolylineLengths_Soa(benchmark::State& state)
+{
+    const auto pts = bench::make_xy_track(static_cast<std::size_t>(state.range(0)));
+    std::vector<double> xs, ys, s(pts.size());
+    for (const auto& p: pts) {
+        xs.push_back(p.x);
+        ys.push_back(p.y);
+    }
+    for (auto _: state) {
+        polyline_lengths(xs, ys, s);
+        benchmark::DoNotOptimize(s.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Потоковая длина трека кусками по 4096 точек
+void BM_PolylineLengthAccumulator_Chunks(benchmark::State& state)
+{
+    const auto pts = bench::make_xy_track(static_cast<std::size_t>(state.range(0)));
+    constexpr std::size_t kChunk = 4096;
+    for (auto _: state) {
+        PolylineLengthAccumulator acc;
+        for (std::size_t begin = 0; begin < pts.size(); begin += kChunk) {
+            acc.append(span<const Point>(pts).subspan(begin, std::min(kChunk, pts.size() - begin)));
+        }
+        benchmark::DoNotOptimize(acc.length());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Sample_PointOnPath)->Arg(1000)->Arg(5000);
+BENCHMARK(BM_Sample_IndexPointAt)->Arg(1000)->Arg(5000)->Arg(50000);
+BENCHMARK(BM_Sample_IndexCursor)->Arg(1000)->Arg(5000)->Arg(50000);
+BENCHMARK(BM_Sample_IndexResample)->Arg(1000)->Arg(5000)->Arg(50000);
+BENCHMARK(BM_PolylineLengths_Vector)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_PolylineLengths_Buffer)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_PolylineLengths_Soa)->RangeMultiplier(10)->Range(10, 10000000);
+BENCHMARK(BM_PolylineLengthAccumulator_Chunks)->RangeMultiplier(10)->Range(10, 10000000);
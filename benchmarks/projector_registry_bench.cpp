@@ -0,0 +1,64 @@
+// benchmarks/projector_registry_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/geometry.h>
+
+#include <benchmark/benchmark.h>
+
+#include <exception>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+constexpr int kKeys = 32;
+
+// Центры AEQD соседних полей: по одному на поток в сценарии с разными ключами
+const std::vector<ProjectorKey>& keys()
+{
+    static const std::vector<ProjectorKey> all = [] {
+        std::vector<ProjectorKey> k;
+        for (int i = 0; i < kKeys; ++i) {
+            k.push_back(ProjectorKey::aeqd({bench::kCenter.lat + 0.01 * i, bench::kCenter.lon, std::nullopt}));
+        }
+        return k;
+    }();
+    return all;
+}
+
+// Все потоки берут один ключ (state.range(0) == 0) или каждый свой
+template <class Source>
+void run_lookups(benchmark::State& state, Source& source)
+{
+    const ProjectorKey& key = keys()[state.range(0) == 0 ? 0 : static_cast<std::size_t>(state.thread_index() % kKeys)];
+    try {
+        benchmark::DoNotOptimize(source.get(key)); // прогрев вне замера
+        for (auto _: state) {
+            benchmark::DoNotOptimize(source.get(key));
+        }
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Общий ProjectorCache: каждый поиск берёт мьютекс
+void BM_ProjectorCacheLookup(benchmark::State& state)
+{
+    static ProjectorCache cache;
+    run_lookups(state, cache);
+}
+
+// Реестр: поиск в опубликованной таблице без блокировок
+void BM_ProjectorRegistryLookup(benchmark::State& state)
+{
+    run_lookups(state, ProjectorRegistry::global());
+}
+
+} // namespace
+
+// Аргумент: 0 — один ключ на все потоки, 1 — у каждого потока свой
+BENCHMARK(BM_ProjectorCacheLookup)->Arg(0)->Arg(1)->Threads(1)->Threads(8)->Threads(32)->UseRealTime();
+BENCHMARK(BM_ProjectorRegistryLookup)->Arg(0)->Arg(1)->Threads(1)->Threads(8)->Threads(32)->UseRealTime();
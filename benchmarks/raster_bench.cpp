@@ -0,0 +1,84 @@
+// benchmarks/raster_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/raster.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+constexpr double kExtent = 1100.0;    // м, сторона растра вокруг поля ~1x1 км
+constexpr double kSwathWidth = 6.0;   // м
+
+// Растр side x side, накрывающий поле
+struct BenchGrid {
+    std::vector<float> cells;
+    RasterGrid grid;
+
+    explicit BenchGrid(std::size_t side)
+        : cells(side * side, 0.0f)
+        , grid{{412345.0 - 0.5 * kExtent, 6178901.0 - 0.5 * kExtent}, kExtent / static_cast<double>(side), side,
+               side, span<float>(cells)}
+    {
+    }
+};
+
+// Челнок по полю с шагом в ширину захвата
+std::vector<Point> make_shuttle()
+{
+    std::vector<Point> path;
+    const double x0 = 412345.0 - 500.0;
+    const double y0 = 6178901.0 - 500.0;
+    for (int k = 0; k * kSwathWidth <= 1000.0; ++k) {
+        const double y = y0 + k * kSwathWidth;
+        const bool forward = k % 2 == 0;
+        path.push_back({forward ? x0 : x0 + 1000.0, y});
+        path.push_back({forward ? x0 + 1000.0 : x0, y});
+    }
+    return path;
+}
+
+// Args({сторона растра, RasterCoverage})
+void BM_Rasterize_Field(benchmark::State& state)
+{
+    const Polygon field(bench::make_field_ring(256));
+    BenchGrid g(static_cast<std::size_t>(state.range(0)));
+    RasterParams params;
+    params.coverage = static_cast<RasterCoverage>(state.range(1));
+    for (auto _: state) {
+        rasterize(field, g.grid, params);
+        benchmark::DoNotOptimize(g.cells.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0) * state.range(0));
+}
+
+// Все проходы челнока одной полосой
+void BM_Rasterize_Strip(benchmark::State& state)
+{
+    const auto path = make_shuttle();
+    BenchGrid g(static_cast<std::size_t>(state.range(0)));
+    RasterParams params;
+    params.coverage = static_cast<RasterCoverage>(state.range(1));
+    params.merge = RasterMerge::Max;
+    for (auto _: state) {
+        rasterize_strip(path, kSwathWidth, g.grid, params);
+        benchmark::DoNotOptimize(g.cells.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0) * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Rasterize_Field)
+    ->ArgsProduct({{1000, 4000, 10000}, {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_Rasterize_Strip)
+    ->ArgsProduct({{1000, 4000, 10000}, {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,62 @@
+// benchmarks/simplify_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/simplify.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Трек челнока с шумом приёмника; аргумент — число вершин.
+// Счётчик ratio — во сколько раз сократилось число вершин.
+void BM_SimplifyTrack(benchmark::State& state, SimplifyMethod method, double tolerance)
+{
+    const auto track = bench::make_xy_track(static_cast<std::size_t>(state.range(0)));
+    std::vector<Point> out(track.size());
+    Simplifier simplifier(method, tolerance);
+    SimplifyStats stats;
+    for (auto _: state) {
+        stats = simplifier.simplify(track, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    state.counters["ratio"] = stats.ratio();
+}
+
+// Допуск 0.5 м
+void BM_SimplifyTrack_DouglasPeucker(benchmark::State& state)
+{
+    BM_SimplifyTrack(state, SimplifyMethod::DouglasPeucker, 0.5);
+}
+
+// Допуск 5 м^2: треугольник с основанием ~10 м и высотой 1 м
+void BM_SimplifyTrack_Visvalingam(benchmark::State& state)
+{
+    BM_SimplifyTrack(state, SimplifyMethod::Visvalingam, 5.0);
+}
+
+// Контур поля из 100 000 вершин, допуск 0.05 м
+void BM_SimplifyField(benchmark::State& state)
+{
+    const Polygon field(bench::make_field_ring(100000));
+    Simplifier simplifier(static_cast<SimplifyMethod>(state.range(0)), 0.05);
+    SimplifyStats stats;
+    for (auto _: state) {
+        benchmark::DoNotOptimize(simplifier.simplify(field, &stats));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 100000);
+    state.counters["ratio"] = stats.ratio();
+}
+
+} // namespace
+
+BENCHMARK(BM_SimplifyTrack_DouglasPeucker)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SimplifyTrack_Visvalingam)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SimplifyField)
+    ->Arg(static_cast<int>(SimplifyMethod::DouglasPeucker))
+    ->Arg(static_cast<int>(SimplifyMethod::Visvalingam))
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,151 @@
+// benchmarks/spatial_index_bench.cpp
+#include <mylib/spatial_index.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Поля на регулярной сетке 100x100 м: восьмиугольники со случайным искажением и зазорами между полями
+std::vector<Polygon> make_fields(std::size_t n)
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> jitter(0.8, 1.0);
+    const auto side = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(n))));
+
+    std::vector<Polygon> fields;
+    fields.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double cx = 100.0 * static_cast<double>(i % side) + 50.0;
+        const double cy = 100.0 * static_cast<double>(i / side) + 50.0;
+        std::vector<Point> v;
+        for (int k = 0; k < 8; ++k) {
+            const double a = 2.0 * kPI * k / 8.0;
+            const double r = 50.0 * jitter(rng);
+            v.push_back({cx + r * std::cos(a), cy + r * std::sin(a)});
+        }
+        fields.emplace_back(std::move(v));
+    }
+    return fields;
+}
+
+std::vector<Point> make_queries(std::size_t n_fields, std::size_t n_queries)
+{
+    std::mt19937 rng(12);
+    const double extent = 100.0 * std::ceil(std::sqrt(static_cast<double>(n_fields)));
+    std::uniform_real_distribution<double> pos(0.0, extent);
+    std::vector<Point> q(n_queries);
+    for (auto& p: q) {
+        p = {pos(rng), pos(rng)};
+    }
+    return q;
+}
+
+void BM_PolygonIndex_Build(benchmark::State& state)
+{
+    const auto fields = make_fields(static_cast<std::size_t>(state.range(0)));
+    for (auto _: state) {
+        PolygonIndex idx(fields);
+        benchmark::DoNotOptimize(idx.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Задержка одиночного запроса «в каком поле машина»: каждый запрос замеряется отдельно,
+// в счётчиках — перцентили в наносекундах
+void BM_PolygonIndex_LocateLatency(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const PolygonIndex idx(make_fields(n));
+    const auto queries = make_queries(n, 100000);
+
+    std::vector<double> latencies;
+    latencies.reserve(queries.size());
+    std::size_t q = 0;
+    for (auto _: state) {
+        const Point& p = queries[q];
+        const auto t0 = std::chrono::steady_clock::now();
+        benchmark::DoNotOptimize(idx.locate(p));
+        const auto t1 = std::chrono::steady_clock::now();
+        if (latencies.size() < queries.size()) {
+            latencies.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count());
+        }
+        q = (q + 1) % queries.size();
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&](double pct) {
+        return latencies[static_cast<std::size_t>(pct * static_cast<double>(latencies.size() - 1))];
+    };
+    state.counters["p50_ns"] = percentile(0.50);
+    state.counters["p90_ns"] = percentile(0.90);
+    state.counters["p99_ns"] = percentile(0.99);
+    state.counters["p999_ns"] = percentile(0.999);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+void BM_PolygonIndex_LocateBatch(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const PolygonIndex idx(make_fields(n));
+    const auto queries = make_queries(n, 10000);
+    std::vector<std::size_t> out(queries.size());
+    for (auto _: state) {
+        idx.locate(queries, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+void BM_PolygonIndex_QueryBBox(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const PolygonIndex idx(make_fields(n));
+    const auto queries = make_queries(n, 1000);
+    std::vector<std::size_t> out;
+    std::size_t q = 0;
+    for (auto _: state) {
+        const Point& p = queries[q];
+        idx.query_bbox(BBox{p.x, p.y, p.x + 500.0, p.y + 500.0}, out);
+        benchmark::DoNotOptimize(out.data());
+        q = (q + 1) % queries.size();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Базовая линия: линейный перебор полей
+void BM_LinearScan_Locate(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto fields = make_fields(n);
+    const auto queries = make_queries(n, 1000);
+    std::size_t q = 0;
+    for (auto _: state) {
+        const Point& p = queries[q];
+        std::size_t found = PolygonIndex::npos;
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            if (fields[i].contains(p)) {
+                found = i;
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(found);
+        q = (q + 1) % queries.size();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+} // namespace
+
+BENCHMARK(BM_PolygonIndex_Build)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PolygonIndex_LocateLatency)->Arg(10000)->Arg(100000)->Arg(1000000);
+BENCHMARK(BM_PolygonIndex_LocateBatch)->Arg(10000)->Arg(100000)->Arg(1000000);
+BENCHMARK(BM_PolygonIndex_QueryBBox)->Arg(10000)->Arg(100000)->Arg(1000000);
+BENCHMARK(BM_LinearScan_Locate)->Arg(10000)->Arg(100000);
@@ -0,0 +1,71 @@
+// benchmarks/swath_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/swath.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Кольцо-дыра: маленькая искажённая окружность вокруг точки c
+std::vector<Point> make_hole(const Point& c, double r, std::size_t n)
+{
+    std::vector<Point> hole(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double a = 2.0 * kPI * static_cast<double>(i) / static_cast<double>(n);
+        hole[i] = {c.x + r * std::cos(a), c.y + r * (1.0 + 0.2 * std::sin(3.0 * a)) * std::sin(a)};
+    }
+    return hole;
+}
+
+// Поле с n вершинами контура, ширина захвата 6 м: ~170 линий
+void BM_PlanSwaths(benchmark::State& state)
+{
+    const Polygon field(bench::make_field_ring(static_cast<std::size_t>(state.range(0))));
+    const SwathParams params{6.0, 17.0, 0.0};
+    for (auto _: state) {
+        benchmark::DoNotOptimize(plan_swaths(field, params));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// То же поле с 64 дырами (колки, столбы ЛЭП) по 256 вершин
+void BM_PlanSwaths_Holes(benchmark::State& state)
+{
+    auto ring = bench::make_field_ring(static_cast<std::size_t>(state.range(0)));
+    const Point c{412345.0, 6178901.0};
+    std::vector<std::vector<Point>> holes;
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            holes.push_back(make_hole({c.x - 280.0 + 80.0 * i, c.y - 280.0 + 80.0 * j}, 15.0, 256));
+        }
+    }
+    const Polygon field(std::move(ring), std::move(holes));
+    const SwathParams params{6.0, 17.0, 0.0};
+    for (auto _: state) {
+        benchmark::DoNotOptimize(plan_swaths(field, params));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Перебор 180 направлений с шагом 1° на поле с 10 000 вершин; аргумент — число потоков
+void BM_SweepHeadings(benchmark::State& state)
+{
+    const Polygon field(bench::make_field_ring(10000));
+    const HeadingSweepParams params{6.0, 0.0, 20.0, static_cast<std::size_t>(state.range(0))};
+    for (auto _: state) {
+        benchmark::DoNotOptimize(sweep_headings(field, 1.0, params));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 180);
+}
+
+} // namespace
+
+BENCHMARK(BM_PlanSwaths)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PlanSwaths_Holes)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SweepHeadings)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
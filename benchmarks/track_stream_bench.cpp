@@ -0,0 +1,122 @@
+// benchmarks/track_stream_bench.cpp
+#include "bench_common.h"
+
+#include <mylib/track_stream.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using namespace mylib;
+
+namespace {
+
+// Пиковый RSS процесса в МБ (0, если недоступен). Пик общий для всего процесса:
+// для изолированного замера запускайте с --benchmark_filter на один бенчмарк.
+double peak_rss_mb()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0); // байты
+#else
+    return static_cast<double>(usage.ru_maxrss) / 1024.0; // КБ
+#endif
+#else
+    return 0.0;
+#endif
+}
+
+// Бесконечный по памяти источник: челнок с шагом ~1 м, точки генерируются на лету
+class SyntheticTrack final: public IGeoPointSource {
+public:
+    explicit SyntheticTrack(std::size_t n): n_(n) { }
+
+    std::size_t read(span<GeoPoint> out) override
+    {
+        std::size_t k = 0;
+        for (; k < out.size() && i_ < n_; ++k, ++i_) {
+            const std::size_t pass = i_ / 1000;
+            const std::size_t along = pass % 2 == 0 ? i_ % 1000 : 999 - i_ % 1000;
+            out[k] = {bench::kCenter.lat + static_cast<double>(pass % 1000) * 3e-5,
+                      bench::kCenter.lon + static_cast<double>(along) * 1e-5, std::nullopt};
+        }
+        return k;
+    }
+
+private:
+    std::size_t n_;
+    std::size_t i_{0};
+};
+
+void BM_TrackPipeline_Pull(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const GeoToXYEquirectangular proj;
+    for (auto _: state) {
+        SyntheticTrack source(n);
+        TrackPipeline pipeline(proj, bench::kCenter);
+        pipeline.run(source);
+        benchmark::DoNotOptimize(pipeline.finish());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    state.counters["peak_rss_mb"] = peak_rss_mb();
+}
+
+// Базовая линия: весь трек в памяти, затем проекция и длины
+void BM_TrackMaterialized(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const GeoToXYEquirectangular proj;
+    for (auto _: state) {
+        SyntheticTrack source(n);
+        std::vector<GeoPoint> geo(n);
+        benchmark::DoNotOptimize(source.read(geo));
+        std::vector<Point> xy(n);
+        proj.geo_to_xy_batch(bench::kCenter, geo, xy);
+        benchmark::DoNotOptimize(polyline_lengths(xy).back());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    state.counters["peak_rss_mb"] = peak_rss_mb();
+}
+
+// Полный конвейер parse -> project -> filter -> accumulate из CSV-текста
+void BM_TrackPipeline_Csv(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    std::string text;
+    {
+        std::ostringstream out;
+        out.precision(10);
+        for (const GeoPoint& p: bench::make_geo_track(n)) {
+            out << p.lat << ',' << p.lon << '\n';
+        }
+        text = out.str();
+    }
+    const GeoToXYEquirectangular proj;
+    TrackPipelineConfig config;
+    config.min_step = 0.05;
+    for (auto _: state) {
+        std::istringstream in(text);
+        CsvGeoPointSource source(in);
+        TrackPipeline pipeline(proj, bench::kCenter, config);
+        pipeline.run(source);
+        benchmark::DoNotOptimize(pipeline.finish());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_TrackPipeline_Pull)->Arg(1000000)->Arg(10000000)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TrackMaterialized)->Arg(1000000)->Arg(10000000)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TrackPipeline_Csv)->Arg(1000000)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -69,7 +69,7 @@ int main(int, char*[])
     Point xy = eq.geo_to_xy(center, p);
     std::cout  << "EQ Point: (" << xy.x << ", " << xy.y << ")" << std::endl;
 
-    // AEQD/UTM при наличии PROJ:
+    // AEQD/UTM: встроенная реализация на WGS84
     try {
         GeoToXYAeqd aeqd;
         auto xy2 = aeqd.geo_to_xy(center, p);
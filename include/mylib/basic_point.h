@@ -0,0 +1,462 @@
+// include/mylib/basic_point.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/span.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mylib {
+
+/// Точка с координатами типа T (float или double) размерности D (2 или 3).
+/// Point — это BasicPoint<double, 2>. Точки на float вдвое экономят память и полосу пропускания
+/// на длинных треках; они рассчитаны на локальные координаты (метры от центра поля):
+/// в 100 км от начала координат шаг float — около 8 мм.
+template <class T, std::size_t D>
+struct BasicPoint;
+
+template <class T>
+struct BasicPoint<T, 2> {
+    static_assert(std::is_floating_point_v<T>, "BasicPoint: тип координат — float или double");
+    using value_type = T;
+    static constexpr std::size_t dimension = 2;
+
+    T x{0};
+    T y{0};
+    constexpr BasicPoint() = default;
+    constexpr BasicPoint(T x_, T y_): x(x_), y(y_) { }
+    bool operator==(const BasicPoint& other) const noexcept { return x == other.x && y == other.y; }
+};
+
+template <class T>
+struct BasicPoint<T, 3> {
+    static_assert(std::is_floating_point_v<T>, "BasicPoint: тип координат — float или double");
+    using value_type = T;
+    static constexpr std::size_t dimension = 3;
+
+    T x{0};
+    T y{0};
+    T z{0};
+    constexpr BasicPoint() = default;
+    constexpr BasicPoint(T x_, T y_, T z_): x(x_), y(y_), z(z_) { }
+    bool operator==(const BasicPoint& other) const noexcept { return x == other.x && y == other.y && z == other.z; }
+};
+
+using Point2f = BasicPoint<float, 2>;
+using Point2d = BasicPoint<double, 2>;
+using Point3f = BasicPoint<float, 3>;
+using Point3d = BasicPoint<double, 3>;
+
+/// Точка плоскости в метрах
+using Point = Point2d;
+
+// ---- Обобщённые функции. Для Point выбираются нешаблонные перегрузки из geometry.h ----
+
+/// Евклидово расстояние в типе координат
+template <class T, std::size_t D>
+T dist(const BasicPoint<T, D>& a, const BasicPoint<T, D>& b) noexcept
+{
+    if constexpr (D == 2) {
+        return std::hypot(b.x - a.x, b.y - a.y);
+    } else {
+        return std::hypot(b.x - a.x, b.y - a.y, b.z - a.z);
+    }
+}
+
+/// Скалярное произведение векторов, заданных точками
+template <class T, std::size_t D>
+T dot(const BasicPoint<T, D>& a, const BasicPoint<T, D>& b) noexcept
+{
+    if constexpr (D == 2) {
+        return a.x * b.x + a.y * b.y;
+    } else {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+}
+
+/// Накопленная длина вдоль ломаной в буфер вызывающего: out.size() == max(pts.size(), 1).
+/// Сегменты считаются в T, сумма накапливается в double: на float-треке ошибка не растёт с длиной.
+template <class T, std::size_t D>
+void polyline_lengths(span<const BasicPoint<T, D>> pts, span<T> out)
+{
+    if (out.size() != std::max<std::size_t>(pts.size(), 1)) {
+        throw std::invalid_argument("polyline_lengths: размер выходного буфера должен быть max(n, 1)");
+    }
+    out[0] = T(0);
+    double s = 0.0;
+    for (std::size_t i = 1; i < pts.size(); ++i) {
+        s += static_cast<double>(dist(pts[i - 1], pts[i]));
+        out[i] = static_cast<T>(s);
+    }
+}
+
+template <class T, std::size_t D>
+std::vector<T> polyline_lengths(const std::vector<BasicPoint<T, D>>& pts)
+{
+    std::vector<T> s(pts.empty() ? 1 : pts.size());
+    polyline_lengths(span<const BasicPoint<T, D>>(pts), span<T>(s));
+    return s;
+}
+
+/// Точка на расстоянии distance от начала пути; один проход без промежуточного массива длин.
+/// std::invalid_argument — пустой путь, отрицательная дистанция или дистанция больше длины пути.
+template <class T, std::size_t D>
+BasicPoint<T, D> point_on_path(span<const BasicPoint<T, D>> pts, double distance)
+{
+    if (pts.empty()) {
+        throw std::invalid_argument("Список точек пуст");
+    }
+    if (distance < 0.0) {
+        throw std::invalid_argument("Дистанция не может быть отрицательной");
+    }
+
+    const double d = distance;
+    double s = 0.0;
+    for (std::size_t i = 1; i < pts.size(); ++i) {
+        const BasicPoint<T, D>& a = pts[i - 1];
+        const BasicPoint<T, D>& b = pts[i];
+        const auto seg = static_cast<double>(dist(a, b));
+        if (seg > 0.0 && s + seg >= d) {
+            if (d >= s + seg) return b;
+            const double t = (d - s) / seg;
+            const auto lerp = [t](double u, double v) { return static_cast<T>(u + t * (v - u)); };
+            if constexpr (D == 2) {
+                return {lerp(a.x, b.x), lerp(a.y, b.y)};
+            } else {
+                return {lerp(a.x, b.x), lerp(a.y, b.y), lerp(a.z, b.z)};
+            }
+        }
+        s += seg;
+    }
+    if (d > s) {
+        throw std::invalid_argument("Дистанция больше длины траектории");
+    }
+    return pts.back();
+}
+
+template <class T, std::size_t D>
+BasicPoint<T, D> point_on_path(const std::vector<BasicPoint<T, D>>& pts, double distance)
+{
+    return point_on_path(span<const BasicPoint<T, D>>(pts), distance);
+}
+
+// ==== Полигоны ====
+
+/// Ограничивающий прямоугольник; по умолчанию пустой (min > max).
+struct MYLIB_EXPORT BBox {
+    double min_x{std::numeric_limits<double>::infinity()};
+    double min_y{std::numeric_limits<double>::infinity()};
+    double max_x{-std::numeric_limits<double>::infinity()};
+    double max_y{-std::numeric_limits<double>::infinity()};
+
+    [[nodiscard]] bool empty() const noexcept { return min_x > max_x || min_y > max_y; }
+
+    void expand(const Point& p) noexcept
+    {
+        min_x = std::min(min_x, p.x);
+        min_y = std::min(min_y, p.y);
+        max_x = std::max(max_x, p.x);
+        max_y = std::max(max_y, p.y);
+    }
+
+    void expand(const BBox& b) noexcept
+    {
+        min_x = std::min(min_x, b.min_x);
+        min_y = std::min(min_y, b.min_y);
+        max_x = std::max(max_x, b.max_x);
+        max_y = std::max(max_y, b.max_y);
+    }
+
+    // Границы включаются
+    [[nodiscard]] bool contains(const Point& p) const noexcept
+    {
+        return p.x >= min_x && p.x <= max_x && p.y >= min_y && p.y <= max_y;
+    }
+
+    [[nodiscard]] bool intersects(const BBox& b) const noexcept
+    {
+        return min_x <= b.max_x && b.min_x <= max_x && min_y <= b.max_y && b.min_y <= max_y;
+    }
+};
+
+/// Метрики полигона: то, что Polygon кэширует, и результат пакетного расчёта polygon_metrics
+struct MYLIB_EXPORT PolygonMetrics {
+    BBox bbox;               // внешнего контура
+    double signed_area{0.0}; // со знаком ориентации внешнего контура, за вычетом дыр
+    Point centroid;
+    double perimeter{0.0}; // всех колец
+
+    [[nodiscard]] double area() const noexcept { return std::abs(signed_area); }
+};
+
+// Кольцевые метрики, общие для Polygon, PolygonSet, polygon_metrics и BasicPolygon. Координаты берутся
+// относительно первой вершины кольца и переводятся в double, так что BasicPolygon<double> и Polygon
+// дают побитно одинаковые результаты.
+namespace detail {
+
+struct RingMetrics {
+    double signed_area{0.0};
+    Point centroid; // при нулевой площади совпадает с mean
+    Point mean;     // среднее вершин
+    double perimeter{0.0};
+};
+
+/// Удвоенная ориентированная площадь кольца; для менее чем трёх вершин — 0.
+/// Сумма Ноймайера по kLanes независимым дорожкам без ветвлений: компилятор разворачивает
+/// внутренний цикл по дорожкам в векторные операции, т. к. порядок сложений в каждой дорожке фиксирован.
+template <class T>
+double ring_twice_area(span<const BasicPoint<T, 2>> ring) noexcept
+{
+    constexpr std::size_t kLanes = 4;
+    const std::size_t n = ring.size();
+    if (n < 3) return 0.0;
+    const double ox = ring[0].x, oy = ring[0].y;
+    const auto term_at = [&](std::size_t i) {
+        const double ax = static_cast<double>(ring[i].x) - ox, ay = static_cast<double>(ring[i].y) - oy;
+        const double bx = static_cast<double>(ring[i + 1].x) - ox, by = static_cast<double>(ring[i + 1].y) - oy;
+        return ax * by - bx * ay;
+    };
+
+    double sum[kLanes] = {};
+    double comp[kLanes] = {};
+    // Замыкающее ребро (n-1, 0) в локальных координатах равно нулю: вершина 0 — начало координат
+    const std::size_t edges = n - 1;
+    std::size_t i = 0;
+    for (; i + kLanes <= edges; i += kLanes) {
+        for (std::size_t l = 0; l < kLanes; ++l) {
+            const double term = term_at(i + l);
+            const double t = sum[l] + term;
+            comp[l] += std::abs(sum[l]) >= std::abs(term) ? (sum[l] - t) + term : (term - t) + sum[l];
+            sum[l] = t;
+        }
+    }
+    for (; i < edges; ++i) {
+        const double term = term_at(i);
+        const double t = sum[0] + term;
+        comp[0] += std::abs(sum[0]) >= std::abs(term) ? (sum[0] - t) + term : (term - t) + sum[0];
+        sum[0] = t;
+    }
+
+    double s = 0.0;
+    double c = 0.0;
+    for (std::size_t l = 0; l < kLanes; ++l) {
+        const double t = s + sum[l];
+        c += std::abs(s) >= std::abs(sum[l]) ? (s - t) + sum[l] : (sum[l] - t) + s;
+        s = t;
+        c += comp[l];
+    }
+    return s + c;
+}
+
+/// Площадь, центроид, среднее вершин и периметр замкнутого кольца за один проход
+template <class T>
+RingMetrics ring_metrics(span<const BasicPoint<T, 2>> ring) noexcept
+{
+    RingMetrics r;
+    const std::size_t n = ring.size();
+    if (n == 0) return r;
+
+    const double ox = ring[0].x, oy = ring[0].y;
+    double cx = 0.0; // сумма (xi + xj) * cross в локальных координатах
+    double cy = 0.0;
+    double mx = 0.0;
+    double my = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const BasicPoint<T, 2>& a = ring[i];
+        const BasicPoint<T, 2>& b = ring[i + 1 < n ? i + 1 : 0];
+        r.perimeter += n > 1 ? static_cast<double>(dist(a, b)) : 0.0;
+
+        const double ax = static_cast<double>(a.x) - ox, ay = static_cast<double>(a.y) - oy;
+        const double bx = static_cast<double>(b.x) - ox, by = static_cast<double>(b.y) - oy;
+        const double cross = ax * by - bx * ay;
+        cx += (ax + bx) * cross;
+        cy += (ay + by) * cross;
+        mx += ax;
+        my += ay;
+    }
+    const auto cnt = static_cast<double>(n);
+    r.mean = Point{ox + mx / cnt, oy + my / cnt};
+    r.signed_area = 0.5 * ring_twice_area(ring);
+    if (r.signed_area != 0.0) {
+        const double k = 1.0 / (6.0 * r.signed_area);
+        r.centroid = Point{ox + cx * k, oy + cy * k};
+    } else {
+        r.centroid = r.mean;
+    }
+    return r;
+}
+
+/// Нечётное число пересечений луча из p вправо с рёбрами кольца
+template <class T>
+bool ring_crossings_odd(span<const BasicPoint<T, 2>> ring, const BasicPoint<T, 2>& p) noexcept
+{
+    const std::size_t n = ring.size();
+    const double px = p.x, py = p.y;
+    bool odd = false;
+    for (std::size_t i = 0, j = n - 1; i < n; j = i++) {
+        const double ax = ring[i].x, ay = ring[i].y;
+        const double bx = ring[j].x, by = ring[j].y;
+        // Ребро пересекает горизонталь через p (полуоткрытый интервал по y)
+        if ((ay > py) != (by > py)) {
+            const double x = ax + (py - ay) * (bx - ax) / (by - ay);
+            if (px < x) {
+                odd = !odd;
+            }
+        }
+    }
+    return odd;
+}
+
+/// Метрики полигона из rings колец: ring(0) — внешний контур, ring(1..rings-1) — дыры.
+/// Общая часть Polygon::metrics, PolygonSet, пакетного polygon_metrics и BasicPolygon: результаты совпадают побитно.
+template <typename RingAt>
+PolygonMetrics compute_polygon_metrics(std::size_t rings, RingAt&& ring) noexcept
+{
+    PolygonMetrics m;
+    if (rings == 0) return m;
+    const auto outer_ring = ring(std::size_t{0});
+    if (outer_ring.empty()) return m;
+
+    for (const auto& p: outer_ring) {
+        m.bbox.expand(Point{static_cast<double>(p.x), static_cast<double>(p.y)});
+    }
+
+    // Дыры вычитаются по модулю площади независимо от ориентации колец
+    const RingMetrics outer = ring_metrics(outer_ring);
+    double net = std::abs(outer.signed_area);
+    double mx = net * outer.centroid.x;
+    double my = net * outer.centroid.y;
+    m.perimeter = outer.perimeter;
+    for (std::size_t r = 1; r < rings; ++r) {
+        const RingMetrics h = ring_metrics(ring(r));
+        const double a = std::abs(h.signed_area);
+        net -= a;
+        mx -= a * h.centroid.x;
+        my -= a * h.centroid.y;
+        m.perimeter += h.perimeter;
+    }
+
+    m.signed_area = outer.signed_area < 0.0 ? -net : net;
+    if (net != 0.0) {
+        m.centroid = Point{mx / net, my / net};
+    } else {
+        m.centroid = outer.mean;
+    }
+    return m;
+}
+
+/// Только площадь со знаком — то же, что compute_polygon_metrics(...).signed_area, без периметра и центроида
+template <typename RingAt>
+double compute_polygon_signed_area(std::size_t rings, RingAt&& ring) noexcept
+{
+    if (rings == 0) return 0.0;
+    const double outer = 0.5 * ring_twice_area(ring(std::size_t{0}));
+    double net = std::abs(outer);
+    for (std::size_t r = 1; r < rings; ++r) {
+        net -= std::abs(0.5 * ring_twice_area(ring(r)));
+    }
+    return outer < 0.0 ? -net : net;
+}
+
+/// Точка внутри внешнего контура ring(0) и вне дыр (чёт-нечет); кольца из менее чем трёх вершин не учитываются
+template <typename RingAt, class P>
+bool rings_contain(std::size_t rings, RingAt&& ring, const P& p) noexcept
+{
+    if (rings == 0) return false;
+    const auto outer = ring(std::size_t{0});
+    if (outer.size() < 3) return false;
+    bool inside = ring_crossings_odd(outer, p);
+    for (std::size_t r = 1; r < rings; ++r) {
+        const auto hole = ring(r);
+        if (hole.size() >= 3 && ring_crossings_odd(hole, p)) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+} // namespace detail
+
+/// Компактный полигон на точках BasicPoint<T, 2> для архивов и пакетной обработки: без кэша метрик
+/// и без изменения вершин. Метрики считают те же функции, что и у Polygon, так что
+/// BasicPolygon<double> совпадает с Polygon побитно. Для интерактивной работы с кэшем метрик — Polygon.
+template <class T>
+class BasicPolygon {
+public:
+    using point_type = BasicPoint<T, 2>;
+
+    /// Ориентация колец не важна; дублирующая последняя вершина убирается, как в Polygon
+    explicit BasicPolygon(std::vector<point_type> vertices, std::vector<std::vector<point_type>> holes = {})
+        : vertices_(std::move(vertices))
+        , holes_(std::move(holes))
+    {
+        drop_closing(vertices_);
+        for (auto& h: holes_) {
+            drop_closing(h);
+        }
+    }
+
+    [[nodiscard]] const std::vector<point_type>& vertices() const noexcept { return vertices_; }
+    [[nodiscard]] const std::vector<std::vector<point_type>>& holes() const noexcept { return holes_; }
+
+    /// Все метрики за один проход по кольцам
+    [[nodiscard]] PolygonMetrics metrics() const noexcept
+    {
+        return detail::compute_polygon_metrics(rings(), ring_at());
+    }
+
+    /// Площадь со знаком ориентации внешнего контура за вычетом дыр; без периметра и центроида
+    [[nodiscard]] double signed_area() const noexcept
+    {
+        return detail::compute_polygon_signed_area(rings(), ring_at());
+    }
+
+    [[nodiscard]] double area() const noexcept { return std::abs(signed_area()); }
+
+    /// Длина всех замкнутых контуров
+    [[nodiscard]] double perimeter() const noexcept { return metrics().perimeter; }
+
+    [[nodiscard]] Point centroid() const noexcept { return metrics().centroid; }
+
+    [[nodiscard]] BBox bbox() const noexcept
+    {
+        BBox b;
+        for (const point_type& p: vertices_) {
+            b.expand(Point{static_cast<double>(p.x), static_cast<double>(p.y)});
+        }
+        return b;
+    }
+
+    /// Правило чёт-нечет по всем кольцам, как Polygon::contains
+    [[nodiscard]] bool contains(const point_type& p) const noexcept
+    {
+        return detail::rings_contain(rings(), ring_at(), p);
+    }
+
+private:
+    static void drop_closing(std::vector<point_type>& v) noexcept
+    {
+        if (v.size() >= 2 && v.front() == v.back()) v.pop_back();
+    }
+
+    [[nodiscard]] std::size_t rings() const noexcept { return 1 + holes_.size(); }
+
+    [[nodiscard]] auto ring_at() const noexcept
+    {
+        return [this](std::size_t r) { return span<const point_type>(r == 0 ? vertices_ : holes_[r - 1]); };
+    }
+
+    std::vector<point_type> vertices_;
+    std::vector<std::vector<point_type>> holes_;
+};
+
+using Polygon2f = BasicPolygon<float>;
+
+} // namespace mylib
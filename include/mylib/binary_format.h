@@ -0,0 +1,151 @@
+// include/mylib/binary_format.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/span.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace mylib {
+
+struct FlatPolygons;
+
+// Бинарный формат треков и полей, рассчитанный на чтение через mmap без копирования.
+//
+// Файл: заголовок 64 байта, затем секции, каждая с границы 64 байт. Числа пишутся в порядке байт
+// платформы — иначе чтение через mmap без копирования невозможно. По byte_order читатель отвергает
+// файл, записанный на платформе с другим порядком байт; перекодирования нет.
+//   magic "AGROBIN\0" | byte_order u32 = 0x01020304 | version u16 | kind u16 |
+//   count u64 | aux_count u64 | section[4] u64 (смещения от начала файла)
+//
+//   kind = Points:    section[0] — Point[count] (x, y подряд)
+//   kind = GeoPoints: section[0] — lat double[count], section[1] — lon double[count],
+//                     section[2] — alt double[count] (0 там, где высоты нет),
+//                     section[3] — битовая маска наличия высоты, ceil(count / 8) байт, младший бит — первая точка
+//   kind = Polygons:  count — число полигонов, aux_count — число колец;
+//                     section[0] — u64[count + 1]: кольца полигона i — [s0[i], s0[i + 1]), первое — внешний контур;
+//                     section[1] — u64[aux_count + 1]: вершины кольца r — [s1[r], s1[r + 1]);
+//                     section[2] — Point[s1[aux_count]]
+
+enum class BinaryFileKind : std::uint16_t { Points = 1, GeoPoints = 2, Polygons = 3 };
+
+constexpr std::uint16_t kBinaryFormatVersion = 1;
+
+// Запись; ошибки ввода-вывода — std::runtime_error
+MYLIB_EXPORT void write_points_file(const std::string& path, span<const Point> pts);
+MYLIB_EXPORT void write_geo_points_file(const std::string& path, span<const GeoPoint> pts);
+MYLIB_EXPORT void write_polygons_file(const std::string& path, span<const Polygon> polygons);
+// Плоский набор (например, PolygonSet::flat()) пишется тремя массивами, без копий по полигонам;
+// std::invalid_argument, если таблицы смещений не согласованы
+MYLIB_EXPORT void write_polygons_file(const std::string& path, const FlatPolygons& polygons);
+
+/// Файл, отображённый в память только для чтения
+class MYLIB_EXPORT MappedFile {
+public:
+    /// std::runtime_error, если файл не открывается или не отображается
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    [[nodiscard]] const std::byte* data() const noexcept;
+    [[nodiscard]] std::size_t size() const noexcept;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+// Читатели проверяют заголовок и границы секций при открытии (std::runtime_error при несоответствии)
+// и дальше отдают данные прямо из отображения. Span'ы живут, пока жив объект файла.
+
+class MYLIB_EXPORT PointsFile {
+public:
+    explicit PointsFile(const std::string& path);
+
+    [[nodiscard]] span<const Point> points() const noexcept { return pts_; }
+    [[nodiscard]] std::size_t size() const noexcept { return pts_.size(); }
+
+private:
+    MappedFile file_;
+    span<const Point> pts_;
+};
+
+class MYLIB_EXPORT GeoPointsFile {
+public:
+    explicit GeoPointsFile(const std::string& path);
+
+    [[nodiscard]] std::size_t size() const noexcept { return lat_.size(); }
+
+    /// Столбцы координат — прямо для SoA-функций (equirect_forward_soa и т. п.)
+    [[nodiscard]] span<const double> lat() const noexcept { return lat_; }
+    [[nodiscard]] span<const double> lon() const noexcept { return lon_; }
+
+    [[nodiscard]] bool has_alt(std::size_t i) const noexcept
+    {
+        return ((static_cast<unsigned>(alt_valid_[i / 8]) >> (i % 8)) & 1U) != 0;
+    }
+    [[nodiscard]] std::optional<double> alt(std::size_t i) const noexcept;
+
+    [[nodiscard]] GeoPoint at(std::size_t i) const noexcept { return {lat_[i], lon_[i], alt(i)}; }
+
+    /// Сборка GeoPoint в буфер вызывающего; out.size() == size()
+    void copy_to(span<GeoPoint> out) const;
+
+    [[nodiscard]] std::vector<GeoPoint> to_vector() const;
+
+private:
+    MappedFile file_;
+    span<const double> lat_;
+    span<const double> lon_;
+    span<const double> alt_;
+    span<const std::uint8_t> alt_valid_;
+};
+
+class MYLIB_EXPORT PolygonsFile {
+public:
+    explicit PolygonsFile(const std::string& path);
+
+    [[nodiscard]] std::size_t size() const noexcept { return polygon_rings_.size() - 1; }
+
+    /// Число колец полигона i: внешний контур и дыры
+    [[nodiscard]] std::size_t ring_count(std::size_t i) const noexcept
+    {
+        return static_cast<std::size_t>(polygon_rings_[i + 1] - polygon_rings_[i]);
+    }
+
+    /// Кольцо r полигона i; r == 0 — внешний контур
+    [[nodiscard]] span<const Point> ring(std::size_t i, std::size_t r) const noexcept;
+
+    [[nodiscard]] span<const Point> outer(std::size_t i) const noexcept { return ring(i, 0); }
+
+    /// Все вершины файла подряд
+    [[nodiscard]] span<const Point> vertices() const noexcept { return vertices_; }
+
+    /// Таблицы смещений (CSR): кольцо k — vertices()[ring_offsets()[k], ring_offsets()[k + 1]),
+    /// полигон i — кольца [polygon_rings()[i], polygon_rings()[i + 1])
+    [[nodiscard]] span<const std::uint64_t> ring_offsets() const noexcept { return ring_offsets_; }
+
+    [[nodiscard]] span<const std::uint64_t> polygon_rings() const noexcept { return polygon_rings_; }
+
+    [[nodiscard]] Polygon polygon(std::size_t i) const;
+
+    [[nodiscard]] std::vector<Polygon> to_vector() const;
+
+private:
+    MappedFile file_;
+    span<const std::uint64_t> polygon_rings_;
+    span<const std::uint64_t> ring_offsets_;
+    span<const Point> vertices_;
+};
+
+} // namespace mylib
@@ -0,0 +1,71 @@
+// include/mylib/coverage.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/span.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace mylib {
+
+class PolygonView;
+
+/// Нарастающий учёт обработанной площади поля по телеметрии агрегата.
+///
+/// Поле растеризуется в сетку квадратных ячеек со стороной cell_size; ячейка считается внутри поля
+/// (или под штангой), если внутри её центр. Каждый новый отрезок трека закрашивает прямоугольник
+/// шириной width поперёк хода и веер на стыке с предыдущим отрезком, поэтому повторные проходы
+/// не увеличивают покрытую площадь. Стоимость обновления пропорциональна площади отрезка в ячейках
+/// (закраска идёт словами по 64 ячейки) и не зависит от длины накопленного трека.
+/// Проход — непрерывный участок трека с ненулевой шириной между break_track() и выключениями штанги.
+/// Память — блоки 64x64 ячеек, выделяемые при первом касании; погрешность площади — порядка
+/// периметра, умноженного на cell_size / 2.
+class MYLIB_EXPORT CoverageAccumulator {
+public:
+    /// std::invalid_argument при cell_size <= 0, пустом поле или слишком мелкой для поля сетке
+    explicit CoverageAccumulator(const Polygon& field, double cell_size = 0.25);
+
+    /// Поле из PolygonSet или FlatPolygons; вид нужен только на время конструктора
+    explicit CoverageAccumulator(const PolygonView& field, double cell_size = 0.25);
+    ~CoverageAccumulator();
+    CoverageAccumulator(CoverageAccumulator&&) noexcept;
+    CoverageAccumulator& operator=(CoverageAccumulator&&) noexcept;
+
+    /// Следующая позиция; width — рабочая ширина на участке от предыдущей позиции, м.
+    /// width == 0 — агрегат выключен: участок не закрашивается, веер на следующем стыке не строится.
+    /// Позиция с нечисловой координатой (пропуск решения GNSS) не закрашивает ничего и разрывает проход,
+    /// как break_track(). std::invalid_argument при отрицательной или нечисловой ширине.
+    void add(const Point& p, double width);
+
+    void add(span<const Point> pts, double width);
+
+    /// Разрыв трека: следующая позиция начинает новый участок
+    void break_track() noexcept;
+
+    /// Площадь поля, покрытая хотя бы раз, м^2
+    [[nodiscard]] double covered_area() const noexcept;
+
+    /// Суммарная обработанная площадь с учётом перекрытий между проходами, м^2: ячейка считается
+    /// не больше одного раза за проход, так что стыки отрезков и дрожание GNSS внутри прохода
+    /// перекрытием не считаются. Разница с covered_area — перекрытие проходов
+    [[nodiscard]] double applied_area() const noexcept;
+
+    /// Площадь поля в растре, м^2 (все ячейки с центром внутри поля)
+    [[nodiscard]] double field_area() const noexcept;
+
+    /// covered_area / field_area
+    [[nodiscard]] double coverage_ratio() const noexcept;
+
+    [[nodiscard]] double cell_size() const noexcept;
+
+    /// Сброс покрытия; растр поля сохраняется
+    void reset() noexcept;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace mylib
@@ -0,0 +1,108 @@
+// include/mylib/geo_reader.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/span.h>
+#include <mylib/track_stream.h>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mylib {
+
+// Чтение CSV и GeoJSON прямо из буфера памяти: разбор на месте, числа — std::from_chars,
+// промежуточных строк и DOM нет. Для файлов — отображение в память (MappedFile), поэтому
+// размер входа ограничен только адресным пространством.
+
+// ==== CSV "lat,lon[,alt]" ====
+
+struct MYLIB_EXPORT CsvReadOptions {
+    bool has_header{false}; // первая значимая строка — заголовок
+};
+
+/// Точки из текста; out очищается, ёмкость сохраняется. Ошибка разбора — std::runtime_error с номером строки.
+MYLIB_EXPORT void read_csv(std::string_view text, std::vector<GeoPoint>& out, const CsvReadOptions& options = {});
+
+[[nodiscard]] MYLIB_EXPORT std::vector<GeoPoint> read_csv(std::string_view text, const CsvReadOptions& options = {});
+
+MYLIB_EXPORT void read_csv_file(const std::string& path, std::vector<GeoPoint>& out,
+                                const CsvReadOptions& options = {});
+
+/// Источник для TrackPipeline поверх буфера (например, отображённого файла): точки выдаются
+/// порциями без копирования текста, куча не растёт с размером входа. Буфер должен жить дольше источника.
+class MYLIB_EXPORT CsvBufferSource final: public IGeoPointSource {
+public:
+    explicit CsvBufferSource(std::string_view text, const CsvReadOptions& options = {});
+
+    std::size_t read(span<GeoPoint> out) override;
+
+private:
+    std::string_view text_;
+    std::size_t pos_{0};
+    std::size_t line_{0};
+    bool skip_header_;
+};
+
+// ==== GeoJSON ====
+
+/// Геометрии GeoJSON в плоском виде (CSR), как в бинарном формате: точки подряд, кольца, полигоны
+/// и линии — диапазоны индексов. Координаты GeoJSON [lon, lat(, alt)] переводятся в GeoPoint.
+/// Кольца хранятся как в файле, обычно с замыкающей точкой.
+struct MYLIB_EXPORT GeoJsonGeometries {
+    // Полигоны
+    std::vector<GeoPoint> points;
+    std::vector<std::size_t> ring_offsets{0};  // кольцо r — points[ring_offsets[r], ring_offsets[r + 1])
+    std::vector<std::size_t> polygon_rings{0}; // полигон i — кольца [polygon_rings[i], polygon_rings[i + 1])
+
+    // Линии
+    std::vector<GeoPoint> line_points;
+    std::vector<std::size_t> line_offsets{0}; // линия i — line_points[line_offsets[i], line_offsets[i + 1])
+
+    [[nodiscard]] std::size_t polygon_count() const noexcept { return polygon_rings.size() - 1; }
+
+    [[nodiscard]] std::size_t ring_count(std::size_t polygon) const noexcept
+    {
+        return polygon_rings[polygon + 1] - polygon_rings[polygon];
+    }
+
+    /// Кольцо r полигона; r == 0 — внешний контур
+    [[nodiscard]] span<const GeoPoint> ring(std::size_t polygon, std::size_t r) const noexcept
+    {
+        const std::size_t k = polygon_rings[polygon] + r;
+        return {points.data() + ring_offsets[k], ring_offsets[k + 1] - ring_offsets[k]};
+    }
+
+    [[nodiscard]] std::size_t line_count() const noexcept { return line_offsets.size() - 1; }
+
+    [[nodiscard]] span<const GeoPoint> line(std::size_t i) const noexcept
+    {
+        return {line_points.data() + line_offsets[i], line_offsets[i + 1] - line_offsets[i]};
+    }
+
+    /// Очистка с сохранением ёмкости
+    void clear() noexcept;
+};
+
+/// Polygon, MultiPolygon, LineString и MultiLineString из документа любой вложенности: голая геометрия,
+/// Feature, FeatureCollection, GeometryCollection. Прочие геометрии пропускаются.
+/// out очищается; ошибка синтаксиса — std::runtime_error со смещением в тексте.
+MYLIB_EXPORT void read_geojson(std::string_view text, GeoJsonGeometries& out);
+
+/// Порционное чтение для очень больших документов: как только накоплено не меньше batch_points точек,
+/// on_batch получает готовые геометрии, после чего буфер очищается. Геометрия порциями не делится.
+MYLIB_EXPORT void read_geojson(std::string_view text, const std::function<void(const GeoJsonGeometries&)>& on_batch,
+                               std::size_t batch_points = std::size_t{1} << 20);
+
+MYLIB_EXPORT void read_geojson_file(const std::string& path,
+                                    const std::function<void(const GeoJsonGeometries&)>& on_batch,
+                                    std::size_t batch_points = std::size_t{1} << 20);
+
+/// Полигон i в метрических координатах выбранной проекции (кольца проецируются пакетно)
+[[nodiscard]] MYLIB_EXPORT Polygon to_polygon(const GeoJsonGeometries& geometries, std::size_t polygon,
+                                              const IGeoPointToXY& projection, const GeoPoint& center);
+
+} // namespace mylib
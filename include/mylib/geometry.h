@@ -1,9 +1,19 @@
 // include/mylib/geometry.h
 #pragma once
 
+#include <mylib/basic_point.h>
 #include <mylib/export.h>
+#include <mylib/span.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 namespace mylib {
@@ -21,14 +31,6 @@ inline double rad2deg(double rad) noexcept
     return rad * (180.0 / kPI);
 }
 
-struct MYLIB_EXPORT Point {
-    double x{0.0};
-    double y{0.0};
-    constexpr Point() = default;
-    constexpr Point(double x_, double y_): x(x_), y(y_) { }
-    bool operator==(const Point& other) const noexcept { return x == other.x && y == other.y; }
-};
-
 struct MYLIB_EXPORT BoundPoints {
     Point start;
     Point end;
@@ -48,18 +50,230 @@ MYLIB_EXPORT double dot(double ax, double ay, double bx, double by);
 /// Накопленная длина вдоль ломаной: s[i] — расстояние от начала до pts[i].
 MYLIB_EXPORT std::vector<double> polyline_lengths(const std::vector<Point>& pts);
 
+/// То же в буфер вызывающего, без выделения памяти: out.size() == max(pts.size(), 1).
+MYLIB_EXPORT void polyline_lengths(span<const Point> pts, span<double> out);
+
+/// SoA-вариант: координаты в раздельных массивах одинаковой длины, out.size() == max(xs.size(), 1).
+/// Длины сегментов считает векторизованное ядро segment_lengths_soa (sqrt(dx*dx + dy*dy));
+/// от std::hypot результат может отличаться в последнем знаке.
+MYLIB_EXPORT void polyline_lengths(span<const double> xs, span<const double> ys, span<double> out);
+
 MYLIB_EXPORT Point point_on_path(const std::vector<Point>& pts, double distance);
 
+/// Способ суммирования формулы шнурования
+enum class AreaSummation {
+    LongDouble,  // накопление в long double (прежняя реализация)
+    Compensated, // double с компенсацией Ноймайера по независимым дорожкам; векторизуется
+};
+
+/// Ориентированная площадь кольца (> 0 при обходе против часовой стрелки); кольцо считается замкнутым.
+/// Координаты берутся относительно первой вершины, что снимает потерю точности на больших
+/// абсолютных значениях (UTM, AEQD вдали от центра). Для менее чем трёх вершин — 0.
+MYLIB_EXPORT double ring_signed_area(span<const Point> ring, AreaSummation method = AreaSummation::Compensated);
+
+/// Полигон (внешний контур и, возможно, дыры) с лениво вычисляемыми и кэшируемыми метриками:
+/// bbox, площадь, центроид, периметр. Все метрики считаются за один проход при первом обращении;
+/// любое изменение вершин или дыр сбрасывает кэш.
+/// Константные методы безопасно вызывать из нескольких потоков одновременно.
 class MYLIB_EXPORT Polygon {
 public:
     explicit Polygon(std::vector<Point> vertices);
 
+    /// Полигон с дырами; ориентация колец не важна, дыры не должны пересекать внешний контур
+    Polygon(std::vector<Point> vertices, std::vector<std::vector<Point>> holes);
+
+    Polygon(const Polygon& other);
+    Polygon(Polygon&& other) noexcept;
+    Polygon& operator=(const Polygon& other);
+    Polygon& operator=(Polygon&& other) noexcept;
+    ~Polygon() = default;
+
+    /// Вершины внешнего контура
     [[nodiscard]] const std::vector<Point>& vertices() const noexcept { return vertices_; }
 
-    [[nodiscard]] double area() const noexcept;
+    [[nodiscard]] const std::vector<std::vector<Point>>& holes() const noexcept { return holes_; }
+
+    // ---- Изменение вершин; индексы вне диапазона — std::out_of_range ----
+
+    /// Замена всех вершин; дублирующая последняя вершина убирается, как в конструкторе
+    void set_vertices(std::vector<Point> vertices);
+
+    void set_vertex(std::size_t i, const Point& p);
+
+    /// Вставка перед вершиной i; i == vertices().size() — в конец
+    void insert_vertex(std::size_t i, const Point& p);
+
+    void erase_vertex(std::size_t i);
+
+    /// Замена всех дыр; у каждой дублирующая последняя вершина убирается
+    void set_holes(std::vector<std::vector<Point>> holes);
+
+    void add_hole(std::vector<Point> hole);
+
+    // ---- Метрики (кэшируются) ----
+
+    /// Площадь внешнего контура за вычетом площадей дыр
+    [[nodiscard]] double area() const noexcept { return std::abs(metrics().signed_area); }
+
+    /// Площадь со знаком ориентации внешнего контура: > 0 при обходе против часовой стрелки
+    [[nodiscard]] double signed_area() const noexcept { return metrics().signed_area; }
+
+    /// Центр масс области с учётом дыр; для вырожденного полигона (нулевая площадь) — среднее
+    /// вершин внешнего контура, для пустого — (0, 0)
+    [[nodiscard]] Point centroid() const noexcept { return metrics().centroid; }
+
+    /// Длина всех замкнутых контуров (внешнего и дыр), включая рёбра от последней вершины к первой
+    [[nodiscard]] double perimeter() const noexcept { return metrics().perimeter; }
+
+    /// BBox внешнего контура; пустой для полигона без вершин
+    [[nodiscard]] BBox bbox() const noexcept { return metrics().bbox; }
+
+    /// Точка внутри полигона и вне дыр (правило чёт-нечет по всем кольцам).
+    /// Точки ровно на границе могут попасть в любую сторону.
+    [[nodiscard]] bool contains(const Point& p) const noexcept;
 
 private:
+    using Metrics = PolygonMetrics;
+
+    enum : std::uint8_t { kStale = 0, kComputing = 1, kReady = 2 };
+
+    [[nodiscard]] Metrics metrics() const noexcept;
+    void invalidate() noexcept { state_.store(kStale, std::memory_order_relaxed); }
+    void copy_cache_from(const Polygon& other) noexcept;
+
     std::vector<Point> vertices_;
+    std::vector<std::vector<Point>> holes_;
+    // Кэш публикует тот поток, что первым перевёл state_ из kStale в kComputing;
+    // остальные до публикации считают метрики сами и не ждут
+    mutable Metrics metrics_;
+    mutable std::atomic<std::uint8_t> state_{kStale};
+};
+
+// ==== Кэшируемые проекции AEQD и UTM ====
+
+enum class ProjectionKind { Aeqd, Utm };
+
+// Чем считается проекция: встроенной реализацией на WGS84 (projection.h) или конвейером PROJ.
+// Proj требует сборки с MYLIB_WITH_PROJ и нужен в основном для сверки со встроенной реализацией.
+enum class ProjectorBackend { Native, Proj };
+
+// Ключ проекции: для AEQD — центр проекции, для UTM — зона и полушарие.
+struct MYLIB_EXPORT ProjectorKey {
+    ProjectionKind kind{ProjectionKind::Aeqd};
+    double lat0{0.0};
+    double lon0{0.0};
+    int zone{0};
+    bool north{true};
+    ProjectorBackend backend{ProjectorBackend::Native};
+
+    // std::invalid_argument для нечисловых координат центра
+    static ProjectorKey aeqd(const GeoPoint& center, ProjectorBackend backend = ProjectorBackend::Native);
+    static ProjectorKey utm(int zone, bool north, ProjectorBackend backend = ProjectorBackend::Native) noexcept;
+
+    bool operator==(const ProjectorKey& other) const noexcept
+    {
+        return kind == other.kind && lat0 == other.lat0 && lon0 == other.lon0 && zone == other.zone &&
+               north == other.north && backend == other.backend;
+    }
+};
+
+// Проекция WGS84 lon/lat -> метры, построенная один раз по ключу.
+// Встроенная реализация не имеет состояния и вызывается из любых потоков. Для PROJ один экземпляр тоже
+// вызывается из разных потоков без блокировок: контекст PROJ не разделяется между потоками, поэтому каждый
+// вызывающий поток при первом обращении получает свой контекст и копию конвейера в локальной памяти потока.
+// Они освобождаются при завершении потока или при его первом обращении к новой проекции после разрушения этой.
+class MYLIB_EXPORT GeoProjector {
+public:
+    // Для ProjectorBackend::Proj требует сборки с MYLIB_WITH_PROJ, иначе бросает исключение.
+    // std::invalid_argument для AEQD с нечисловым центром.
+    explicit GeoProjector(const ProjectorKey& key);
+    ~GeoProjector();
+
+    GeoProjector(GeoProjector&&) noexcept;
+    GeoProjector& operator=(GeoProjector&&) noexcept;
+    GeoProjector(const GeoProjector&) = delete;
+    GeoProjector& operator=(const GeoProjector&) = delete;
+
+    [[nodiscard]] const ProjectorKey& key() const noexcept;
+
+    // Строка proj4 проекции: по ней строится конвейер PROJ; для встроенной реализации — её эквивалент в PROJ
+    [[nodiscard]] std::string definition() const;
+
+    [[nodiscard]] Point forward(const GeoPoint& geo_point) const;
+
+    // Пакетное прямое преобразование (для PROJ — одним вызовом proj_trans_generic);
+    // размеры in и out должны совпадать.
+    void forward(span<const GeoPoint> in, span<Point> out) const;
+
+    // Обратное преобразование той же проекцией; alt результата — std::nullopt.
+    [[nodiscard]] GeoPoint inverse(const Point& xy) const;
+
+    void inverse(span<const Point> in, span<GeoPoint> out) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+struct MYLIB_EXPORT ProjectorCacheStats {
+    std::uint64_t hits{0};
+    std::uint64_t misses{0};
+    std::size_t size{0};
+};
+
+// Потокобезопасный кэш проекций по ключу. При переполнении вытесняется самый старый.
+class MYLIB_EXPORT ProjectorCache {
+public:
+    static constexpr std::size_t kDefaultCapacity = 256;
+
+    explicit ProjectorCache(std::size_t capacity = kDefaultCapacity);
+    ~ProjectorCache();
+
+    ProjectorCache(const ProjectorCache&) = delete;
+    ProjectorCache& operator=(const ProjectorCache&) = delete;
+
+    [[nodiscard]] std::shared_ptr<const GeoProjector> get(const ProjectorKey& key);
+
+    [[nodiscard]] ProjectorCacheStats stats() const;
+
+    void clear();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+// Общий на процесс реестр проекций по ключу (вид проекции и центр/зона) для рабочих потоков.
+// Чтение без блокировок: таблица ключей публикуется атомарным указателем и дополняется на месте, читатель
+// отмечается только в счётчике своего потока. Промах идёт под мьютекс, так что проекция строится один раз
+// на процесс, а не на поток.
+// Память ограничена: таблица вмещает не больше capacity ключей, промах в заполненной таблице и clear()
+// начинают новую. Снятая таблица освобождается, когда в ней не осталось читателей; проекция живёт,
+// пока на неё есть shared_ptr, выданный get.
+class MYLIB_EXPORT ProjectorRegistry {
+public:
+    // Реестр процесса
+    static ProjectorRegistry& global();
+
+    // capacity — наибольшее число ключей в поколении
+    explicit ProjectorRegistry(std::size_t capacity = ProjectorCache::kDefaultCapacity);
+    ~ProjectorRegistry();
+
+    ProjectorRegistry(const ProjectorRegistry&) = delete;
+    ProjectorRegistry& operator=(const ProjectorRegistry&) = delete;
+
+    [[nodiscard]] std::shared_ptr<const GeoProjector> get(const ProjectorKey& key) const;
+
+    // Попадания считаются в полосах счётчика по потокам (relaxed), промахи — под мьютексом;
+    // size — число ключей текущей таблицы
+    [[nodiscard]] ProjectorCacheStats stats() const;
+
+    // Новая пустая таблица: следующие get строят проекции заново; выданные до clear() остаются рабочими
+    void clear();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
 };
 
 // ==== Общий интерфейс ====
@@ -69,6 +283,18 @@ public:
 
     // Преобразование: (центр-проекции, геоточка) -> метрические XY
     [[nodiscard]] virtual Point geo_to_xy(const GeoPoint& center, const GeoPoint& geo_point) const = 0;
+
+    // Пакетное преобразование: out[i] = geo_to_xy(center, in[i]); размеры in и out должны совпадать.
+    // Базовая реализация вызывает geo_to_xy для каждой точки.
+    virtual void geo_to_xy_batch(const GeoPoint& center, span<const GeoPoint> in, span<Point> out) const;
+
+    // Обратное преобразование: (центр-проекции, метрические XY) -> геоточка; alt результата — std::nullopt.
+    // Не чисто виртуальная, чтобы внешние реализации, написанные до её появления, собирались без изменений:
+    // базовая реализация бросает std::logic_error.
+    [[nodiscard]] virtual GeoPoint xy_to_geo(const GeoPoint& center, const Point& xy) const;
+
+    // Пакетное обратное преобразование; базовая реализация вызывает xy_to_geo для каждой точки.
+    virtual void xy_to_geo_batch(const GeoPoint& center, span<const Point> in, span<GeoPoint> out) const;
 };
 
 // ==== Реализации ====
@@ -78,20 +304,55 @@ public:
     // Радиус сферы (WGS84 экваториальный радиус, как в Python)
     static constexpr double R = 6378137.0;
     [[nodiscard]] Point geo_to_xy(const GeoPoint& center, const GeoPoint& geo_point) const override;
+    // cos(lat0) и перевод центра в радианы вычисляются один раз на пакет
+    void geo_to_xy_batch(const GeoPoint& center, span<const GeoPoint> in, span<Point> out) const override;
+    [[nodiscard]] GeoPoint xy_to_geo(const GeoPoint& center, const Point& xy) const override;
+    void xy_to_geo_batch(const GeoPoint& center, span<const Point> in, span<GeoPoint> out) const override;
 };
 
+// AEQD и UTM считаются встроенной реализацией на WGS84 (projection.h): проекция строится на месте при каждом
+// вызове, без кэша и блокировок. Для вызова без виртуальной диспетчеризации — TransverseMercator
+// и AzimuthalEquidistant напрямую.
 class MYLIB_EXPORT GeoToXYAeqd final: public IGeoPointToXY {
 public:
-    // Требует PROJ при MYLIB_WITH_PROJ, иначе бросает исключение.
     [[nodiscard]] Point geo_to_xy(const GeoPoint& center, const GeoPoint& geo_point) const override;
+    void geo_to_xy_batch(const GeoPoint& center, span<const GeoPoint> in, span<Point> out) const override;
+    [[nodiscard]] GeoPoint xy_to_geo(const GeoPoint& center, const Point& xy) const override;
+    void xy_to_geo_batch(const GeoPoint& center, span<const Point> in, span<GeoPoint> out) const override;
+
+    // Проекция, привязанная к центру, для кода, которому нужен GeoProjector: строится при первом обращении
+    // и берётся из кэша. geo_to_xy и xy_to_geo кэш не используют.
+    [[nodiscard]] std::shared_ptr<const GeoProjector> projector(const GeoPoint& center) const;
+
+    // Статистика только для projector(): преобразования идут мимо кэша и в ней не отражаются,
+    // их число — в счётчиках Probe::ProjectorForward / ProjectorInverse (instrumentation.h)
+    [[nodiscard]] ProjectorCacheStats cache_stats() const { return cache_->stats(); }
+
+private:
+    // Копии экземпляра разделяют общий кэш
+    std::shared_ptr<ProjectorCache> cache_ = std::make_shared<ProjectorCache>();
 };
 
 class MYLIB_EXPORT GeoToXYUtm final: public IGeoPointToXY {
 public:
     // Вспомогательное: номер UTM-зоны по долготе
     static int utm_zone_from_lon(double lon_deg);
-    // Требует PROJ при MYLIB_WITH_PROJ, иначе бросает исключение.
     [[nodiscard]] Point geo_to_xy(const GeoPoint& center, const GeoPoint& geo_point) const override;
+    void geo_to_xy_batch(const GeoPoint& center, span<const GeoPoint> in, span<Point> out) const override;
+    [[nodiscard]] GeoPoint xy_to_geo(const GeoPoint& center, const Point& xy) const override;
+    void xy_to_geo_batch(const GeoPoint& center, span<const Point> in, span<GeoPoint> out) const override;
+
+    // Проекция зоны, в которую попадает центр, как GeoProjector; берётся из кэша. geo_to_xy и xy_to_geo
+    // кэш не используют.
+    [[nodiscard]] std::shared_ptr<const GeoProjector> projector(const GeoPoint& center) const;
+
+    // Статистика только для projector(): преобразования идут мимо кэша и в ней не отражаются,
+    // их число — в счётчиках Probe::ProjectorForward / ProjectorInverse (instrumentation.h)
+    [[nodiscard]] ProjectorCacheStats cache_stats() const { return cache_->stats(); }
+
+private:
+    // Копии экземпляра разделяют общий кэш
+    std::shared_ptr<ProjectorCache> cache_ = std::make_shared<ProjectorCache>();
 };
 
 } // namespace mylib
@@ -0,0 +1,62 @@
+// include/mylib/instrumentation.h
+#pragma once
+
+#include <mylib/export.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace mylib {
+
+/// Замеряемые функции геометрического модуля.
+/// Счётчики включаются при сборке с MYLIB_INSTRUMENTATION; без неё замеры вырезаются из кода целиком,
+/// а снимок всегда нулевой.
+enum class Probe : std::uint8_t {
+    Dist,              // dist: только вызовы
+    PolylineLengths,   // polyline_lengths (AoS и SoA); points — точки ломаной
+    PointOnPath,       // point_on_path, включая вложенный polyline_lengths
+    RingArea,          // ring_signed_area
+    PolygonMetrics,    // пересчёт кэша метрик Polygon; points — вершины внешнего контура
+    PolygonContains,   // Polygon::contains
+    EquirectForward,   // GeoToXYEquirectangular: geo -> xy
+    EquirectInverse,   // GeoToXYEquirectangular: xy -> geo
+    ProjectorForward,  // GeoProjector::forward (AEQD и UTM)
+    ProjectorInverse,  // GeoProjector::inverse
+    ProjectorCreate,   // построение GeoProjector
+    ProjPipelineCreate // создание контекста и конвейера PROJ (на каждый поток, вызывающий конвейер)
+};
+
+inline constexpr std::size_t kProbeCount = 12;
+
+struct ProbeStats {
+    std::uint64_t calls{0};
+    std::uint64_t points{0};
+    /// Суммарное время внутри функции. Поточечные вызовы (dist, geo_to_xy и т. п.) не замеряются:
+    /// чтение часов дороже самой функции; их время — в calls и points.
+    std::uint64_t nanoseconds{0};
+};
+
+/// Сумма счётчиков всех потоков с момента последнего сброса
+struct InstrumentationSnapshot {
+    std::array<ProbeStats, kProbeCount> probes{};
+
+    [[nodiscard]] const ProbeStats& operator[](Probe p) const noexcept
+    {
+        return probes[static_cast<std::size_t>(p)];
+    }
+};
+
+/// Собрана ли библиотека с MYLIB_INSTRUMENTATION
+[[nodiscard]] MYLIB_EXPORT bool instrumentation_enabled() noexcept;
+
+/// Имя функции для отчётов: "dist", "polyline_lengths", ...
+[[nodiscard]] MYLIB_EXPORT const char* probe_name(Probe p) noexcept;
+
+/// Снимок счётчиков; вызовы, идущие в других потоках во время снимка, могут попасть в него частично
+[[nodiscard]] MYLIB_EXPORT InstrumentationSnapshot instrumentation_snapshot();
+
+/// Обнуление для следующих снимков; счётчики потоков не трогаются, запоминается точка отсчёта
+MYLIB_EXPORT void instrumentation_reset();
+
+} // namespace mylib
@@ -0,0 +1,47 @@
+// include/mylib/kernels.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/span.h>
+
+namespace mylib {
+
+// Уровни векторизации ядер. Вариант выбирается во время выполнения по возможностям CPU;
+// на платформах без диспетчеризации (не x86, MSVC) доступен только Scalar.
+enum class SimdLevel { Scalar = 0, Avx2 = 1, Avx512 = 2 };
+
+// Наилучший уровень, поддерживаемый процессором и сборкой
+MYLIB_EXPORT SimdLevel simd_level() noexcept;
+
+MYLIB_EXPORT bool simd_level_supported(SimdLevel level) noexcept;
+
+MYLIB_EXPORT const char* simd_level_name(SimdLevel level) noexcept;
+
+// Equirectangular над SoA-буферами: (lat[i], lon[i]) -> (x[i], y[i]).
+// Результат побитово совпадает с GeoToXYEquirectangular::geo_to_xy на любом уровне.
+// Размеры всех буферов должны совпадать.
+MYLIB_EXPORT void equirect_forward_soa(const GeoPoint& center,
+                                       span<const double> lat,
+                                       span<const double> lon,
+                                       span<double> x,
+                                       span<double> y);
+
+// То же с явно заданным уровнем (для тестов и замеров); неподдерживаемый уровень — std::invalid_argument.
+MYLIB_EXPORT void equirect_forward_soa(const GeoPoint& center,
+                                       span<const double> lat,
+                                       span<const double> lon,
+                                       span<double> x,
+                                       span<double> y,
+                                       SimdLevel level);
+
+// Длины сегментов ломаной в SoA: out[i] = sqrt(dx*dx + dy*dy) для сегмента (i, i+1).
+// out.size() == xs.size() - 1 (или 0 для пустой ломаной). Все уровни дают побитово одинаковый результат.
+MYLIB_EXPORT void segment_lengths_soa(span<const double> xs, span<const double> ys, span<double> out);
+
+MYLIB_EXPORT void segment_lengths_soa(span<const double> xs,
+                                      span<const double> ys,
+                                      span<double> out,
+                                      SimdLevel level);
+
+} // namespace mylib
@@ -0,0 +1,77 @@
+// include/mylib/path_matcher.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/polyline.h>
+#include <mylib/span.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace mylib {
+
+/// Проекция точки на путь
+struct MYLIB_EXPORT PathProjection {
+    double distance{0.0};   // дуговая координата ближайшей точки пути, м от начала
+    double offset{0.0};     // боковое отклонение со знаком: > 0 — слева по ходу пути, < 0 — справа
+    Point point;            // ближайшая точка пути
+    std::size_t segment{0}; // сегмент [segment, segment + 1], на котором лежит point
+                            // для нечислового фикса — PathMatcher::npos, остальные поля — NaN
+};
+
+/// Привязка GNSS-фиксов к плановому пути: ближайшая точка ломаной, её дуговая координата
+/// и боковое отклонение. Сегменты разложены по равномерной сетке; поиск идёт кольцами ячеек
+/// от ячейки фикса и останавливается, когда кольцо заведомо дальше лучшего кандидата.
+/// Результат — точный ближайший сегмент, а не эвристика окна.
+class MYLIB_EXPORT PathMatcher {
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /// Подсказка для последовательных фиксов: сегмент прошлого запроса.
+    /// Соседние с ним сегменты сразу дают малый радиус поиска, и запрос обходит одну-две ячейки — O(1).
+    /// При равном расстоянии (путь проходит по себе) выбирается сегмент, ближайший к подсказке.
+    struct Hint {
+        std::size_t segment{npos};
+    };
+
+    /// cell_size — сторона ячейки сетки, м; 0 — меньшее из медианной длины сегмента и среднего
+    /// расстояния между линиями пути (площадь bbox / длина). Слишком мелкая ячейка укрупняется,
+    /// пока сетка с записями сегментов не уложится в ~64 элемента на сегмент (не меньше 2^20).
+    /// Бросает std::invalid_argument для пустого списка точек.
+    explicit PathMatcher(std::vector<Point> pts, double cell_size = 0.0);
+
+    [[nodiscard]] const PolylineIndex& path() const noexcept { return path_; }
+
+    [[nodiscard]] double cell_size() const noexcept { return cell_; }
+
+    /// Ближайшая точка пути без подсказки. Фикс с нечисловой координатой (пропуск решения GNSS)
+    /// не привязывается: segment == npos, подсказка не меняется.
+    [[nodiscard]] PathProjection project(const Point& p) const;
+
+    /// То же с подсказкой; подсказка обновляется найденным сегментом
+    [[nodiscard]] PathProjection project(const Point& p, Hint& hint) const;
+
+    /// Последовательность фиксов с общей подсказкой; размеры fixes и out должны совпадать
+    void project(span<const Point> fixes, span<PathProjection> out) const;
+
+    void project(span<const Point> fixes, span<PathProjection> out, Hint& hint) const;
+
+private:
+    struct Candidate;
+
+    void consider(const Point& p, std::size_t i, std::size_t hint, Candidate& best) const noexcept;
+    [[nodiscard]] PathProjection result(const Point& p, const Candidate& best) const noexcept;
+
+    PolylineIndex path_;
+    double cell_{1.0};
+    double min_x_{0.0};
+    double min_y_{0.0};
+    std::size_t nx_{1};
+    std::size_t ny_{1};
+    std::vector<std::uint32_t> cell_start_; // CSR: сегменты ячейки c — cell_items_[cell_start_[c], cell_start_[c+1])
+    std::vector<std::uint32_t> cell_items_;
+};
+
+} // namespace mylib
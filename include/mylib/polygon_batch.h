@@ -0,0 +1,50 @@
+// include/mylib/polygon_batch.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/span.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace mylib {
+
+class PolygonsFile;
+
+/// Набор полигонов в плоском виде (CSR) без владения памятью: вершины всех колец подряд, кольца
+/// и полигоны — диапазоны индексов, как в GeoJsonGeometries и PolygonsFile.
+/// Кольцо 0 полигона — внешний контур, остальные — дыры; замыкающая вершина кольца допускается.
+struct MYLIB_EXPORT FlatPolygons {
+    span<const Point> points;
+    span<const std::size_t> ring_offsets;  // кольцо k — points[ring_offsets[k], ring_offsets[k + 1])
+    span<const std::size_t> polygon_rings; // полигон i — кольца [polygon_rings[i], polygon_rings[i + 1])
+
+    [[nodiscard]] std::size_t size() const noexcept { return polygon_rings.empty() ? 0 : polygon_rings.size() - 1; }
+
+    [[nodiscard]] std::size_t ring_count(std::size_t i) const noexcept
+    {
+        return polygon_rings[i + 1] - polygon_rings[i];
+    }
+
+    /// Кольцо r полигона i; r == 0 — внешний контур
+    [[nodiscard]] span<const Point> ring(std::size_t i, std::size_t r) const noexcept
+    {
+        const std::size_t k = polygon_rings[i] + r;
+        return points.subspan(ring_offsets[k], ring_offsets[k + 1] - ring_offsets[k]);
+    }
+};
+
+/// Метрики всех полигонов набора: out[i] совпадает побитно с метриками Polygon из тех же колец
+/// (bbox, площадь, центроид, периметр). Полигоны делятся на непрерывные порции примерно равного
+/// числа вершин; потоки разбирают порции из общей очереди, поэтому крупные поля не тормозят
+/// остальные. threads == 0 — по числу аппаратных потоков; результат от числа потоков не зависит.
+/// Бросает std::invalid_argument, если out.size() != size() или таблицы смещений не согласованы.
+MYLIB_EXPORT void polygon_metrics(const FlatPolygons& polygons, span<PolygonMetrics> out, std::size_t threads = 0);
+
+MYLIB_EXPORT std::vector<PolygonMetrics> polygon_metrics(const FlatPolygons& polygons, std::size_t threads = 0);
+
+/// То же напрямую по отображённому файлу полигонов, без копирования вершин
+MYLIB_EXPORT void polygon_metrics(const PolygonsFile& file, span<PolygonMetrics> out, std::size_t threads = 0);
+
+} // namespace mylib
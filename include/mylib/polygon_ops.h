@@ -0,0 +1,58 @@
+// include/mylib/polygon_ops.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/span.h>
+
+#include <vector>
+
+namespace mylib {
+
+struct FlatPolygons;
+class PolygonView;
+
+// Булевы операции и смещение полигонов с дырами. Границы обоих операндов разбиваются в точках пересечения
+// (заметание по x со списком активных рёбер), затем одно заметание плоскости вычисляет для каждого ребра число
+// обхода операндов по обе стороны; в результат идут рёбра, на которых меняется принадлежность результату.
+// Сложность для n рёбер и k пересечений: заметание плоскости — O((n + k) log n), разбиение —
+// O(n log n + n a + k), где a — среднее число рёбер, x-интервалы которых перекрываются. Для длинных рёбер,
+// перекрывающихся по x (например, полосы поперёк поля), a растёт до n и разбиение квадратично.
+//
+// Результат — набор полигонов: внешний контур против часовой стрелки, дыры по часовой, вершины на прямой
+// между соседями убраны. Вырожденные части (нулевой площади) отбрасываются.
+
+enum class BooleanOp {
+    Intersection, // subject ∩ clip
+    Union,        // subject ∪ clip
+    Difference,   // subject \ clip
+    Xor,          // (subject \ clip) ∪ (clip \ subject)
+};
+
+/// Операнды — наборы полигонов; полигоны одного набора могут перекрываться (берётся их объединение).
+/// Ориентация колец не важна; кольца не должны быть самопересекающимися.
+/// std::runtime_error, если из-за округления рёбра не удалось разбить до непересекающихся.
+[[nodiscard]] MYLIB_EXPORT std::vector<Polygon> boolean_op(span<const Polygon> subject, span<const Polygon> clip,
+                                                           BooleanOp op);
+
+/// То же для наборов из PolygonSet::flat() и подобных, без копирования в Polygon
+[[nodiscard]] MYLIB_EXPORT std::vector<Polygon> boolean_op(const FlatPolygons& subject, const FlatPolygons& clip,
+                                                           BooleanOp op);
+
+[[nodiscard]] MYLIB_EXPORT std::vector<Polygon> boolean_op(const Polygon& subject, const Polygon& clip, BooleanOp op);
+
+[[nodiscard]] MYLIB_EXPORT std::vector<Polygon> boolean_op(const PolygonView& subject, const PolygonView& clip,
+                                                           BooleanOp op);
+
+/// Смещение границы на distance метров: > 0 — наружу (полигон растёт, дыры сужаются), < 0 — внутрь
+/// (например, рабочая зона без поворотной полосы). Выпуклые для смещения углы скругляются дугами,
+/// хорды которых отстоят от окружности не больше чем на arc_tolerance. При сужении полигон может
+/// распасться на несколько частей или исчезнуть (пустой результат).
+/// std::invalid_argument при нечисловом distance или arc_tolerance <= 0; std::runtime_error — как у boolean_op.
+[[nodiscard]] MYLIB_EXPORT std::vector<Polygon> offset_polygon(const Polygon& polygon, double distance,
+                                                               double arc_tolerance = 0.01);
+
+[[nodiscard]] MYLIB_EXPORT std::vector<Polygon> offset_polygon(const PolygonView& polygon, double distance,
+                                                               double arc_tolerance = 0.01);
+
+} // namespace mylib
@@ -0,0 +1,233 @@
+// include/mylib/polygon_set.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/polygon_batch.h>
+#include <mylib/span.h>
+
+#include <cstddef>
+#include <iterator>
+#include <memory_resource>
+#include <vector>
+
+namespace mylib {
+
+/// Кольца, лежащие подряд в общем буфере вершин: кольцо k — base[offsets[k], offsets[k + 1]).
+/// Перебирается как диапазон span<const Point>; offsets.size() == size() + 1.
+class MYLIB_EXPORT RingList {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = span<const Point>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = span<const Point>;
+
+        iterator() = default;
+        iterator(const Point* base, const std::size_t* offset) noexcept: base_(base), offset_(offset) { }
+
+        reference operator*() const noexcept { return {base_ + offset_[0], offset_[1] - offset_[0]}; }
+
+        iterator& operator++() noexcept
+        {
+            ++offset_;
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            iterator old = *this;
+            ++offset_;
+            return old;
+        }
+
+        bool operator==(const iterator& o) const noexcept { return offset_ == o.offset_; }
+        bool operator!=(const iterator& o) const noexcept { return offset_ != o.offset_; }
+
+    private:
+        const Point* base_{nullptr};
+        const std::size_t* offset_{nullptr};
+    };
+
+    RingList() = default;
+    RingList(const Point* base, span<const std::size_t> offsets) noexcept: base_(base), offsets_(offsets) { }
+
+    [[nodiscard]] std::size_t size() const noexcept { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] span<const Point> operator[](std::size_t k) const noexcept
+    {
+        return {base_ + offsets_[k], offsets_[k + 1] - offsets_[k]};
+    }
+
+    [[nodiscard]] iterator begin() const noexcept { return {base_, offsets_.data()}; }
+    [[nodiscard]] iterator end() const noexcept { return {base_, offsets_.data() + size()}; }
+
+private:
+    const Point* base_{nullptr};
+    span<const std::size_t> offsets_;
+};
+
+/// Полигон без владения памятью: кольца в чужом буфере вершин (PolygonSet, FlatPolygons).
+/// Повторяет читающий интерфейс Polygon — vertices(), holes(), метрики, contains — и принимается
+/// plan_swaths, sweep_headings, CoverageAccumulator, boolean_op, offset_polygon и Simplifier::simplify
+/// наравне с Polygon; весь набор пишется в файл write_polygons_file(path, set.flat()). PolygonIndex
+/// по-прежнему владеет копиями Polygon: его запросы опираются на закэшированные в Polygon bbox.
+/// Метрики не кэшируются:
+/// каждая — проход по кольцам, для набора полигонов выгоднее polygon_metrics.
+/// Вид действителен, пока жив и не изменён буфер, на который он указывает.
+class MYLIB_EXPORT PolygonView {
+public:
+    PolygonView() = default;
+
+    /// rings — смещения колец в base; rings.size() — число колец + 1, кольцо 0 — внешний контур
+    PolygonView(const Point* base, span<const std::size_t> rings) noexcept: base_(base), offsets_(rings) { }
+
+    /// Полигон i плоского набора
+    PolygonView(const FlatPolygons& set, std::size_t i) noexcept
+        : base_(set.points.data())
+        , offsets_(set.ring_offsets.subspan(set.polygon_rings[i], set.ring_count(i) + 1))
+    {
+    }
+
+    /// Вершины внешнего контура; пусто для полигона без колец
+    [[nodiscard]] span<const Point> vertices() const noexcept
+    {
+        const RingList r = rings();
+        return r.empty() ? span<const Point>{} : r[0];
+    }
+
+    /// Дыры — диапазон span<const Point>
+    [[nodiscard]] RingList holes() const noexcept
+    {
+        return offsets_.size() < 2 ? RingList{} : RingList(base_, offsets_.subspan(1));
+    }
+
+    /// Все кольца: 0 — внешний контур, далее дыры
+    [[nodiscard]] RingList rings() const noexcept { return {base_, offsets_}; }
+
+    [[nodiscard]] PolygonMetrics metrics() const noexcept;
+
+    [[nodiscard]] double area() const noexcept { return metrics().area(); }
+    [[nodiscard]] double signed_area() const noexcept { return metrics().signed_area; }
+    [[nodiscard]] Point centroid() const noexcept { return metrics().centroid; }
+    [[nodiscard]] double perimeter() const noexcept { return metrics().perimeter; }
+    [[nodiscard]] BBox bbox() const noexcept;
+
+    /// Как Polygon::contains
+    [[nodiscard]] bool contains(const Point& p) const noexcept;
+
+    /// Копия в самостоятельный Polygon — для функций, которые принимают только Polygon
+    [[nodiscard]] Polygon to_polygon() const;
+
+private:
+    friend class PolygonSet;
+
+    const Point* base_{nullptr};
+    span<const std::size_t> offsets_;
+};
+
+/// Набор полигонов в трёх непрерывных массивах (вершины, смещения колец, границы полигонов) вместо
+/// отдельного std::vector на каждое кольцо: загрузка 500 тыс. полей — несколько выделений памяти
+/// вместо сотен тысяч, удаление — освобождение трёх буферов. Память берётся из memory_resource:
+/// по умолчанию из кучи, для арены — std::pmr::monotonic_buffer_resource.
+/// clear() стоит O(1) и сохраняет ёмкость. Добавление может перевыделить буферы и сделать недействительными
+/// ранее полученные виды; reserve заранее это исключает. Перемещённый набор пуст и пригоден для add.
+class MYLIB_EXPORT PolygonSet {
+public:
+    explicit PolygonSet(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    PolygonSet(const PolygonSet& other, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    PolygonSet(PolygonSet&&) noexcept = default;
+    PolygonSet& operator=(const PolygonSet&) = default;
+    PolygonSet& operator=(PolygonSet&&) = default;
+    ~PolygonSet() = default;
+
+    // Таблицы смещений пусты только у перемещённого набора; add восстанавливает начальный ноль
+    [[nodiscard]] std::size_t size() const noexcept { return polygon_rings_.empty() ? 0 : polygon_rings_.size() - 1; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] std::size_t ring_count() const noexcept
+    {
+        return ring_offsets_.empty() ? 0 : ring_offsets_.size() - 1;
+    }
+    [[nodiscard]] std::size_t point_count() const noexcept { return points_.size(); }
+
+    /// Ёмкость под polygons полигонов, rings колец и points вершин всего набора
+    void reserve(std::size_t polygons, std::size_t rings, std::size_t points);
+
+    /// Новый полигон: внешний контур и дыры; замыкающая вершина колец сохраняется как есть. Возвращает индекс.
+    /// Источник может лежать в этом же наборе, например set.add(set[0]).
+    std::size_t add(span<const Point> outer);
+    std::size_t add(const Polygon& polygon);
+    std::size_t add(const PolygonView& polygon);
+
+    /// Дыра последнего добавленного полигона; std::logic_error для пустого набора
+    void add_hole(span<const Point> hole);
+
+    [[nodiscard]] PolygonView operator[](std::size_t i) const noexcept { return PolygonView(flat(), i); }
+
+    /// Плоский вид всего набора, например для polygon_metrics
+    [[nodiscard]] FlatPolygons flat() const noexcept { return {points_, ring_offsets_, polygon_rings_}; }
+
+    /// Удаление всех полигонов без освобождения памяти, O(1)
+    void clear() noexcept;
+
+    [[nodiscard]] std::pmr::memory_resource* resource() const noexcept { return points_.get_allocator().resource(); }
+
+private:
+    void restore_offsets();
+    void append_ring(span<const Point> ring);
+
+    std::pmr::vector<Point> points_;
+    std::pmr::vector<std::size_t> ring_offsets_;  // ring_count() + 1
+    std::pmr::vector<std::size_t> polygon_rings_; // size() + 1
+};
+
+/// Набор треков GeoPoint в одном буфере: трек i — span<const GeoPoint>, принимаемый пакетными
+/// проекциями (geo_to_xy_batch, GeoProjector). Память, clear() и перемещение — как у PolygonSet.
+class MYLIB_EXPORT TrackStore {
+public:
+    explicit TrackStore(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    TrackStore(const TrackStore& other, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    TrackStore(TrackStore&&) noexcept = default;
+    TrackStore& operator=(const TrackStore&) = default;
+    TrackStore& operator=(TrackStore&&) = default;
+    ~TrackStore() = default;
+
+    [[nodiscard]] std::size_t size() const noexcept { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] std::size_t point_count() const noexcept { return points_.size(); }
+
+    void reserve(std::size_t tracks, std::size_t points);
+
+    /// Новый трек; возвращает индекс
+    std::size_t add(span<const GeoPoint> track);
+
+    /// Дописать точки в последний трек — для чтения порциями (IGeoPointSource); std::logic_error для пустого набора
+    void append(span<const GeoPoint> points);
+
+    [[nodiscard]] span<const GeoPoint> operator[](std::size_t i) const noexcept
+    {
+        return {points_.data() + offsets_[i], offsets_[i + 1] - offsets_[i]};
+    }
+
+    /// Все точки всех треков подряд
+    [[nodiscard]] span<const GeoPoint> points() const noexcept { return points_; }
+
+    /// Смещения: трек i — points()[offsets()[i], offsets()[i + 1]); пусто у перемещённого набора
+    [[nodiscard]] span<const std::size_t> offsets() const noexcept { return offsets_; }
+
+    /// Удаление всех треков без освобождения памяти, O(1)
+    void clear() noexcept;
+
+    [[nodiscard]] std::pmr::memory_resource* resource() const noexcept { return points_.get_allocator().resource(); }
+
+private:
+    std::pmr::vector<GeoPoint> points_;
+    std::pmr::vector<std::size_t> offsets_; // size() + 1
+};
+
+} // namespace mylib
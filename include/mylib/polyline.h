@@ -0,0 +1,84 @@
+// include/mylib/polyline.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/span.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace mylib {
+
+/// Ломаная с однажды вычисленными накопленными длинами.
+/// Запросы точки по дистанции имеют ту же семантику, что и point_on_path, но не пересчитывают длины.
+class MYLIB_EXPORT PolylineIndex {
+public:
+    /// Позиция последнего запроса: индекс правого конца текущего сегмента.
+    /// Для неубывающей последовательности дистанций запрос через курсор — амортизированно O(1).
+    struct Cursor {
+        std::size_t segment{1};
+    };
+
+    // Бросает std::invalid_argument для пустого списка точек
+    explicit PolylineIndex(std::vector<Point> pts);
+
+    [[nodiscard]] const std::vector<Point>& points() const noexcept { return pts_; }
+
+    /// s[i] — расстояние от начала до points()[i], как в polyline_lengths
+    [[nodiscard]] const std::vector<double>& lengths() const noexcept { return s_; }
+
+    [[nodiscard]] double length() const noexcept { return s_.back(); }
+
+    /// Точка на расстоянии distance от начала, O(log n)
+    [[nodiscard]] Point point_at(double distance) const;
+
+    /// То же с курсором: поиск начинается с сегмента прошлого запроса.
+    /// При движении назад выполняется двоичный поиск.
+    [[nodiscard]] Point point_at(double distance, Cursor& cursor) const;
+
+    /// Точки через каждые step метров от начала за один проход; последняя точка ломаной добавляется,
+    /// если длина не кратна шагу. step должен быть положительным.
+    [[nodiscard]] std::vector<Point> resample(double step) const;
+
+private:
+    void check_distance(double distance) const;
+    [[nodiscard]] Point interpolate(std::size_t i, double distance) const;
+
+    std::vector<Point> pts_;
+    std::vector<double> s_;
+};
+
+/// Длина растущего трека: добавление k точек стоит O(k), память не выделяется.
+class MYLIB_EXPORT PolylineLengthAccumulator {
+public:
+    void append(const Point& p) noexcept;
+
+    void append(span<const Point> pts) noexcept;
+
+    /// То же с выдачей накопленных длин новых точек: out[i] — расстояние от начала трека до pts[i].
+    /// out.size() должен совпадать с pts.size().
+    void append(span<const Point> pts, span<double> out);
+
+    /// SoA-вариант; длины сегментов считает ядро segment_lengths_soa блоками на стеке.
+    void append(span<const double> xs, span<const double> ys);
+
+    [[nodiscard]] double length() const noexcept { return length_; }
+
+    /// Число добавленных точек
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+
+    /// Последняя добавленная точка; для пустого трека не определена
+    [[nodiscard]] const Point& last() const noexcept { return last_; }
+
+    void reset() noexcept;
+
+private:
+    Point last_;
+    double length_{0.0};
+    std::size_t count_{0};
+};
+
+} // namespace mylib
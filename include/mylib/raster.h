@@ -0,0 +1,68 @@
+// include/mylib/raster.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/span.h>
+
+#include <cstddef>
+
+namespace mylib {
+
+class PolygonView;
+
+/// Растр с фиксированным шагом в буфере вызывающего (карта предписаний, урожайности).
+/// Ячейка (col, row) — квадрат [origin.x + col * cell_size, ... + cell_size) x [origin.y + row * cell_size, ...);
+/// строка 0 — нижняя (минимальный y), как в CoverageAccumulator. Для растров «север сверху» (GeoTIFF)
+/// строки переворачиваются при записи. cells — построчно, cells.size() == cols * rows.
+struct MYLIB_EXPORT RasterGrid {
+    Point origin;           // левый нижний угол ячейки (0, 0)
+    double cell_size{1.0};  // м
+    std::size_t cols{0};
+    std::size_t rows{0};
+    span<float> cells;
+
+    [[nodiscard]] float& at(std::size_t col, std::size_t row) const noexcept { return cells[row * cols + col]; }
+};
+
+/// Что считается долей ячейки под фигурой
+enum class RasterCoverage {
+    CellCenter, // 1, если центр ячейки внутри, иначе 0
+    Exact,      // точная доля площади ячейки внутри фигуры (сглаживание краёв)
+};
+
+/// Запись значения с долей f в ячейку out
+enum class RasterMerge {
+    Replace, // out += f * (value - out): при f == 1 — замена, на краю — смешение
+    Max,     // out = max(out, f * value)
+    Add,     // out += f * value
+};
+
+struct MYLIB_EXPORT RasterParams {
+    double value{1.0};
+    RasterCoverage coverage{RasterCoverage::Exact};
+    RasterMerge merge{RasterMerge::Replace};
+    std::size_t threads{0}; // полосы строк раздаются потокам; 0 — по числу аппаратных потоков
+};
+
+// Растеризация заметающей строкой: для каждой строки растра только рёбра, пересекающие её, — стоимость
+// пропорциональна числу ячеек под фигурой и её границей, а не площади всего растра. Точная доля площади
+// считается накоплением вклада рёбер со знаком и префиксной суммой по строке. Ячейки вне фигуры не
+// трогаются; части фигуры за пределами растра отсекаются. Полосы строк обрабатываются параллельно,
+// результат от числа потоков не зависит. Растр без строк или столбцов не меняется.
+// std::invalid_argument при cell_size <= 0 или cells.size() != cols * rows.
+
+/// Полигон с дырами (правило чёт-нечет, ориентация колец не важна)
+MYLIB_EXPORT void rasterize(const Polygon& polygon, const RasterGrid& grid, const RasterParams& params);
+
+MYLIB_EXPORT void rasterize(const PolygonView& polygon, const RasterGrid& grid, const RasterParams& params);
+
+/// Полоса шириной width вдоль ломаной (проход агрегата): прямоугольники сегментов без продления за концы
+/// и веер на стыках, как в CoverageAccumulator. Перекрытия не суммируются: доля ячейки — наибольшая
+/// из долей отдельных частей полосы, поэтому в ячейке, где сходятся края двух частей, Exact может
+/// немного занижать долю объединения. Точка с нечисловой координатой разрывает полосу.
+/// std::invalid_argument при width <= 0 или нечисловой ширине.
+MYLIB_EXPORT void rasterize_strip(span<const Point> path, double width, const RasterGrid& grid,
+                                  const RasterParams& params);
+
+} // namespace mylib
@@ -0,0 +1,88 @@
+// include/mylib/simplify.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/span.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace mylib {
+
+class PolygonView;
+
+enum class SimplifyMethod {
+    // Допуск — максимальное отклонение исходных точек от упрощённой линии, м.
+    // Рекурсия заменена явным стеком: O(n log n) при сбалансированных разбиениях, но O(n^2) в худшем
+    // случае (каждое разбиение отщепляет одну точку). Гарантию O(n log n) даёт только Visvalingam.
+    DouglasPeucker,
+    // Допуск — минимальная эффективная площадь треугольника вершины, м^2.
+    // Индексная куча: площади соседей удалённой вершины обновляются на месте; O(n log n) всегда.
+    Visvalingam,
+};
+
+struct MYLIB_EXPORT SimplifyStats {
+    std::size_t input_size{0};
+    std::size_t output_size{0};
+
+    /// Во сколько раз сократилось число вершин; 0 для пустого входа
+    [[nodiscard]] double ratio() const noexcept
+    {
+        return output_size ? static_cast<double>(input_size) / static_cast<double>(output_size) : 0.0;
+    }
+};
+
+/// Упрощение ломаных и полигонов по допуску. Рабочие буферы хранятся в объекте и переиспользуются
+/// между вызовами, так что повторное упрощение не выделяет память. Объект не потокобезопасен.
+class MYLIB_EXPORT Simplifier {
+public:
+    /// std::invalid_argument при отрицательном или нечисловом допуске
+    explicit Simplifier(SimplifyMethod method, double tolerance);
+
+    [[nodiscard]] SimplifyMethod method() const noexcept { return method_; }
+    [[nodiscard]] double tolerance() const noexcept { return tolerance_; }
+
+    /// Ломаная: первая и последняя точки сохраняются, остальные — подпоследовательность исходных.
+    /// Результат — первые output_size элементов out. out.size() >= in.size(); out может совпадать
+    /// с in (упрощение на месте), но не должен перекрываться с ним иначе.
+    SimplifyStats simplify(span<const Point> in, span<Point> out);
+
+    /// На месте; вектор укорачивается до результата
+    SimplifyStats simplify(std::vector<Point>& pts);
+
+    /// Замкнутое кольцо без повторной первой вершины: остаётся не меньше трёх вершин
+    /// (если их было не меньше трёх). Требования к out — как у simplify.
+    SimplifyStats simplify_ring(span<const Point> in, span<Point> out);
+
+    /// Внешний контур и каждая дыра упрощаются как кольца; stats — по всем вершинам
+    [[nodiscard]] Polygon simplify(const Polygon& polygon, SimplifyStats* stats = nullptr);
+
+    /// То же для полигона из PolygonSet или FlatPolygons, без промежуточного Polygon
+    [[nodiscard]] Polygon simplify(const PolygonView& polygon, SimplifyStats* stats = nullptr);
+
+private:
+    void mark_douglas_peucker(span<const Point> pts, std::size_t first, std::size_t last);
+    void mark_visvalingam(span<const Point> pts, bool ring);
+    [[nodiscard]] bool heap_less(std::size_t a, std::size_t b) const noexcept;
+    void heap_place(std::size_t h);
+    SimplifyStats compact(span<const Point> in, span<Point> out) const;
+
+    SimplifyMethod method_;
+    double tolerance_;
+
+    // Рабочие буферы
+    std::vector<unsigned char> keep_;
+    std::vector<std::size_t> stack_;
+    std::vector<std::size_t> prev_;
+    std::vector<std::size_t> next_;
+    std::vector<double> area_;
+    std::vector<std::size_t> heap_;     // индексы вершин, куча по area_
+    std::vector<std::size_t> heap_pos_; // позиция вершины в heap_
+};
+
+/// Упрощённая копия ломаной
+[[nodiscard]] MYLIB_EXPORT std::vector<Point> simplify_polyline(span<const Point> pts, SimplifyMethod method,
+                                                                double tolerance);
+
+} // namespace mylib
@@ -0,0 +1,75 @@
+// include/mylib/span.h
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace mylib {
+
+namespace detail {
+
+// Контейнер C с непрерывными data()/size(), элементы которого можно рассматривать как T
+template <typename C, typename T, typename = void>
+struct is_span_compatible: std::false_type { };
+
+template <typename C, typename T>
+struct is_span_compatible<C, T, std::void_t<decltype(std::declval<C&>().data()), decltype(std::declval<C&>().size())>>:
+    std::is_convertible<std::remove_pointer_t<decltype(std::declval<C&>().data())> (*)[], T (*)[]> { };
+
+} // namespace detail
+
+// Минимальный аналог std::span (C++20) для C++17: непрерывный диапазон без владения.
+// Неявно строится из std::vector, std::array, C-массива и span<U> с совместимым типом.
+template <typename T>
+class span {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+
+    constexpr span() noexcept = default;
+
+    constexpr span(T* data, std::size_t size) noexcept: data_(data), size_(size) { }
+
+    template <std::size_t N>
+    constexpr span(T (&arr)[N]) noexcept: data_(arr), size_(N) { }
+
+    template <typename C, typename = std::enable_if_t<detail::is_span_compatible<C, T>::value>>
+    constexpr span(C& c) noexcept(noexcept(c.data())): data_(c.data()), size_(c.size()) { }
+
+    template <typename C, typename = std::enable_if_t<detail::is_span_compatible<const C, T>::value>>
+    constexpr span(const C& c) noexcept(noexcept(c.data())): data_(c.data()), size_(c.size()) { }
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr span(const span<U>& other) noexcept: data_(other.data()), size_(other.size()) { }
+
+    [[nodiscard]] constexpr T* data() const noexcept { return data_; }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] constexpr std::size_t size_bytes() const noexcept { return size_ * sizeof(T); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr T& operator[](std::size_t i) const noexcept { return data_[i]; }
+    [[nodiscard]] constexpr T& front() const noexcept { return data_[0]; }
+    [[nodiscard]] constexpr T& back() const noexcept { return data_[size_ - 1]; }
+
+    [[nodiscard]] constexpr T* begin() const noexcept { return data_; }
+    [[nodiscard]] constexpr T* end() const noexcept { return data_ + size_; }
+
+    [[nodiscard]] constexpr span first(std::size_t count) const noexcept { return {data_, count}; }
+    [[nodiscard]] constexpr span last(std::size_t count) const noexcept { return {data_ + (size_ - count), count}; }
+    [[nodiscard]] constexpr span subspan(std::size_t offset) const noexcept { return {data_ + offset, size_ - offset}; }
+    [[nodiscard]] constexpr span subspan(std::size_t offset, std::size_t count) const noexcept
+    {
+        return {data_ + offset, count};
+    }
+
+private:
+    T* data_{nullptr};
+    std::size_t size_{0};
+};
+
+} // namespace mylib
@@ -0,0 +1,64 @@
+// include/mylib/spatial_index.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/span.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace mylib {
+
+/// Статический R-дерево над набором полигонов, упакованное алгоритмом STR (Sort-Tile-Recursive).
+/// Строится один раз за O(n log n); запросы не выделяют память, кроме роста выходного вектора.
+class MYLIB_EXPORT PolygonIndex {
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    static constexpr std::size_t kDefaultNodeCapacity = 16;
+
+    // node_capacity — число потомков узла, приводится к диапазону [2, 64]
+    explicit PolygonIndex(std::vector<Polygon> polygons, std::size_t node_capacity = kDefaultNodeCapacity);
+
+    [[nodiscard]] const std::vector<Polygon>& polygons() const noexcept { return polygons_; }
+
+    [[nodiscard]] std::size_t size() const noexcept { return polygons_.size(); }
+
+    /// Индексы всех полигонов, содержащих точку, по возрастанию
+    [[nodiscard]] std::vector<std::size_t> query_point(const Point& p) const;
+
+    /// То же в вектор вызывающего (очищается перед заполнением) — для повторного использования памяти
+    void query_point(const Point& p, std::vector<std::size_t>& out) const;
+
+    /// Первый найденный полигон, содержащий точку, или npos; для непересекающихся полей — единственный
+    [[nodiscard]] std::size_t locate(const Point& p) const;
+
+    /// Пакетный locate: out[i] = locate(pts[i]); размеры должны совпадать
+    void locate(span<const Point> pts, span<std::size_t> out) const;
+
+    /// Индексы полигонов, чей ограничивающий прямоугольник пересекает box, по возрастанию
+    [[nodiscard]] std::vector<std::size_t> query_bbox(const BBox& box) const;
+
+    void query_bbox(const BBox& box, std::vector<std::size_t>& out) const;
+
+private:
+    struct Node {
+        BBox box;
+        std::size_t first; // лист: индекс в items_, иначе индекс первого дочернего узла в nodes_
+        std::size_t count;
+    };
+
+    template <typename Visit>
+    bool visit(std::size_t node, const Point& p, Visit& fn) const;
+
+    template <typename Visit>
+    void visit(std::size_t node, const BBox& box, Visit& fn) const;
+
+    std::vector<Polygon> polygons_;
+    std::vector<std::size_t> items_; // номера полигонов в порядке упаковки
+    std::vector<BBox> item_boxes_;   // их прямоугольники в том же порядке
+    std::vector<Node> nodes_;        // уровни снизу вверх, корень — последний
+    std::size_t leaf_count_{0};      // узлы [0, leaf_count_) — листья
+};
+
+} // namespace mylib
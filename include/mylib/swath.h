@@ -0,0 +1,89 @@
+// include/mylib/swath.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/span.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace mylib {
+
+class PolygonView;
+
+/// Параметры покрытия поля параллельными проходами (челноком)
+struct MYLIB_EXPORT SwathParams {
+    double width{0.0};       // ширина захвата агрегата, м; > 0
+    double heading_deg{0.0}; // направление проходов: азимут от оси +Y по часовой стрелке, градусы
+    double min_length{0.0};  // проходы короче отбрасываются, м
+};
+
+/// Результат планирования: проходы в порядке движения и соединяющий их путь
+struct MYLIB_EXPORT SwathPlan {
+    /// Рабочие проходы; start -> end — направление движения, соседние проходы чередуют направление
+    std::vector<BoundPoints> swaths;
+
+    /// Связный путь: start и end каждого прохода подряд. Переезды между проходами — отрезки
+    /// по прямой, без учёта радиуса разворота и границ поля.
+    std::vector<Point> path;
+
+    double working_length{0.0};    // суммарная длина проходов, м
+    double transition_length{0.0}; // суммарная длина переездов, м
+
+    [[nodiscard]] std::size_t turns() const noexcept { return swaths.empty() ? 0 : swaths.size() - 1; }
+};
+
+/// Параллельные проходы по полю с учётом дыр. Осевые линии проходов идут с шагом width,
+/// первая — в width / 2 от края поля. Линия, пересекающая несколько участков поля (невыпуклый
+/// контур, дыры), даёт несколько проходов подряд.
+/// Заметающая прямая с активным списком рёбер: O(E log E + L * A), где E — число рёбер,
+/// L — число линий, A — рёбер на одной линии. Бросает std::invalid_argument при width <= 0.
+MYLIB_EXPORT SwathPlan plan_swaths(const Polygon& field, const SwathParams& params);
+
+/// То же для полигона из PolygonSet или FlatPolygons, без копирования в Polygon
+MYLIB_EXPORT SwathPlan plan_swaths(const PolygonView& field, const SwathParams& params);
+
+// ==== Выбор направления проходов ====
+
+/// Параметры перебора направлений
+struct MYLIB_EXPORT HeadingSweepParams {
+    double width{0.0};      // ширина захвата, м; > 0
+    double min_length{0.0}; // как в SwathParams
+    double turn_cost{0.0};  // штраф за разворот в метрах пути; большой штраф — минимизация числа разворотов
+    std::size_t threads{0}; // 0 — по числу аппаратных потоков
+};
+
+/// Оценка плана для одного направления
+struct MYLIB_EXPORT HeadingCost {
+    double heading_deg{0.0};
+    std::size_t swaths{0};
+    std::size_t turns{0};
+    double working_length{0.0};
+    double transition_length{0.0};
+    double cost{0.0}; // working_length + transition_length + turn_cost * turns
+};
+
+struct MYLIB_EXPORT HeadingSweepResult {
+    std::vector<HeadingCost> table; // в порядке входных направлений
+    std::size_t best{0};            // индекс в table; при равной стоимости — меньший индекс
+
+    [[nodiscard]] const HeadingCost& best_cost() const { return table.at(best); }
+};
+
+/// Оценка плана для каждого направления из headings_deg; направления обрабатываются параллельно,
+/// результат не зависит от числа потоков. Пустой список направлений — std::invalid_argument.
+MYLIB_EXPORT HeadingSweepResult sweep_headings(const Polygon& field, span<const double> headings_deg,
+                                               const HeadingSweepParams& params);
+
+MYLIB_EXPORT HeadingSweepResult sweep_headings(const PolygonView& field, span<const double> headings_deg,
+                                               const HeadingSweepParams& params);
+
+/// Перебор по равномерной сетке [0, 180) с шагом step_deg: противоположные направления дают те же проходы
+MYLIB_EXPORT HeadingSweepResult sweep_headings(const Polygon& field, double step_deg,
+                                               const HeadingSweepParams& params);
+
+MYLIB_EXPORT HeadingSweepResult sweep_headings(const PolygonView& field, double step_deg,
+                                               const HeadingSweepParams& params);
+
+} // namespace mylib
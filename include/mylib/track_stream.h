@@ -0,0 +1,106 @@
+// include/mylib/track_stream.h
+#pragma once
+
+#include <mylib/export.h>
+#include <mylib/geometry.h>
+#include <mylib/span.h>
+
+#include <cstddef>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace mylib {
+
+// ==== Источники точек (стадия parse) ====
+
+/// Источник точек для режима pull: read заполняет начало out и возвращает число точек, 0 — конец потока.
+class MYLIB_EXPORT IGeoPointSource {
+public:
+    virtual ~IGeoPointSource() = default;
+    virtual std::size_t read(span<GeoPoint> out) = 0;
+};
+
+/// Текст "lat,lon[,alt]" построчно из потока, читаемого блоками фиксированного размера.
+/// Пустые строки и строки, начинающиеся с '#', пропускаются. Ошибка разбора — std::runtime_error
+/// с номером строки. Память — один буфер block_size байт; строка длиннее буфера — ошибка.
+class MYLIB_EXPORT CsvGeoPointSource final: public IGeoPointSource {
+public:
+    static constexpr std::size_t kDefaultBlockSize = 1 << 16;
+
+    explicit CsvGeoPointSource(std::istream& in, bool has_header = false,
+                               std::size_t block_size = kDefaultBlockSize);
+
+    std::size_t read(span<GeoPoint> out) override;
+
+private:
+    bool parse_line(const char* first, const char* last, GeoPoint& out);
+
+    std::istream& in_;
+    std::vector<char> buf_;
+    std::size_t begin_{0}; // непрочитанные байты буфера: [begin_, end_)
+    std::size_t end_{0};
+    std::size_t line_{0};
+    bool skip_header_;
+    bool eof_{false};
+};
+
+// ==== Конвейер project -> filter -> accumulate ====
+
+struct MYLIB_EXPORT TrackPipelineConfig {
+    std::size_t chunk_size{4096}; // точек в блоке
+    std::size_t chunk_count{4};   // блоков в обращении; память ~ chunk_count * chunk_size * sizeof(GeoPoint)
+
+    // Фильтр шага до последней принятой точки, м: ближе min_step — стоянка/дрожание приёмника,
+    // дальше max_step — выброс. Точки с нечисловыми координатами отбрасываются всегда.
+    double min_step{0.0};
+    double max_step{std::numeric_limits<double>::infinity()};
+
+    // Разрыв (потеря сигнала, переезд между полями): после стольких подряд выбросов, согласованных между
+    // собой по тому же фильтру шага, трек продолжается от них без скачка в длине и площади.
+    // Если до разрыва принята одна точка, она сама считается выбросом и отбрасывается. 0 — не продолжать.
+    std::size_t reanchor_after{5};
+};
+
+/// Итог обработки трека
+struct MYLIB_EXPORT TrackStats {
+    std::size_t points_in{0};       // поступило в конвейер
+    std::size_t points_accepted{0}; // прошло фильтр
+    double length{0.0};             // длина по принятым точкам, м
+    double enclosed_area{0.0};      // ориентированная площадь, замкнутая треком (обход контура поля), м^2
+    std::size_t gaps{0};            // разрывов, после которых трек продолжен (reanchor_after)
+    Point first;                    // первая и последняя принятые точки (при points_accepted > 0)
+    Point last;
+};
+
+/// Потоковая обработка трека с постоянной памятью. Точки копируются в блоки фиксированного размера;
+/// проекция, фильтр и накопление идут в отдельном потоке. Когда все блоки заняты, push ждёт
+/// освобождения (обратное давление), поэтому память не зависит от длины трека.
+/// Проекция должна оставаться живой до finish и допускать вызовы из другого потока.
+/// Исключение стадии обработки пробрасывается из первого push/run/finish после того, как поток
+/// обработки его поймал, и из всех последующих.
+class MYLIB_EXPORT TrackPipeline {
+public:
+    TrackPipeline(const IGeoPointToXY& projection, const GeoPoint& center, TrackPipelineConfig config = {});
+    ~TrackPipeline();
+
+    TrackPipeline(const TrackPipeline&) = delete;
+    TrackPipeline& operator=(const TrackPipeline&) = delete;
+
+    /// Режим push. После finish — std::logic_error.
+    void push(span<const GeoPoint> pts);
+    void push(const GeoPoint& p);
+
+    /// Режим pull: читает источник блоками прямо в буферы конвейера до конца потока
+    void run(IGeoPointSource& source);
+
+    /// Дожидается обработки всех точек и возвращает итог; повторный вызов возвращает тот же итог
+    TrackStats finish();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace mylib
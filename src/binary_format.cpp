@@ -0,0 +1,450 @@
+// src/binary_format.cpp
+#include <mylib/binary_format.h>
+
+#include <mylib/polygon_batch.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mylib {
+
+namespace {
+
+constexpr char kMagic[8] = {'A', 'G', 'R', 'O', 'B', 'I', 'N', '\0'};
+constexpr std::uint32_t kByteOrderMark = 0x01020304;
+constexpr std::uint64_t kAlignment = 64;
+
+struct FileHeader {
+    char magic[8];
+    std::uint32_t byte_order;
+    std::uint16_t version;
+    std::uint16_t kind;
+    std::uint64_t count;
+    std::uint64_t aux_count;
+    std::uint64_t section[4];
+};
+static_assert(sizeof(FileHeader) == 64, "Заголовок формата должен занимать ровно 64 байта");
+static_assert(std::is_standard_layout_v<Point> && sizeof(Point) == 2 * sizeof(double),
+              "Point хранится в файле как два double подряд");
+
+std::uint64_t align_up(std::uint64_t v) noexcept
+{
+    return (v + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+// ---- Запись ----
+
+class Writer {
+public:
+    explicit Writer(const std::string& path)
+        : path_(path)
+        , out_(path, std::ios::binary | std::ios::trunc)
+    {
+        if (!out_) {
+            throw std::runtime_error("Не удалось открыть файл для записи: " + path);
+        }
+    }
+
+    // Заголовок пишется последним, когда известны смещения секций
+    void begin() { pad_to(sizeof(FileHeader)); }
+
+    std::uint64_t begin_section()
+    {
+        pad_to(align_up(pos_));
+        return pos_;
+    }
+
+    void write(const void* data, std::size_t bytes)
+    {
+        out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        pos_ += bytes;
+    }
+
+    template <typename T>
+    void write_array(span<const T> values)
+    {
+        write(values.data(), values.size_bytes());
+    }
+
+    void finish(FileHeader header)
+    {
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.byte_order = kByteOrderMark;
+        header.version = kBinaryFormatVersion;
+        out_.seekp(0);
+        out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out_.flush();
+        if (!out_) {
+            throw std::runtime_error("Ошибка записи файла: " + path_);
+        }
+    }
+
+private:
+    void pad_to(std::uint64_t pos)
+    {
+        static constexpr char zeros[kAlignment] = {};
+        while (pos_ < pos) {
+            const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(pos - pos_, kAlignment));
+            write(zeros, n);
+        }
+    }
+
+    std::string path_;
+    std::ofstream out_;
+    std::uint64_t pos_{0};
+};
+
+// Столбец, собираемый из массива структур блоками на стеке
+template <typename Src, typename Get>
+void write_column(Writer& w, span<const Src> src, Get get)
+{
+    constexpr std::size_t kBlock = 1024;
+    double block[kBlock];
+    for (std::size_t begin = 0; begin < src.size(); begin += kBlock) {
+        const std::size_t n = std::min(kBlock, src.size() - begin);
+        for (std::size_t i = 0; i < n; ++i) {
+            block[i] = get(src[begin + i]);
+        }
+        w.write(block, n * sizeof(double));
+    }
+}
+
+// ---- Чтение ----
+
+[[noreturn]] void fail(const std::string& what)
+{
+    throw std::runtime_error("Некорректный бинарный файл: " + what);
+}
+
+const FileHeader& check_header(const MappedFile& file, BinaryFileKind kind)
+{
+    if (file.size() < sizeof(FileHeader)) fail("файл короче заголовка");
+    const auto& h = *reinterpret_cast<const FileHeader*>(file.data());
+    if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0) fail("неверная сигнатура");
+    if (h.byte_order != kByteOrderMark) fail("порядок байт не совпадает с порядком байт платформы");
+    if (h.version != kBinaryFormatVersion) fail("неподдерживаемая версия " + std::to_string(h.version));
+    if (h.kind != static_cast<std::uint16_t>(kind)) fail("файл содержит данные другого вида");
+    return h;
+}
+
+// Секция из count элементов T внутри файла с выравниванием под T
+template <typename T>
+span<const T> section(const MappedFile& file, std::uint64_t offset, std::uint64_t count)
+{
+    const std::uint64_t size = file.size();
+    if (offset % alignof(T) != 0 || offset > size || count > (size - offset) / sizeof(T)) {
+        fail("секция выходит за границы файла");
+    }
+    return {reinterpret_cast<const T*>(file.data() + offset), static_cast<std::size_t>(count)};
+}
+
+// Неубывающие смещения от 0 до limit
+void check_offsets(span<const std::uint64_t> offsets, std::uint64_t limit)
+{
+    if (offsets.empty() || offsets[0] != 0 || offsets.back() != limit) fail("неверная таблица смещений");
+    for (std::size_t i = 1; i < offsets.size(); ++i) {
+        if (offsets[i] < offsets[i - 1]) fail("неверная таблица смещений");
+    }
+}
+
+} // namespace
+
+// ===================================================WRITE==========================================================
+
+void write_points_file(const std::string& path, span<const Point> pts)
+{
+    Writer w(path);
+    w.begin();
+    FileHeader h{};
+    h.kind = static_cast<std::uint16_t>(BinaryFileKind::Points);
+    h.count = pts.size();
+    h.section[0] = w.begin_section();
+    w.write_array(pts);
+    w.finish(h);
+}
+
+void write_geo_points_file(const std::string& path, span<const GeoPoint> pts)
+{
+    Writer w(path);
+    w.begin();
+    FileHeader h{};
+    h.kind = static_cast<std::uint16_t>(BinaryFileKind::GeoPoints);
+    h.count = pts.size();
+
+    h.section[0] = w.begin_section();
+    write_column(w, pts, [](const GeoPoint& p) { return p.lat; });
+    h.section[1] = w.begin_section();
+    write_column(w, pts, [](const GeoPoint& p) { return p.lon; });
+    h.section[2] = w.begin_section();
+    write_column(w, pts, [](const GeoPoint& p) { return p.alt.value_or(0.0); });
+
+    h.section[3] = w.begin_section();
+    std::uint8_t bits = 0;
+    for (std::size_t i = 0; i < pts.size(); ++i) {
+        if (pts[i].alt) bits = static_cast<std::uint8_t>(bits | (1U << (i % 8)));
+        if (i % 8 == 7 || i + 1 == pts.size()) {
+            w.write(&bits, 1);
+            bits = 0;
+        }
+    }
+    w.finish(h);
+}
+
+void write_polygons_file(const std::string& path, span<const Polygon> polygons)
+{
+    Writer w(path);
+    w.begin();
+    FileHeader h{};
+    h.kind = static_cast<std::uint16_t>(BinaryFileKind::Polygons);
+    h.count = polygons.size();
+
+    h.section[0] = w.begin_section();
+    std::uint64_t rings = 0;
+    w.write(&rings, sizeof(rings));
+    for (const Polygon& poly: polygons) {
+        rings += 1 + poly.holes().size();
+        w.write(&rings, sizeof(rings));
+    }
+    h.aux_count = rings;
+
+    h.section[1] = w.begin_section();
+    std::uint64_t vertices = 0;
+    w.write(&vertices, sizeof(vertices));
+    for (const Polygon& poly: polygons) {
+        vertices += poly.vertices().size();
+        w.write(&vertices, sizeof(vertices));
+        for (const auto& hole: poly.holes()) {
+            vertices += hole.size();
+            w.write(&vertices, sizeof(vertices));
+        }
+    }
+
+    h.section[2] = w.begin_section();
+    for (const Polygon& poly: polygons) {
+        w.write_array(span<const Point>(poly.vertices()));
+        for (const auto& hole: poly.holes()) {
+            w.write_array(span<const Point>(hole));
+        }
+    }
+    w.finish(h);
+}
+
+void write_polygons_file(const std::string& path, const FlatPolygons& polygons)
+{
+    // Вид может быть вырезан из большего набора: смещения пишутся от его первого кольца и первой вершины
+    const std::size_t n = polygons.size();
+    const std::size_t ring0 = n ? polygons.polygon_rings[0] : 0;
+    const std::size_t ring_end = n ? polygons.polygon_rings[n] : 0;
+    const auto bad = [] { throw std::invalid_argument("write_polygons_file: неверная таблица смещений"); };
+    if (ring_end < ring0 || (n && ring_end >= polygons.ring_offsets.size())) bad();
+    for (std::size_t i = 0; i < n; ++i) {
+        if (polygons.polygon_rings[i + 1] < polygons.polygon_rings[i]) bad();
+    }
+    for (std::size_t r = ring0; r < ring_end; ++r) {
+        if (polygons.ring_offsets[r + 1] < polygons.ring_offsets[r]) bad();
+    }
+    const std::size_t point0 = n ? polygons.ring_offsets[ring0] : 0;
+    const std::size_t point_end = n ? polygons.ring_offsets[ring_end] : 0;
+    if (point_end > polygons.points.size()) bad();
+
+    Writer w(path);
+    w.begin();
+    FileHeader h{};
+    h.kind = static_cast<std::uint16_t>(BinaryFileKind::Polygons);
+    h.count = n;
+    h.aux_count = ring_end - ring0;
+
+    h.section[0] = w.begin_section();
+    for (std::size_t i = 0; i <= n; ++i) {
+        const std::uint64_t rings = n ? polygons.polygon_rings[i] - ring0 : 0;
+        w.write(&rings, sizeof(rings));
+    }
+
+    h.section[1] = w.begin_section();
+    for (std::size_t r = ring0; r <= ring_end; ++r) {
+        const std::uint64_t vertices = n ? polygons.ring_offsets[r] - point0 : 0;
+        w.write(&vertices, sizeof(vertices));
+    }
+
+    h.section[2] = w.begin_section();
+    w.write_array(polygons.points.subspan(point0, point_end - point0));
+    w.finish(h);
+}
+
+// ================================================MAPPED FILE=======================================================
+
+struct MappedFile::Impl {
+    const std::byte* data{nullptr};
+    std::size_t size{0};
+#if defined(_WIN32)
+    HANDLE file{INVALID_HANDLE_VALUE};
+    HANDLE mapping{nullptr};
+#endif
+
+    ~Impl()
+    {
+#if defined(_WIN32)
+        if (data) UnmapViewOfFile(data);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+#else
+        if (data) munmap(const_cast<std::byte*>(data), size);
+#endif
+    }
+};
+
+MappedFile::MappedFile(const std::string& path)
+    : impl_(std::make_unique<Impl>())
+{
+    auto fail_open = [&]() { throw std::runtime_error("Не удалось отобразить файл в память: " + path); };
+
+#if defined(_WIN32)
+    impl_->file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (impl_->file == INVALID_HANDLE_VALUE) fail_open();
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(impl_->file, &size)) fail_open();
+    impl_->size = static_cast<std::size_t>(size.QuadPart);
+    if (impl_->size == 0) return;
+    impl_->mapping = CreateFileMappingA(impl_->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!impl_->mapping) fail_open();
+    impl_->data = static_cast<const std::byte*>(MapViewOfFile(impl_->mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!impl_->data) fail_open();
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) fail_open();
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        fail_open();
+    }
+    impl_->size = static_cast<std::size_t>(st.st_size);
+    if (impl_->size > 0) {
+        void* p = ::mmap(nullptr, impl_->size, PROT_READ, MAP_SHARED, fd, 0);
+        if (p != MAP_FAILED) impl_->data = static_cast<const std::byte*>(p);
+    }
+    ::close(fd); // отображение держит файл само
+    if (impl_->size > 0 && !impl_->data) fail_open();
+#endif
+}
+
+MappedFile::~MappedFile() = default;
+MappedFile::MappedFile(MappedFile&& other) noexcept = default;
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept = default;
+
+const std::byte* MappedFile::data() const noexcept
+{
+    return impl_ ? impl_->data : nullptr;
+}
+
+std::size_t MappedFile::size() const noexcept
+{
+    return impl_ ? impl_->size : 0;
+}
+
+// ===================================================READ===========================================================
+
+PointsFile::PointsFile(const std::string& path)
+    : file_(path)
+{
+    const FileHeader& h = check_header(file_, BinaryFileKind::Points);
+    pts_ = section<Point>(file_, h.section[0], h.count);
+}
+
+GeoPointsFile::GeoPointsFile(const std::string& path)
+    : file_(path)
+{
+    const FileHeader& h = check_header(file_, BinaryFileKind::GeoPoints);
+    lat_ = section<double>(file_, h.section[0], h.count);
+    lon_ = section<double>(file_, h.section[1], h.count);
+    alt_ = section<double>(file_, h.section[2], h.count);
+    alt_valid_ = section<std::uint8_t>(file_, h.section[3], (h.count + 7) / 8);
+}
+
+std::optional<double> GeoPointsFile::alt(std::size_t i) const noexcept
+{
+    if (!has_alt(i)) return std::nullopt;
+    return alt_[i];
+}
+
+void GeoPointsFile::copy_to(span<GeoPoint> out) const
+{
+    if (out.size() != size()) {
+        throw std::invalid_argument("GeoPointsFile::copy_to: размер буфера не совпадает с числом точек");
+    }
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = at(i);
+    }
+}
+
+std::vector<GeoPoint> GeoPointsFile::to_vector() const
+{
+    std::vector<GeoPoint> out(size());
+    copy_to(out);
+    return out;
+}
+
+PolygonsFile::PolygonsFile(const std::string& path)
+    : file_(path)
+{
+    const FileHeader& h = check_header(file_, BinaryFileKind::Polygons);
+    if (h.count == static_cast<std::uint64_t>(-1) || h.aux_count == static_cast<std::uint64_t>(-1)) {
+        fail("неверное число элементов");
+    }
+    polygon_rings_ = section<std::uint64_t>(file_, h.section[0], h.count + 1);
+    ring_offsets_ = section<std::uint64_t>(file_, h.section[1], h.aux_count + 1);
+    check_offsets(polygon_rings_, h.aux_count);
+    for (std::size_t i = 0; i + 1 < polygon_rings_.size(); ++i) {
+        if (polygon_rings_[i + 1] == polygon_rings_[i]) fail("полигон без внешнего контура");
+    }
+    vertices_ = section<Point>(file_, h.section[2], ring_offsets_.back());
+    check_offsets(ring_offsets_, vertices_.size());
+}
+
+span<const Point> PolygonsFile::ring(std::size_t i, std::size_t r) const noexcept
+{
+    const auto k = static_cast<std::size_t>(polygon_rings_[i]) + r;
+    const auto begin = static_cast<std::size_t>(ring_offsets_[k]);
+    const auto end = static_cast<std::size_t>(ring_offsets_[k + 1]);
+    return vertices_.subspan(begin, end - begin);
+}
+
+Polygon PolygonsFile::polygon(std::size_t i) const
+{
+    const span<const Point> outer_ring = outer(i);
+    std::vector<std::vector<Point>> holes;
+    holes.reserve(ring_count(i) - 1);
+    for (std::size_t r = 1; r < ring_count(i); ++r) {
+        const span<const Point> hole = ring(i, r);
+        holes.emplace_back(hole.begin(), hole.end());
+    }
+    return Polygon(std::vector<Point>(outer_ring.begin(), outer_ring.end()), std::move(holes));
+}
+
+std::vector<Polygon> PolygonsFile::to_vector() const
+{
+    std::vector<Polygon> out;
+    out.reserve(size());
+    for (std::size_t i = 0; i < size(); ++i) {
+        out.push_back(polygon(i));
+    }
+    return out;
+}
+
+} // namespace mylib
@@ -0,0 +1,411 @@
+// src/coverage.cpp
+#include <mylib/coverage.h>
+
+#include <mylib/polygon_set.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace mylib {
+
+namespace {
+
+constexpr std::size_t kTileBits = 6;
+constexpr std::size_t kTileCells = std::size_t{1} << kTileBits; // 64: строка блока — одно слово
+constexpr std::size_t kMaxTiles = std::size_t{1} << 24;
+
+// Сектор веера на стыке отрезков не шире 45°
+constexpr double kFanStep = 0.25 * kPI;
+
+struct Tile {
+    std::array<std::uint64_t, kTileCells> inside{};
+    std::array<std::uint64_t, kTileCells> covered{};
+    std::array<std::uint64_t, kTileCells> pass{}; // закрашено текущим проходом
+    bool in_pass{false};
+};
+
+// Ячейки с центрами в [first, last] строки
+struct Span {
+    std::int64_t first;
+    std::int64_t last;
+};
+
+std::uint64_t bit_range(std::size_t b0, std::size_t b1) noexcept
+{
+    const std::uint64_t hi = b1 + 1 == kTileCells ? ~std::uint64_t{0} : (std::uint64_t{1} << (b1 + 1)) - 1;
+    return hi & ~((std::uint64_t{1} << b0) - 1);
+}
+
+// Номер ячейки из координаты сетки, ограниченный [lo, hi] до приведения к целому:
+// огромная или нечисловая координата не переполняет int64 (нечисловая даёт lo)
+std::int64_t clamp_cell(double u, std::int64_t lo, std::int64_t hi) noexcept
+{
+    if (!(u > static_cast<double>(lo))) return lo;
+    if (!(u < static_cast<double>(hi))) return hi;
+    return static_cast<std::int64_t>(u);
+}
+
+int popcount(std::uint64_t v) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(v);
+#else
+    int n = 0;
+    for (; v; v &= v - 1) ++n;
+    return n;
+#endif
+}
+
+void check_cell_size(double cell_size)
+{
+    if (!(cell_size > 0.0) || !std::isfinite(cell_size)) {
+        throw std::invalid_argument("CoverageAccumulator: размер ячейки должен быть положительным");
+    }
+}
+
+} // namespace
+
+struct CoverageAccumulator::Impl {
+    double cell;
+    Point origin;
+    std::size_t nx{0};
+    std::size_t ny{0};
+    std::size_t tiles_x{0};
+
+    // Растр поля построчно (CSR): строка j — spans[row_offsets[j], row_offsets[j + 1])
+    std::vector<std::size_t> row_offsets;
+    std::vector<Span> spans;
+    std::vector<std::unique_ptr<Tile>> tiles;
+    std::vector<Tile*> pass_tiles; // блоки с ненулевой маской текущего прохода
+
+    std::size_t field_cells{0};
+    std::size_t covered_cells{0};
+    std::size_t applied_cells{0};
+
+    Point pos; // последняя принятая позиция
+    bool has_pos{false};
+    Point dir; // направление предыдущего закрашенного отрезка
+    bool has_dir{false};
+
+    // Field — Polygon или PolygonView
+    template <typename Field>
+    Impl(const Field& field, double cell_size)
+        : cell(cell_size)
+    {
+        const BBox box = field.bbox();
+        if (box.empty() || field.vertices().size() < 3) {
+            throw std::invalid_argument("CoverageAccumulator: пустое поле");
+        }
+        origin = {box.min_x, box.min_y};
+        const double wx = std::floor((box.max_x - box.min_x) / cell) + 1.0;
+        const double wy = std::floor((box.max_y - box.min_y) / cell) + 1.0;
+        const double tx = std::ceil(wx / kTileCells);
+        const double ty = std::ceil(wy / kTileCells);
+        if (!(tx * ty <= static_cast<double>(kMaxTiles))) {
+            throw std::invalid_argument("CoverageAccumulator: слишком мелкая сетка для размеров поля");
+        }
+        nx = static_cast<std::size_t>(wx);
+        ny = static_cast<std::size_t>(wy);
+        tiles_x = static_cast<std::size_t>(tx);
+        tiles.resize(tiles_x * static_cast<std::size_t>(ty));
+        rasterize_field(field);
+    }
+
+    // Сетка: ячейка (i, j) — центр в origin + cell * (i + 0.5, j + 0.5)
+    [[nodiscard]] Point to_grid(const Point& p) const noexcept
+    {
+        return {(p.x - origin.x) / cell, (p.y - origin.y) / cell};
+    }
+
+    // Заливка строк по правилу чёт-нечет по всем кольцам; активные рёбра ведутся заметанием по y
+    template <typename Field>
+    void rasterize_field(const Field& field)
+    {
+        struct GridEdge {
+            Point a; // a.y < b.y
+            Point b;
+        };
+        std::vector<GridEdge> edges;
+        const auto add_ring = [&](span<const Point> ring) {
+            for (std::size_t i = 0, n = ring.size(); i < n && n >= 3; ++i) {
+                Point a = to_grid(ring[i]);
+                Point b = to_grid(ring[i + 1 == n ? 0 : i + 1]);
+                if (a.y == b.y) continue;
+                if (a.y > b.y) std::swap(a, b);
+                edges.push_back({a, b});
+            }
+        };
+        add_ring(field.vertices());
+        for (const auto& h: field.holes()) {
+            add_ring(h);
+        }
+        std::sort(edges.begin(), edges.end(), [](const GridEdge& l, const GridEdge& r) { return l.a.y < r.a.y; });
+
+        row_offsets.assign(1, 0);
+        std::vector<std::size_t> active;
+        std::vector<double> xs;
+        std::size_t next = 0;
+        for (std::size_t j = 0; j < ny; ++j) {
+            const double v = static_cast<double>(j) + 0.5;
+            while (next < edges.size() && edges[next].a.y <= v) {
+                active.push_back(next++);
+            }
+            active.erase(std::remove_if(active.begin(), active.end(), [&](std::size_t k) { return edges[k].b.y <= v; }),
+                         active.end());
+            xs.clear();
+            for (const std::size_t k: active) {
+                const GridEdge& e = edges[k];
+                xs.push_back(e.a.x + (v - e.a.y) * (e.b.x - e.a.x) / (e.b.y - e.a.y));
+            }
+            std::sort(xs.begin(), xs.end());
+            for (std::size_t k = 0; k + 1 < xs.size(); k += 2) {
+                const auto first = static_cast<std::int64_t>(std::max(0.0, std::ceil(xs[k] - 0.5)));
+                const auto last =
+                    static_cast<std::int64_t>(std::min(static_cast<double>(nx) - 1.0, std::floor(xs[k + 1] - 0.5)));
+                if (first <= last) {
+                    spans.push_back({first, last});
+                    field_cells += static_cast<std::size_t>(last - first + 1);
+                }
+            }
+            row_offsets.push_back(spans.size());
+        }
+    }
+
+    // Блок создаётся при первом касании, маска поля берётся из строк растра
+    Tile& tile(std::size_t tx, std::size_t ty)
+    {
+        std::unique_ptr<Tile>& t = tiles[ty * tiles_x + tx];
+        if (!t) {
+            t = std::make_unique<Tile>();
+            const auto i0 = static_cast<std::int64_t>(tx * kTileCells);
+            const auto i1 = i0 + static_cast<std::int64_t>(kTileCells) - 1;
+            for (std::size_t r = 0; r < kTileCells; ++r) {
+                const std::size_t j = ty * kTileCells + r;
+                if (j >= ny) break;
+                for (std::size_t s = row_offsets[j]; s < row_offsets[j + 1]; ++s) {
+                    const Span& sp = spans[s];
+                    if (sp.last < i0 || sp.first > i1) continue;
+                    t->inside[r] |= bit_range(static_cast<std::size_t>(std::max(sp.first, i0) - i0),
+                                              static_cast<std::size_t>(std::min(sp.last, i1) - i0));
+                }
+            }
+        }
+        return *t;
+    }
+
+    // Конец прохода: ячейки снова учитываются в applied_cells при следующем закрашивании
+    void end_pass() noexcept
+    {
+        for (Tile* t: pass_tiles) {
+            t->pass.fill(0);
+            t->in_pass = false;
+        }
+        pass_tiles.clear();
+        has_dir = false;
+    }
+
+    void mark_row(std::int64_t j, std::int64_t first, std::int64_t last)
+    {
+        if (j < 0 || j >= static_cast<std::int64_t>(ny)) return;
+        first = std::max<std::int64_t>(first, 0);
+        last = std::min<std::int64_t>(last, static_cast<std::int64_t>(nx) - 1);
+        if (first > last) return;
+
+        const auto row = static_cast<std::size_t>(j);
+        const std::size_t ty = row >> kTileBits;
+        const std::size_t r = row & (kTileCells - 1);
+        for (auto tx = static_cast<std::size_t>(first) >> kTileBits; tx <= static_cast<std::size_t>(last) >> kTileBits;
+             ++tx) {
+            const std::size_t i0 = tx << kTileBits;
+            const std::size_t b0 = static_cast<std::size_t>(first) > i0 ? static_cast<std::size_t>(first) - i0 : 0;
+            const std::size_t b1 = std::min(static_cast<std::size_t>(last) - i0, kTileCells - 1);
+            Tile& t = tile(tx, ty);
+            const std::uint64_t hit = bit_range(b0, b1) & t.inside[r];
+            if (!hit) continue;
+            applied_cells += static_cast<std::size_t>(popcount(hit & ~t.pass[r]));
+            covered_cells += static_cast<std::size_t>(popcount(hit & ~t.covered[r]));
+            t.covered[r] |= hit;
+            t.pass[r] |= hit;
+            if (!t.in_pass) {
+                t.in_pass = true;
+                pass_tiles.push_back(&t);
+            }
+        }
+    }
+
+    // Выпуклый многоугольник: по каждой строке — отрезок центров ячеек внутри
+    void fill_convex(std::initializer_list<Point> world)
+    {
+        std::array<Point, 4> g{};
+        std::size_t n = 0;
+        double vmin = std::numeric_limits<double>::infinity();
+        double vmax = -vmin;
+        for (const Point& p: world) {
+            g[n] = to_grid(p);
+            vmin = std::min(vmin, g[n].y);
+            vmax = std::max(vmax, g[n].y);
+            ++n;
+        }
+        const auto rows = static_cast<std::int64_t>(ny);
+        const auto cols = static_cast<std::int64_t>(nx);
+        const std::int64_t j0 = clamp_cell(std::ceil(vmin - 0.5), 0, rows);
+        const std::int64_t j1 = clamp_cell(std::floor(vmax - 0.5), -1, rows - 1);
+        for (std::int64_t j = j0; j <= j1; ++j) {
+            const double v = static_cast<double>(j) + 0.5;
+            double umin = std::numeric_limits<double>::infinity();
+            double umax = -umin;
+            for (std::size_t k = 0; k < n; ++k) {
+                const Point& a = g[k];
+                const Point& b = g[k + 1 == n ? 0 : k + 1];
+                if ((v < a.y && v < b.y) || (v > a.y && v > b.y)) continue;
+                if (a.y == b.y) {
+                    umin = std::min({umin, a.x, b.x});
+                    umax = std::max({umax, a.x, b.x});
+                    continue;
+                }
+                const double u = a.x + (v - a.y) * (b.x - a.x) / (b.y - a.y);
+                umin = std::min(umin, u);
+                umax = std::max(umax, u);
+            }
+            if (!(umin <= umax)) continue;
+            mark_row(j, clamp_cell(std::ceil(umin - 0.5), -1, cols), clamp_cell(std::floor(umax - 0.5), -1, cols));
+        }
+    }
+
+    void add(const Point& p, double width)
+    {
+        if (!(width >= 0.0) || !std::isfinite(width)) {
+            throw std::invalid_argument("CoverageAccumulator: ширина должна быть неотрицательным числом");
+        }
+        // Пропуск решения GNSS — разрыв прохода: следующая числовая позиция начинает новый участок
+        if (!std::isfinite(p.x) || !std::isfinite(p.y)) {
+            has_pos = false;
+            end_pass();
+            return;
+        }
+        if (!has_pos) {
+            pos = p;
+            has_pos = true;
+            end_pass();
+            return;
+        }
+        const Point a = std::exchange(pos, p);
+        if (width == 0.0) {
+            end_pass();
+            return;
+        }
+        const double len = dist(a, p);
+        if (len == 0.0) return; // стоянка: направление сохраняется
+        if (!std::isfinite(len)) {
+            end_pass(); // скачок за пределы представимых расстояний — выброс, не отрезок
+            return;
+        }
+
+        const double r = 0.5 * width;
+        const Point d{(p.x - a.x) / len, (p.y - a.y) / len};
+        const Point n{-d.y * r, d.x * r}; // левая нормаль
+        fill_convex({{a.x - n.x, a.y - n.y}, {p.x - n.x, p.y - n.y}, {p.x + n.x, p.y + n.y}, {a.x + n.x, a.y + n.y}});
+
+        // Веер с внешней стороны поворота закрывает клин между прямоугольниками соседних отрезков
+        if (has_dir) {
+            const double turn = std::atan2(dir.x * d.y - dir.y * d.x, dir.x * d.x + dir.y * d.y);
+            if (turn != 0.0) {
+                const double side = turn > 0.0 ? -r : r;
+                const Point start{-dir.y * side, dir.x * side};
+                const auto steps = static_cast<int>(std::ceil(std::abs(turn) / kFanStep));
+                Point q = start;
+                for (int k = 1; k <= steps; ++k) {
+                    const double ang = turn * k / steps;
+                    const Point q1{start.x * std::cos(ang) - start.y * std::sin(ang),
+                                   start.x * std::sin(ang) + start.y * std::cos(ang)};
+                    fill_convex({a, {a.x + q.x, a.y + q.y}, {a.x + q1.x, a.y + q1.y}});
+                    q = q1;
+                }
+            }
+        }
+        dir = d;
+        has_dir = true;
+    }
+};
+
+CoverageAccumulator::CoverageAccumulator(const Polygon& field, double cell_size)
+{
+    check_cell_size(cell_size);
+    impl_ = std::make_unique<Impl>(field, cell_size);
+}
+
+CoverageAccumulator::CoverageAccumulator(const PolygonView& field, double cell_size)
+{
+    check_cell_size(cell_size);
+    impl_ = std::make_unique<Impl>(field, cell_size);
+}
+
+CoverageAccumulator::~CoverageAccumulator() = default;
+CoverageAccumulator::CoverageAccumulator(CoverageAccumulator&&) noexcept = default;
+CoverageAccumulator& CoverageAccumulator::operator=(CoverageAccumulator&&) noexcept = default;
+
+void CoverageAccumulator::add(const Point& p, double width)
+{
+    impl_->add(p, width);
+}
+
+void CoverageAccumulator::add(span<const Point> pts, double width)
+{
+    for (const Point& p: pts) {
+        impl_->add(p, width);
+    }
+}
+
+void CoverageAccumulator::break_track() noexcept
+{
+    impl_->has_pos = false;
+    impl_->end_pass();
+}
+
+double CoverageAccumulator::covered_area() const noexcept
+{
+    return static_cast<double>(impl_->covered_cells) * impl_->cell * impl_->cell;
+}
+
+double CoverageAccumulator::applied_area() const noexcept
+{
+    return static_cast<double>(impl_->applied_cells) * impl_->cell * impl_->cell;
+}
+
+double CoverageAccumulator::field_area() const noexcept
+{
+    return static_cast<double>(impl_->field_cells) * impl_->cell * impl_->cell;
+}
+
+double CoverageAccumulator::coverage_ratio() const noexcept
+{
+    return impl_->field_cells ? static_cast<double>(impl_->covered_cells) / static_cast<double>(impl_->field_cells)
+                              : 0.0;
+}
+
+double CoverageAccumulator::cell_size() const noexcept
+{
+    return impl_->cell;
+}
+
+void CoverageAccumulator::reset() noexcept
+{
+    Impl& im = *impl_;
+    im.end_pass();
+    for (auto& t: im.tiles) {
+        if (t) t->covered.fill(0);
+    }
+    im.covered_cells = 0;
+    im.applied_cells = 0;
+    im.has_pos = false;
+    im.has_dir = false;
+}
+
+} // namespace mylib
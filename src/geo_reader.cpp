@@ -0,0 +1,422 @@
+// src/geo_reader.cpp
+#include <mylib/binary_format.h>
+#include <mylib/geo_reader.h>
+
+#include "text_parse.h"
+
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace mylib {
+
+namespace {
+
+std::string_view as_text(const MappedFile& file) noexcept
+{
+    return {reinterpret_cast<const char*>(file.data()), file.size()};
+}
+
+// Следующая точка CSV начиная с pos; false — конец текста
+bool next_csv_point(std::string_view text, std::size_t& pos, std::size_t& line, bool& skip_header, GeoPoint& out)
+{
+    while (pos < text.size()) {
+        const char* first = text.data() + pos;
+        const char* stop = text.data() + text.size();
+        const auto* nl = static_cast<const char*>(std::memchr(first, '\n', static_cast<std::size_t>(stop - first)));
+        const char* last = nl ? nl : stop;
+        pos = static_cast<std::size_t>(last - text.data()) + (nl ? 1 : 0);
+        ++line;
+
+        const detail::CsvLine kind = detail::parse_csv_line(first, last, out);
+        if (kind == detail::CsvLine::Skip) continue;
+        if (skip_header) {
+            skip_header = false;
+            continue;
+        }
+        if (kind == detail::CsvLine::Point) return true;
+
+        if (last != first && last[-1] == '\r') --last;
+        throw std::runtime_error("read_csv: ошибка разбора в строке " + std::to_string(line) + ": '"
+                                 + std::string(first, last) + "'");
+    }
+    return false;
+}
+
+// ---- GeoJSON ----
+
+constexpr int kMaxDepth = 256;
+
+enum class Geometry { None, Polygon, MultiPolygon, LineString, MultiLineString, Other };
+
+Geometry geometry_of(std::string_view type) noexcept
+{
+    if (type == "Polygon") return Geometry::Polygon;
+    if (type == "MultiPolygon") return Geometry::MultiPolygon;
+    if (type == "LineString") return Geometry::LineString;
+    if (type == "MultiLineString") return Geometry::MultiLineString;
+    return Geometry::Other;
+}
+
+// Рекурсивный спуск по тексту без построения дерева. Объект считается геометрией, если у него есть
+// "type" одного из поддерживаемых видов и "coordinates"; порядок ключей любой.
+class GeoJsonParser {
+public:
+    using Batch = std::function<void(const GeoJsonGeometries&)>;
+
+    GeoJsonParser(std::string_view text, GeoJsonGeometries& out, const Batch* on_batch, std::size_t batch_points)
+        : begin_(text.data())
+        , p_(text.data())
+        , end_(text.data() + text.size())
+        , out_(out)
+        , on_batch_(on_batch)
+        , batch_points_(batch_points)
+    {
+    }
+
+    void parse()
+    {
+        skip_ws();
+        parse_value(0);
+        skip_ws();
+        if (p_ != end_) fail("лишние символы после документа");
+        if (on_batch_ && (out_.polygon_count() > 0 || out_.line_count() > 0)) {
+            (*on_batch_)(out_);
+            out_.clear();
+        }
+    }
+
+private:
+    [[noreturn]] void fail(const char* what) const
+    {
+        throw std::runtime_error(std::string("GeoJSON: ") + what + " (смещение "
+                                 + std::to_string(static_cast<std::size_t>(p_ - begin_)) + ")");
+    }
+
+    void skip_ws() noexcept
+    {
+        while (p_ != end_ && (*p_ == ' ' || *p_ == '\n' || *p_ == '\r' || *p_ == '\t')) {
+            ++p_;
+        }
+    }
+
+    char peek() const
+    {
+        if (p_ == end_) fail("неожиданный конец документа");
+        return *p_;
+    }
+
+    void expect(char c)
+    {
+        if (peek() != c) fail("неожиданный символ");
+        ++p_;
+    }
+
+    // Содержимое строки без кавычек, экранирование не раскрывается
+    std::string_view parse_string()
+    {
+        expect('"');
+        const char* first = p_;
+        while (peek() != '"') {
+            if (*p_ == '\\') {
+                ++p_;
+                (void)peek(); // экранированный символ должен существовать
+            }
+            ++p_;
+        }
+        const std::string_view s(first, static_cast<std::size_t>(p_ - first));
+        ++p_;
+        return s;
+    }
+
+    double parse_number()
+    {
+        // Число JSON начинается с цифры или минуса перед цифрой; from_chars принял бы и nan, inf
+        const char* digit = (p_ != end_ && *p_ == '-') ? p_ + 1 : p_;
+        if (digit == end_ || *digit < '0' || *digit > '9') fail("ожидалось число");
+        double v = 0.0;
+        const auto [ptr, ec] = std::from_chars(p_, end_, v);
+        if (ec != std::errc{}) fail("ожидалось число");
+        p_ = ptr;
+        return v;
+    }
+
+    void parse_literal()
+    {
+        for (const std::string_view lit: {"true", "false", "null"}) {
+            if (static_cast<std::size_t>(end_ - p_) >= lit.size() && std::memcmp(p_, lit.data(), lit.size()) == 0) {
+                p_ += lit.size();
+                return;
+            }
+        }
+        (void)parse_number();
+    }
+
+    void parse_value(int depth)
+    {
+        if (depth > kMaxDepth) fail("слишком глубокая вложенность");
+        switch (peek()) {
+        case '{':
+            parse_object(depth);
+            break;
+        case '[':
+            ++p_;
+            skip_ws();
+            if (peek() == ']') {
+                ++p_;
+                break;
+            }
+            for (;;) {
+                skip_ws();
+                parse_value(depth + 1);
+                skip_ws();
+                if (peek() == ',') {
+                    ++p_;
+                    continue;
+                }
+                expect(']');
+                break;
+            }
+            break;
+        case '"':
+            (void)parse_string();
+            break;
+        default:
+            parse_literal();
+        }
+    }
+
+    void parse_object(int depth)
+    {
+        expect('{');
+        Geometry type = Geometry::None;
+        const char* deferred = nullptr; // "coordinates" встретились раньше "type"
+        bool parsed = false;
+
+        skip_ws();
+        if (peek() == '}') {
+            ++p_;
+            return;
+        }
+        for (;;) {
+            skip_ws();
+            const std::string_view key = parse_string();
+            skip_ws();
+            expect(':');
+            skip_ws();
+            if (key == "type" && peek() == '"') {
+                type = geometry_of(parse_string());
+            } else if (key == "coordinates" && type != Geometry::None && type != Geometry::Other) {
+                parse_coordinates(type);
+                parsed = true;
+            } else {
+                if (key == "coordinates") deferred = p_;
+                parse_value(depth + 1);
+            }
+            skip_ws();
+            if (peek() == ',') {
+                ++p_;
+                continue;
+            }
+            expect('}');
+            break;
+        }
+
+        if (!parsed && deferred && type != Geometry::None && type != Geometry::Other) {
+            const char* resume = std::exchange(p_, deferred);
+            parse_coordinates(type);
+            p_ = resume;
+            parsed = true;
+        }
+        if (parsed && on_batch_ && out_.points.size() + out_.line_points.size() >= batch_points_) {
+            (*on_batch_)(out_);
+            out_.clear();
+        }
+    }
+
+    // Последовательность "[ item, item, ... ]"; item разбирает элемент, стоя на его первом символе
+    template <typename Item>
+    void parse_array(Item&& item)
+    {
+        skip_ws();
+        expect('[');
+        skip_ws();
+        if (peek() == ']') {
+            ++p_;
+            return;
+        }
+        for (;;) {
+            skip_ws();
+            item();
+            skip_ws();
+            if (peek() == ',') {
+                ++p_;
+                continue;
+            }
+            expect(']');
+            return;
+        }
+    }
+
+    // [lon, lat(, alt, ...)]
+    void parse_position(std::vector<GeoPoint>& pts)
+    {
+        GeoPoint g;
+        std::size_t k = 0;
+        parse_array([&] {
+            const double v = parse_number();
+            if (k == 0) g.lon = v;
+            else if (k == 1) g.lat = v;
+            else if (k == 2) g.alt = v;
+            ++k;
+        });
+        if (k < 2) fail("в позиции меньше двух координат");
+        pts.push_back(g);
+    }
+
+    void parse_positions(std::vector<GeoPoint>& pts)
+    {
+        parse_array([&] { parse_position(pts); });
+    }
+
+    void parse_polygon()
+    {
+        const std::size_t rings_before = out_.ring_offsets.size();
+        parse_array([&] {
+            parse_positions(out_.points);
+            out_.ring_offsets.push_back(out_.points.size());
+        });
+        if (out_.ring_offsets.size() > rings_before) { // полигон без колец не добавляется
+            out_.polygon_rings.push_back(out_.ring_offsets.size() - 1);
+        }
+    }
+
+    void parse_line()
+    {
+        parse_positions(out_.line_points);
+        out_.line_offsets.push_back(out_.line_points.size());
+    }
+
+    void parse_coordinates(Geometry type)
+    {
+        switch (type) {
+        case Geometry::Polygon:
+            parse_polygon();
+            break;
+        case Geometry::MultiPolygon:
+            parse_array([&] { parse_polygon(); });
+            break;
+        case Geometry::LineString:
+            parse_line();
+            break;
+        case Geometry::MultiLineString:
+            parse_array([&] { parse_line(); });
+            break;
+        default:
+            break;
+        }
+    }
+
+    const char* begin_;
+    const char* p_;
+    const char* end_;
+    GeoJsonGeometries& out_;
+    const Batch* on_batch_;
+    std::size_t batch_points_;
+};
+
+} // namespace
+
+// ===================================================CSV============================================================
+
+void read_csv(std::string_view text, std::vector<GeoPoint>& out, const CsvReadOptions& options)
+{
+    out.clear();
+    std::size_t pos = 0;
+    std::size_t line = 0;
+    bool skip_header = options.has_header;
+    GeoPoint p;
+    while (next_csv_point(text, pos, line, skip_header, p)) {
+        out.push_back(p);
+    }
+}
+
+std::vector<GeoPoint> read_csv(std::string_view text, const CsvReadOptions& options)
+{
+    std::vector<GeoPoint> out;
+    read_csv(text, out, options);
+    return out;
+}
+
+void read_csv_file(const std::string& path, std::vector<GeoPoint>& out, const CsvReadOptions& options)
+{
+    const MappedFile file(path);
+    read_csv(as_text(file), out, options);
+}
+
+CsvBufferSource::CsvBufferSource(std::string_view text, const CsvReadOptions& options)
+    : text_(text)
+    , skip_header_(options.has_header)
+{
+}
+
+std::size_t CsvBufferSource::read(span<GeoPoint> out)
+{
+    std::size_t n = 0;
+    while (n < out.size() && next_csv_point(text_, pos_, line_, skip_header_, out[n])) {
+        ++n;
+    }
+    return n;
+}
+
+// =================================================GEOJSON==========================================================
+
+void GeoJsonGeometries::clear() noexcept
+{
+    points.clear();
+    ring_offsets.assign(1, 0);
+    polygon_rings.assign(1, 0);
+    line_points.clear();
+    line_offsets.assign(1, 0);
+}
+
+void read_geojson(std::string_view text, GeoJsonGeometries& out)
+{
+    out.clear();
+    GeoJsonParser(text, out, nullptr, 0).parse();
+}
+
+void read_geojson(std::string_view text, const std::function<void(const GeoJsonGeometries&)>& on_batch,
+                  std::size_t batch_points)
+{
+    GeoJsonGeometries buf;
+    GeoJsonParser(text, buf, &on_batch, batch_points).parse();
+}
+
+void read_geojson_file(const std::string& path, const std::function<void(const GeoJsonGeometries&)>& on_batch,
+                       std::size_t batch_points)
+{
+    const MappedFile file(path);
+    read_geojson(as_text(file), on_batch, batch_points);
+}
+
+Polygon to_polygon(const GeoJsonGeometries& geometries, std::size_t polygon, const IGeoPointToXY& projection,
+                   const GeoPoint& center)
+{
+    auto project = [&](span<const GeoPoint> ring) {
+        std::vector<Point> xy(ring.size());
+        projection.geo_to_xy_batch(center, ring, xy);
+        return xy;
+    };
+
+    std::vector<std::vector<Point>> holes;
+    holes.reserve(geometries.ring_count(polygon) - 1);
+    for (std::size_t r = 1; r < geometries.ring_count(polygon); ++r) {
+        holes.push_back(project(geometries.ring(polygon, r)));
+    }
+    return Polygon(project(geometries.ring(polygon, 0)), std::move(holes));
+}
+
+} // namespace mylib
@@ -1,9 +1,25 @@
 // src/geometry.cpp
 #include <mylib/geometry.h>
+#include <mylib/kernels.h>
+#include <mylib/projection.h>
 
+#include "instrumentation.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <locale>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #if defined(MYLIB_WITH_PROJ)
@@ -14,6 +30,7 @@ namespace mylib {
 
 double dist(const Point& a, const Point& b)
 {
+    MYLIB_PROBE_COUNT(Probe::Dist, 0);
     return std::hypot(b.x - a.x, b.y - a.y);
 }
 
@@ -24,13 +41,42 @@ double dot(double ax, double ay, double bx, double by)
 
 std::vector<double> polyline_lengths(const std::vector<Point>& pts)
 {
-    std::vector<double> s;
-    s.reserve(pts.empty() ? 1 : pts.size());
-    s.push_back(0.0);
+    std::vector<double> s(pts.empty() ? 1 : pts.size());
+    polyline_lengths(span<const Point>(pts), s);
+    return s;
+}
+
+void polyline_lengths(span<const Point> pts, span<double> out)
+{
+    if (out.size() != std::max<std::size_t>(pts.size(), 1)) {
+        throw std::invalid_argument("polyline_lengths: размер выходного буфера должен быть max(n, 1)");
+    }
+    MYLIB_PROBE_SCOPE(Probe::PolylineLengths, pts.size());
+    out[0] = 0.0;
+    // hypot напрямую, а не через dist: сегменты не засчитываются отдельными вызовами dist
     for (std::size_t i = 1; i < pts.size(); ++i) {
-        s.push_back(s.back() + dist(pts[i - 1], pts[i]));
+        out[i] = out[i - 1] + std::hypot(pts[i].x - pts[i - 1].x, pts[i].y - pts[i - 1].y);
+    }
+}
+
+void polyline_lengths(span<const double> xs, span<const double> ys, span<double> out)
+{
+    const std::size_t n = xs.size();
+    if (ys.size() != n) {
+        throw std::invalid_argument("polyline_lengths: размеры массивов x и y не совпадают");
+    }
+    if (out.size() != std::max<std::size_t>(n, 1)) {
+        throw std::invalid_argument("polyline_lengths: размер выходного буфера должен быть max(n, 1)");
+    }
+    MYLIB_PROBE_SCOPE(Probe::PolylineLengths, n);
+    out[0] = 0.0;
+    if (n < 2) return;
+
+    // Длины сегментов пишутся в out[1..n), затем на месте превращаются в префиксные суммы
+    segment_lengths_soa(xs, ys, out.subspan(1));
+    for (std::size_t i = 1; i < n; ++i) {
+        out[i] += out[i - 1];
     }
-    return s;
 }
 
 Point point_on_path(const std::vector<Point>& pts, double distance)
@@ -41,6 +87,7 @@ Point point_on_path(const std::vector<Point>& pts, double distance)
     if (distance < 0.0) {
         throw std::invalid_argument("Дистанция не может быть отрицательной");
     }
+    MYLIB_PROBE_SCOPE(Probe::PointOnPath, pts.size());
 
     const std::vector<double> s = polyline_lengths(pts);
     const double length = s.back();
@@ -79,33 +126,215 @@ Point point_on_path(const std::vector<Point>& pts, double distance)
     const double y_ = p1.y + t * (p2.y - p1.y);
     return Point{x_, y_};
 }
+
+namespace {
+
+void drop_closing_vertex(std::vector<Point>& v) noexcept
+{
+    if (v.size() >= 2 && v.front() == v.back()) {
+        v.pop_back(); // убираем дублирующую последнюю вершину
+    }
+}
+
+double ring_twice_area_long_double(span<const Point> ring) noexcept
+{
+    const std::size_t n = ring.size();
+    const Point o = ring[0];
+    long double s = 0.0L; // уменьшение накопления погрешности
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        const long double x1 = ring[i].x - o.x, y1 = ring[i].y - o.y;
+        const long double x2 = ring[i + 1].x - o.x, y2 = ring[i + 1].y - o.y;
+        s += x1 * y2 - x2 * y1;
+    }
+    // Замыкающее ребро (n-1, 0) в локальных координатах равно нулю: вершина 0 — начало координат
+    return static_cast<double>(s);
+}
+
+} // namespace
+
+double ring_signed_area(span<const Point> ring, AreaSummation method)
+{
+    if (ring.size() < 3) return 0.0;
+    MYLIB_PROBE_SCOPE(Probe::RingArea, ring.size());
+    const double twice = method == AreaSummation::LongDouble ? ring_twice_area_long_double(ring)
+                                                             : detail::ring_twice_area(ring);
+    return 0.5 * twice;
+}
+
 Polygon::Polygon(std::vector<Point> vertices)
     : vertices_(std::move(vertices))
 {
-    if (vertices_.size() >= 2 && vertices_.front() == vertices_.back()) {
-        vertices_.pop_back(); // убираем дублирующую последнюю вершину
+    drop_closing_vertex(vertices_);
+}
+
+Polygon::Polygon(std::vector<Point> vertices, std::vector<std::vector<Point>> holes)
+    : Polygon(std::move(vertices))
+{
+    set_holes(std::move(holes));
+}
+
+Polygon::Polygon(const Polygon& other)
+    : vertices_(other.vertices_)
+    , holes_(other.holes_)
+{
+    copy_cache_from(other);
+}
+
+Polygon::Polygon(Polygon&& other) noexcept
+    : vertices_(std::move(other.vertices_))
+    , holes_(std::move(other.holes_))
+{
+    copy_cache_from(other);
+    other.invalidate();
+}
+
+Polygon& Polygon::operator=(const Polygon& other)
+{
+    if (this != &other) {
+        vertices_ = other.vertices_;
+        holes_ = other.holes_;
+        copy_cache_from(other);
     }
+    return *this;
 }
 
-double Polygon::area() const noexcept
+Polygon& Polygon::operator=(Polygon&& other) noexcept
 {
-    const std::size_t n = vertices_.size();
-    if (n < 3) return 0.0;
+    if (this != &other) {
+        vertices_ = std::move(other.vertices_);
+        holes_ = std::move(other.holes_);
+        copy_cache_from(other);
+        other.invalidate();
+    }
+    return *this;
+}
 
-    long double s = 0.0L; // уменьшение накопления погрешности
-    for (std::size_t i = 0; i < n; ++i) {
-        const Point& p1 = vertices_[i];
-        const Point& p2 = vertices_[(i + 1) % n];
-        s += static_cast<long double>(p1.x) * p2.y
-           - static_cast<long double>(p2.x) * p1.y;
+void Polygon::copy_cache_from(const Polygon& other) noexcept
+{
+    if (other.state_.load(std::memory_order_acquire) == kReady) {
+        metrics_ = other.metrics_;
+        state_.store(kReady, std::memory_order_release);
+    } else {
+        state_.store(kStale, std::memory_order_relaxed);
+    }
+}
+
+void Polygon::set_vertices(std::vector<Point> vertices)
+{
+    vertices_ = std::move(vertices);
+    drop_closing_vertex(vertices_);
+    invalidate();
+}
+
+void Polygon::set_vertex(std::size_t i, const Point& p)
+{
+    if (i >= vertices_.size()) {
+        throw std::out_of_range("Polygon::set_vertex: индекс вершины вне диапазона");
+    }
+    vertices_[i] = p;
+    invalidate();
+}
+
+void Polygon::insert_vertex(std::size_t i, const Point& p)
+{
+    if (i > vertices_.size()) {
+        throw std::out_of_range("Polygon::insert_vertex: индекс вершины вне диапазона");
+    }
+    vertices_.insert(vertices_.begin() + static_cast<std::ptrdiff_t>(i), p);
+    invalidate();
+}
+
+void Polygon::erase_vertex(std::size_t i)
+{
+    if (i >= vertices_.size()) {
+        throw std::out_of_range("Polygon::erase_vertex: индекс вершины вне диапазона");
+    }
+    vertices_.erase(vertices_.begin() + static_cast<std::ptrdiff_t>(i));
+    invalidate();
+}
+
+void Polygon::set_holes(std::vector<std::vector<Point>> holes)
+{
+    holes_ = std::move(holes);
+    for (auto& hole: holes_) {
+        drop_closing_vertex(hole);
     }
-    return std::abs(static_cast<double>(s * 0.5L));
+    invalidate();
+}
+
+void Polygon::add_hole(std::vector<Point> hole)
+{
+    drop_closing_vertex(hole);
+    holes_.push_back(std::move(hole));
+    invalidate();
+}
+
+Polygon::Metrics Polygon::metrics() const noexcept
+{
+    if (state_.load(std::memory_order_acquire) == kReady) {
+        return metrics_;
+    }
+    MYLIB_PROBE_SCOPE(Probe::PolygonMetrics, vertices_.size());
+
+    const Metrics m = detail::compute_polygon_metrics(1 + holes_.size(), [this](std::size_t r) {
+        return span<const Point>(r == 0 ? vertices_ : holes_[r - 1]);
+    });
+
+    std::uint8_t expected = kStale;
+    if (state_.compare_exchange_strong(expected, kComputing, std::memory_order_acquire)) {
+        metrics_ = m;
+        state_.store(kReady, std::memory_order_release);
+    }
+    return m;
+}
+
+bool Polygon::contains(const Point& p) const noexcept
+{
+    if (vertices_.size() < 3) return false;
+    MYLIB_PROBE_SCOPE(Probe::PolygonContains, vertices_.size());
+    if (!bbox().contains(p)) return false;
+
+    const auto ring = [this](std::size_t r) { return span<const Point>(r == 0 ? vertices_ : holes_[r - 1]); };
+    return detail::rings_contain(1 + holes_.size(), ring, p);
 }
 // ===================================================GEO2XY=========================================================
 
+namespace {
+
+void check_batch_sizes(const char* where, std::size_t in_size, std::size_t out_size)
+{
+    if (in_size != out_size) {
+        throw std::invalid_argument(std::string(where) + ": размеры входного и выходного буферов не совпадают");
+    }
+}
+
+} // namespace
+
+void IGeoPointToXY::geo_to_xy_batch(const GeoPoint& center, span<const GeoPoint> in, span<Point> out) const
+{
+    check_batch_sizes("geo_to_xy_batch", in.size(), out.size());
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        out[i] = geo_to_xy(center, in[i]);
+    }
+}
+
+GeoPoint IGeoPointToXY::xy_to_geo(const GeoPoint&, const Point&) const
+{
+    throw std::logic_error("IGeoPointToXY::xy_to_geo: обратное преобразование не поддерживается");
+}
+
+void IGeoPointToXY::xy_to_geo_batch(const GeoPoint& center, span<const Point> in, span<GeoPoint> out) const
+{
+    check_batch_sizes("xy_to_geo_batch", in.size(), out.size());
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        out[i] = xy_to_geo(center, in[i]);
+    }
+}
+
 // ===== Equirectangular (сферическое приближение) =====
 Point GeoToXYEquirectangular::geo_to_xy(const GeoPoint& center, const GeoPoint& geo_point) const
 {
+    MYLIB_PROBE_COUNT(Probe::EquirectForward, 1);
     const double lon0 = deg2rad(center.lon);
     const double lat0 = deg2rad(center.lat);
     const double lon  = deg2rad(geo_point.lon);
@@ -116,142 +345,677 @@ Point GeoToXYEquirectangular::geo_to_xy(const GeoPoint& center, const GeoPoint&
     return Point{x, y};
 }
 
-// ===== AEQD через PROJ (если доступно) =====
-Point GeoToXYAeqd::geo_to_xy(const GeoPoint& center, const GeoPoint& geo_point) const
+void GeoToXYEquirectangular::geo_to_xy_batch(const GeoPoint& center,
+                                              span<const GeoPoint> in,
+                                              span<Point> out) const
 {
+    check_batch_sizes("GeoToXYEquirectangular::geo_to_xy_batch", in.size(), out.size());
+    MYLIB_PROBE_SCOPE(Probe::EquirectForward, in.size());
+
+    const double lon0 = deg2rad(center.lon);
+    const double lat0 = deg2rad(center.lat);
+    const double cos_lat0 = std::cos(lat0);
+
+    // Порядок операций как в geo_to_xy — результат побитово совпадает с поточечным
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        const double lon = deg2rad(in[i].lon);
+        const double lat = deg2rad(in[i].lat);
+        out[i] = Point{R * (lon - lon0) * cos_lat0, R * (lat - lat0)};
+    }
+}
+
+GeoPoint GeoToXYEquirectangular::xy_to_geo(const GeoPoint& center, const Point& xy) const
+{
+    MYLIB_PROBE_COUNT(Probe::EquirectInverse, 1);
+    const double lon0 = deg2rad(center.lon);
+    const double lat0 = deg2rad(center.lat);
+
+    const double lon = lon0 + xy.x / (R * std::cos(lat0));
+    const double lat = lat0 + xy.y / R;
+    return GeoPoint{rad2deg(lat), rad2deg(lon), std::nullopt};
+}
+
+void GeoToXYEquirectangular::xy_to_geo_batch(const GeoPoint& center, span<const Point> in, span<GeoPoint> out) const
+{
+    check_batch_sizes("GeoToXYEquirectangular::xy_to_geo_batch", in.size(), out.size());
+    MYLIB_PROBE_SCOPE(Probe::EquirectInverse, in.size());
+
+    const double lon0 = deg2rad(center.lon);
+    const double lat0 = deg2rad(center.lat);
+    const double r_cos_lat0 = R * std::cos(lat0);
+
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        const double lon = lon0 + in[i].x / r_cos_lat0;
+        const double lat = lat0 + in[i].y / R;
+        out[i] = GeoPoint{rad2deg(lat), rad2deg(lon), std::nullopt};
+    }
+}
+
+// ===== Проекции AEQD и UTM =====
+ProjectorKey ProjectorKey::aeqd(const GeoPoint& center, ProjectorBackend backend)
+{
+    if (!std::isfinite(center.lat) || !std::isfinite(center.lon)) {
+        throw std::invalid_argument("ProjectorKey::aeqd: координаты центра должны быть числами");
+    }
+    ProjectorKey key;
+    key.kind = ProjectionKind::Aeqd;
+    key.lat0 = center.lat;
+    key.lon0 = center.lon;
+    key.backend = backend;
+    return key;
+}
+
+ProjectorKey ProjectorKey::utm(int zone, bool north, ProjectorBackend backend) noexcept
+{
+    ProjectorKey key;
+    key.kind = ProjectionKind::Utm;
+    key.zone = zone;
+    key.north = north;
+    key.backend = backend;
+    return key;
+}
+
+namespace {
+
+std::string projector_definition(const ProjectorKey& key)
+{
+    std::ostringstream os;
+    os.imbue(std::locale::classic());
+    os.precision(17); // полная точность double: разные центры не сливаются в одну строку
+    if (key.kind == ProjectionKind::Aeqd) {
+        os << "+proj=aeqd +lat_0=" << key.lat0 << " +lon_0=" << key.lon0
+           << " +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs";
+    } else {
+        os << "+proj=utm +zone=" << key.zone << (key.north ? "" : " +south") << " +datum=WGS84 +units=m +no_defs";
+    }
+    return os.str();
+}
+
+struct ProjectorKeyHash {
+    std::size_t operator()(const ProjectorKey& key) const noexcept
+    {
+        std::size_t h = std::hash<int>{}(static_cast<int>(key.kind));
+        const auto mix = [&h](std::size_t v) { h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2); };
+        mix(std::hash<double>{}(key.lat0));
+        mix(std::hash<double>{}(key.lon0));
+        mix(std::hash<int>{}(key.zone));
+        mix(std::hash<bool>{}(key.north));
+        mix(std::hash<int>{}(static_cast<int>(key.backend)));
+        return h;
+    }
+};
+
+} // namespace
+
+#if defined(MYLIB_WITH_PROJ)
+namespace {
+
+// Контекст PROJ нельзя использовать из нескольких потоков одновременно: у каждого потока своя пара
+struct ThreadPipeline {
+    PJ_CONTEXT* ctx{nullptr};
+    PJ* pj{nullptr};
+    std::weak_ptr<const void> owner; // истекает вместе с проекцией
+
+    ThreadPipeline() = default;
+    ThreadPipeline(const ThreadPipeline&) = delete;
+    ThreadPipeline& operator=(const ThreadPipeline&) = delete;
+
+    ~ThreadPipeline()
+    {
+        if (pj) proj_destroy(pj);
+        if (ctx) proj_context_destroy(ctx);
+    }
+};
+
+// Номера проекций не переиспользуются, поэтому запись разрушенной проекции не совпадёт с новой
+std::atomic<std::uint64_t> g_next_projector_id{1};
+
+// Конвейеры вызывающего потока по номеру проекции; освобождаются при завершении потока
+std::unordered_map<std::uint64_t, std::unique_ptr<ThreadPipeline>>& thread_pipelines()
+{
+    thread_local std::unordered_map<std::uint64_t, std::unique_ptr<ThreadPipeline>> pipelines;
+    return pipelines;
+}
+
+} // namespace
+#endif
+
+struct GeoProjector::Impl {
+    ProjectorKey key;
+    std::string definition;
+    // Встроенная реализация: заполнена ровно одна из проекций
+    std::optional<AzimuthalEquidistant> aeqd;
+    std::optional<TransverseMercator> tm;
+
+    [[nodiscard]] bool native() const noexcept { return key.backend == ProjectorBackend::Native; }
+
+#if defined(MYLIB_WITH_PROJ)
+    const std::uint64_t id{g_next_projector_id.fetch_add(1, std::memory_order_relaxed)};
+    const std::shared_ptr<const void> alive{std::make_shared<char>()};
+
+    // Проекция как одиночная операция PROJ: вход — lon/lat в радианах, выход — метры.
+    // Датум источника и назначения совпадает (WGS84), поэтому промежуточный crs_to_crs не нужен.
+    [[nodiscard]] std::unique_ptr<ThreadPipeline> create_pipeline() const
+    {
+        MYLIB_PROBE_SCOPE(Probe::ProjPipelineCreate, 0);
+        auto node = std::make_unique<ThreadPipeline>();
+        node->owner = alive;
+        node->ctx = proj_context_create();
+        if (!node->ctx) throw std::runtime_error("GeoProjector: proj_context_create() == nullptr");
+        node->pj = proj_create(node->ctx, definition.c_str());
+        if (!node->pj) throw std::runtime_error("GeoProjector: proj_create() failed: " + definition);
+        return node;
+    }
+
+    // Конвейер вызывающего потока: поиск в таблице потока, без общих данных и блокировок
+    PJ* local() const
+    {
+        auto& pipelines = thread_pipelines();
+        const auto it = pipelines.find(id);
+        if (it != pipelines.end()) return it->second->pj;
+
+        // Первое обращение потока: заодно освобождаем конвейеры уже разрушенных проекций
+        for (auto p = pipelines.begin(); p != pipelines.end();) {
+            p = p->second->owner.expired() ? pipelines.erase(p) : std::next(p);
+        }
+        return pipelines.emplace(id, create_pipeline()).first->second->pj;
+    }
+#endif
+};
+
+GeoProjector::GeoProjector(const ProjectorKey& key)
+    : impl_(std::make_unique<Impl>())
+{
+    MYLIB_PROBE_SCOPE(Probe::ProjectorCreate, 0);
+    // Ключ с NaN не равен сам себе: в кэше и реестре каждый поиск строил бы новую проекцию
+    if (key.kind == ProjectionKind::Aeqd && (!std::isfinite(key.lat0) || !std::isfinite(key.lon0))) {
+        throw std::invalid_argument("GeoProjector: координаты центра AEQD должны быть числами");
+    }
+    impl_->key = key;
+    impl_->definition = projector_definition(key);
+    if (impl_->native()) {
+        if (key.kind == ProjectionKind::Aeqd) {
+            impl_->aeqd.emplace(GeoPoint{key.lat0, key.lon0, std::nullopt});
+        } else {
+            impl_->tm.emplace(TransverseMercator::utm(key.zone, key.north));
+        }
+        return;
+    }
 #ifndef MYLIB_WITH_PROJ
-    (void)center;
-    (void)geo_point;
-    throw std::runtime_error("GeoToXYAeqd: требуется сборка с PROJ (определите MYLIB_WITH_PROJ и линкуйте libproj)");
+    throw std::runtime_error("GeoProjector: требуется сборка с PROJ (определите MYLIB_WITH_PROJ и линкуйте libproj)");
 #else
-    // Минимальная обёртка над PROJ C-API
-    // Требуются заголовки proj.h и линковка с -lproj
-    PJ_CONTEXT* C = proj_context_create();
-    if (!C) throw std::runtime_error("GeoToXYAeqd: proj_context_create() == nullptr");
-
-    const std::string proj4 =
-        std::string("+proj=aeqd +lat_0=") + std::to_string(center.lat) +
-        " +lon_0=" + std::to_string(center.lon) +
-        " +x_0=0 +y_0=0 +datum=WGS84 +units=m +no_defs";
-
-    PJ* src = proj_create(C, "+proj=longlat +datum=WGS84 +no_defs");
-    PJ* dst = proj_create(C, proj4.c_str());
-    if (!src || !dst) {
-        if (src) proj_destroy(src);
-        if (dst) proj_destroy(dst);
-        proj_context_destroy(C);
-        throw std::runtime_error("GeoToXYAeqd: proj_create() failed");
-    }
-
-    PJ* P = proj_create_crs_to_crs_from_pj(C, src, dst, nullptr, nullptr);
-    if (!P) {
-        proj_destroy(src);
-        proj_destroy(dst);
-        proj_context_destroy(C);
-        throw std::runtime_error("GeoToXYAeqd: proj_create_crs_to_crs_from_pj() failed");
-    }
-
-    // always_xy=true аналог: используем proj_normalize_for_visualization
-    PJ* Pxy = proj_normalize_for_visualization(C, P);
-    if (!Pxy) {
-        proj_destroy(P);
-        proj_destroy(src);
-        proj_destroy(dst);
-        proj_context_destroy(C);
-        throw std::runtime_error("GeoToXYAeqd: proj_normalize_for_visualization() failed");
-    }
+    // Конвейер строящего потока заодно проверяет определение
+    impl_->local();
+#endif
+}
+
+GeoProjector::~GeoProjector() = default;
+GeoProjector::GeoProjector(GeoProjector&&) noexcept = default;
+GeoProjector& GeoProjector::operator=(GeoProjector&&) noexcept = default;
+
+const ProjectorKey& GeoProjector::key() const noexcept
+{
+    return impl_->key;
+}
+
+std::string GeoProjector::definition() const
+{
+    return impl_->definition;
+}
 
+Point GeoProjector::forward(const GeoPoint& geo_point) const
+{
+    if (impl_->native()) {
+        MYLIB_PROBE_COUNT(Probe::ProjectorForward, 1);
+        return impl_->tm ? impl_->tm->forward(geo_point) : impl_->aeqd->forward(geo_point);
+    }
+#ifndef MYLIB_WITH_PROJ
+    throw std::runtime_error("GeoProjector: требуется сборка с PROJ (определите MYLIB_WITH_PROJ и линкуйте libproj)");
+#else
     PJ_COORD in;
     in.lpzt.lam = deg2rad(geo_point.lon);
     in.lpzt.phi = deg2rad(geo_point.lat);
     in.lpzt.z = 0.0;
     in.lpzt.t = 0.0;
 
-    PJ_COORD out = proj_trans(Pxy, PJ_FWD, in);
+    MYLIB_PROBE_COUNT(Probe::ProjectorForward, 1);
+    const PJ_COORD out = proj_trans(impl_->local(), PJ_FWD, in);
+    return Point{static_cast<double>(out.xy.x), static_cast<double>(out.xy.y)};
+#endif
+}
+
+void GeoProjector::forward(span<const GeoPoint> in, span<Point> out) const
+{
+    check_batch_sizes("GeoProjector::forward", in.size(), out.size());
+    if (impl_->native()) {
+        MYLIB_PROBE_SCOPE(Probe::ProjectorForward, in.size());
+        if (impl_->tm) {
+            impl_->tm->forward(in, out);
+        } else {
+            impl_->aeqd->forward(in, out);
+        }
+        return;
+    }
+#ifndef MYLIB_WITH_PROJ
+    throw std::runtime_error("GeoProjector: требуется сборка с PROJ (определите MYLIB_WITH_PROJ и линкуйте libproj)");
+#else
+    if (in.empty()) return;
+    MYLIB_PROBE_SCOPE(Probe::ProjectorForward, in.size());
 
-    proj_destroy(Pxy);
-    proj_destroy(P);
-    proj_destroy(src);
-    proj_destroy(dst);
-    proj_context_destroy(C);
+    // Радианы пишем прямо в выходной буфер и преобразуем его на месте
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        out[i] = Point{deg2rad(in[i].lon), deg2rad(in[i].lat)};
+    }
 
-    return Point{static_cast<double>(out.xy.x), static_cast<double>(out.xy.y)};
+    proj_trans_generic(impl_->local(), PJ_FWD,
+                       &out[0].x, sizeof(Point), out.size(),
+                       &out[0].y, sizeof(Point), out.size(),
+                       nullptr, 0, 0,
+                       nullptr, 0, 0);
 #endif
 }
 
-// ===== UTM через PROJ (если доступно) =====
-int GeoToXYUtm::utm_zone_from_lon(double lon_deg)
+GeoPoint GeoProjector::inverse(const Point& xy) const
 {
-    return static_cast<int>(std::floor((lon_deg + 180.0) / 6.0)) + 1;
+    if (impl_->native()) {
+        MYLIB_PROBE_COUNT(Probe::ProjectorInverse, 1);
+        return impl_->tm ? impl_->tm->inverse(xy) : impl_->aeqd->inverse(xy);
+    }
+#ifndef MYLIB_WITH_PROJ
+    throw std::runtime_error("GeoProjector: требуется сборка с PROJ (определите MYLIB_WITH_PROJ и линкуйте libproj)");
+#else
+    PJ_COORD in;
+    in.xyzt.x = xy.x;
+    in.xyzt.y = xy.y;
+    in.xyzt.z = 0.0;
+    in.xyzt.t = 0.0;
+
+    MYLIB_PROBE_COUNT(Probe::ProjectorInverse, 1);
+    const PJ_COORD out = proj_trans(impl_->local(), PJ_INV, in);
+    return GeoPoint{rad2deg(out.lp.phi), rad2deg(out.lp.lam), std::nullopt};
+#endif
 }
 
-Point GeoToXYUtm::geo_to_xy(const GeoPoint& center, const GeoPoint& geo_point) const
+void GeoProjector::inverse(span<const Point> in, span<GeoPoint> out) const
 {
+    check_batch_sizes("GeoProjector::inverse", in.size(), out.size());
+    if (impl_->native()) {
+        MYLIB_PROBE_SCOPE(Probe::ProjectorInverse, in.size());
+        if (impl_->tm) {
+            impl_->tm->inverse(in, out);
+        } else {
+            impl_->aeqd->inverse(in, out);
+        }
+        return;
+    }
 #ifndef MYLIB_WITH_PROJ
-    (void)center;
-    (void)geo_point;
-    throw std::runtime_error("GeoToXYUtm: требуется сборка с PROJ (определите MYLIB_WITH_PROJ и линкуйте libproj)");
+    throw std::runtime_error("GeoProjector: требуется сборка с PROJ (определите MYLIB_WITH_PROJ и линкуйте libproj)");
 #else
-    PJ_CONTEXT* C = proj_context_create();
-    if (!C) throw std::runtime_error("GeoToXYUtm: proj_context_create() == nullptr");
-
-    const int zone = utm_zone_from_lon(center.lon);
-    const bool north = (center.lat >= 0.0);
-    const int epsg = (north ? 32600 : 32700) + zone;
-
-    // Источник: WGS84 lon/lat
-    PJ* src = proj_create(C, "+proj=longlat +datum=WGS84 +no_defs");
-
-    // Назначение: UTM по EPSG
-    // std::string dst_str = std::string("+init=EPSG:") + std::to_string(epsg);
-    // // Начиная с PROJ 6+ рекомендуется использовать "+proj=utm ..." — но init тоже поддерживается.
-    // PJ* dst = proj_create(C, dst_str.c_str());
-
-    // вместо "+init=EPSG:326xx/327xx"
-    std::string dst_proj4 = std::string("+proj=utm +zone=") + std::to_string(zone)
-                          + (center.lat >= 0.0 ? "" : " +south")
-                          + " +datum=WGS84 +units=m +no_defs";
-    PJ* dst = proj_create(C, dst_proj4.c_str());
-    if (!src || !dst) {
-        if (src) proj_destroy(src);
-        if (dst) proj_destroy(dst);
-        proj_context_destroy(C);
-        throw std::runtime_error("GeoToXYUtm: proj_create() failed");
-    }
-
-    PJ* P = proj_create_crs_to_crs_from_pj(C, src, dst, nullptr, nullptr);
-    if (!P) {
-        proj_destroy(src);
-        proj_destroy(dst);
-        proj_context_destroy(C);
-        throw std::runtime_error("GeoToXYUtm: proj_create_crs_to_crs_from_pj() failed");
-    }
-
-    PJ* Pxy = proj_normalize_for_visualization(C, P);
-    if (!Pxy) {
-        proj_destroy(P);
-        proj_destroy(src);
-        proj_destroy(dst);
-        proj_context_destroy(C);
-        throw std::runtime_error("GeoToXYUtm: proj_normalize_for_visualization() failed");
+    if (in.empty()) return;
+    MYLIB_PROBE_SCOPE(Probe::ProjectorInverse, in.size());
+
+    // x -> поле lon, y -> поле lat; PJ_INV на месте даёт в них lam и phi (радианы)
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        out[i] = GeoPoint{in[i].y, in[i].x, std::nullopt};
     }
 
-    PJ_COORD in;
-    in.lpzt.lam = deg2rad(geo_point.lon);
-    in.lpzt.phi = deg2rad(geo_point.lat);
-    in.lpzt.z = 0.0;
-    in.lpzt.t = 0.0;
+    proj_trans_generic(impl_->local(), PJ_INV,
+                       &out[0].lon, sizeof(GeoPoint), out.size(),
+                       &out[0].lat, sizeof(GeoPoint), out.size(),
+                       nullptr, 0, 0,
+                       nullptr, 0, 0);
+
+    for (GeoPoint& g: out) {
+        g.lat = rad2deg(g.lat);
+        g.lon = rad2deg(g.lon);
+    }
+#endif
+}
 
-    PJ_COORD out = proj_trans(Pxy, PJ_FWD, in);
+struct ProjectorCache::Impl {
+    std::size_t capacity;
+    mutable std::mutex mutex;
+    std::unordered_map<ProjectorKey, std::shared_ptr<const GeoProjector>, ProjectorKeyHash> map;
+    std::deque<ProjectorKey> order; // порядок вставки для вытеснения
+    std::uint64_t hits{0};
+    std::uint64_t misses{0};
+};
+
+ProjectorCache::ProjectorCache(std::size_t capacity)
+    : impl_(std::make_unique<Impl>())
+{
+    impl_->capacity = std::max<std::size_t>(capacity, 1);
+}
 
-    proj_destroy(Pxy);
-    proj_destroy(P);
-    proj_destroy(src);
-    proj_destroy(dst);
-    proj_context_destroy(C);
+ProjectorCache::~ProjectorCache() = default;
 
-    return Point{static_cast<double>(out.xy.x), static_cast<double>(out.xy.y)};
-#endif
+std::shared_ptr<const GeoProjector> ProjectorCache::get(const ProjectorKey& key)
+{
+    {
+        const std::lock_guard<std::mutex> lock(impl_->mutex);
+        const auto it = impl_->map.find(key);
+        if (it != impl_->map.end()) {
+            ++impl_->hits;
+            return it->second;
+        }
+        ++impl_->misses;
+    }
+
+    // Построение конвейера дорогое — выполняем его без блокировки
+    auto projector = std::make_shared<const GeoProjector>(key);
+
+    const std::lock_guard<std::mutex> lock(impl_->mutex);
+    const auto [it, inserted] = impl_->map.emplace(key, projector);
+    if (!inserted) {
+        return it->second; // другой поток успел раньше
+    }
+    impl_->order.push_back(key);
+    if (impl_->order.size() > impl_->capacity) {
+        impl_->map.erase(impl_->order.front());
+        impl_->order.pop_front();
+    }
+    return projector;
+}
+
+ProjectorCacheStats ProjectorCache::stats() const
+{
+    const std::lock_guard<std::mutex> lock(impl_->mutex);
+    ProjectorCacheStats st;
+    st.hits = impl_->hits;
+    st.misses = impl_->misses;
+    st.size = impl_->map.size();
+    return st;
+}
+
+void ProjectorCache::clear()
+{
+    const std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->map.clear();
+    impl_->order.clear();
+    impl_->hits = 0;
+    impl_->misses = 0;
+}
+
+// ===== Общий реестр конвейеров =====
+namespace {
+
+// Таблица с открытой адресацией. Слот заполняется один раз: ключ и проекция пишутся до публикации флага,
+// поэтому читатель, увидевший флаг, читает их без гонки. Заполнение — не больше половины.
+// Таблица владеет своими проекциями; выданные get копии shared_ptr переживают её.
+struct RegistryTable {
+    struct Slot {
+        ProjectorKey key;
+        std::shared_ptr<const GeoProjector> projector;
+        std::atomic<bool> filled{false};
+    };
+
+    explicit RegistryTable(std::size_t capacity)
+        : mask(capacity - 1)
+        , slots(std::make_unique<Slot[]>(capacity))
+    {
+    }
+
+    [[nodiscard]] const Slot* find(const ProjectorKey& key, std::size_t hash) const noexcept
+    {
+        for (std::size_t i = hash & mask;; i = (i + 1) & mask) {
+            if (!slots[i].filled.load(std::memory_order_acquire)) return nullptr;
+            if (slots[i].key == key) return &slots[i];
+        }
+    }
+
+    // Только под мьютексом реестра; ключа в таблице нет, свободный слот есть
+    void insert(const ProjectorKey& key, std::size_t hash, std::shared_ptr<const GeoProjector> projector) noexcept
+    {
+        std::size_t i = hash & mask;
+        while (slots[i].filled.load(std::memory_order_relaxed)) {
+            i = (i + 1) & mask;
+        }
+        slots[i].key = key;
+        slots[i].projector = std::move(projector);
+        slots[i].filled.store(true, std::memory_order_release);
+        ++size;
+    }
+
+    const std::size_t mask;
+    std::unique_ptr<Slot[]> slots;
+    std::size_t size{0}; // меняется только под мьютексом
+};
+
+std::size_t table_capacity(std::size_t keys) noexcept
+{
+    std::size_t n = 16;
+    while (n < 2 * keys) n <<= 1;
+    return n;
+}
+
+// У потока своя полоса в отдельной строке кэша: счётчик попаданий и число его читателей внутри таблицы.
+// Полос 64, поэтому маска ещё не прошедших полос помещается в одно слово
+constexpr std::size_t kStripes = 64;
+
+struct alignas(64) ReaderStripe {
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint32_t> active{0};
+};
+
+std::size_t reader_stripe() noexcept
+{
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t stripe = next.fetch_add(1, std::memory_order_relaxed) % kStripes;
+    return stripe;
+}
+
+// Снятая с публикации таблица и полосы, в которых ещё могут быть её читатели
+struct RetiredTable {
+    std::unique_ptr<RegistryTable> table;
+    std::uint64_t pending;
+};
+
+} // namespace
+
+struct ProjectorRegistry::Impl {
+    explicit Impl(std::size_t capacity)
+        : max_keys(std::max<std::size_t>(capacity, 1))
+    {
+        rotate();
+    }
+
+    // Под мьютексом (или из конструктора): публикуется новая пустая таблица, прежняя уходит в очередь
+    // на освобождение
+    void rotate()
+    {
+        auto next = std::make_unique<RegistryTable>(table_capacity(max_keys));
+        table.store(next.get(), std::memory_order_seq_cst);
+        if (current) {
+            retired.push_back({std::move(current), ~std::uint64_t{0}});
+        }
+        current = std::move(next);
+        reclaim();
+    }
+
+    // Под мьютексом. Читатель отмечается в своей полосе до загрузки указателя на таблицу (seq_cst с обеих
+    // сторон), поэтому снятую таблицу могут обходить только читатели, вошедшие раньше её снятия.
+    // Полоса, хоть раз замеченная пустой после снятия, таких читателей уже не содержит; таблица
+    // освобождается, когда пройдены все полосы. Запись не ждёт читателей — очередь проверяется
+    // при каждом промахе
+    void reclaim()
+    {
+        for (RetiredTable& r: retired) {
+            for (std::size_t s = 0; s < kStripes; ++s) {
+                const std::uint64_t bit = std::uint64_t{1} << s;
+                if ((r.pending & bit) != 0 && stripes[s].active.load(std::memory_order_seq_cst) == 0) {
+                    r.pending &= ~bit;
+                }
+            }
+        }
+        retired.erase(std::remove_if(retired.begin(), retired.end(),
+                                     [](const RetiredTable& r) { return r.pending == 0; }),
+                      retired.end());
+    }
+
+    const std::size_t max_keys;
+    std::atomic<const RegistryTable*> table{nullptr};
+    std::array<ReaderStripe, kStripes> stripes{};
+
+    std::mutex mutex;
+    std::unique_ptr<RegistryTable> current;
+    std::vector<RetiredTable> retired;
+    std::uint64_t misses{0};
+};
+
+ProjectorRegistry& ProjectorRegistry::global()
+{
+    static ProjectorRegistry registry;
+    return registry;
+}
+
+ProjectorRegistry::ProjectorRegistry(std::size_t capacity)
+    : impl_(std::make_unique<Impl>(capacity))
+{
+}
+
+ProjectorRegistry::~ProjectorRegistry() = default;
+
+std::shared_ptr<const GeoProjector> ProjectorRegistry::get(const ProjectorKey& key) const
+{
+    Impl& im = *impl_;
+    const std::size_t hash = ProjectorKeyHash{}(key);
+    ReaderStripe& stripe = im.stripes[reader_stripe()];
+    {
+        stripe.active.fetch_add(1, std::memory_order_seq_cst);
+        std::shared_ptr<const GeoProjector> found;
+        if (const auto* slot = im.table.load(std::memory_order_seq_cst)->find(key, hash)) {
+            found = slot->projector;
+        }
+        stripe.active.fetch_sub(1, std::memory_order_release);
+        if (found) {
+            stripe.hits.fetch_add(1, std::memory_order_relaxed);
+            return found;
+        }
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(im.mutex);
+        if (const auto* slot = im.current->find(key, hash)) {
+            stripe.hits.fetch_add(1, std::memory_order_relaxed);
+            return slot->projector;
+        }
+        ++im.misses;
+    }
+
+    // Построение конвейера дорогое — выполняем его без блокировки. Ключ с NaN отвергает конструктор
+    auto projector = std::make_shared<const GeoProjector>(key);
+
+    const std::lock_guard<std::mutex> lock(im.mutex);
+    if (const auto* slot = im.current->find(key, hash)) return slot->projector; // другой поток успел раньше
+    if (im.current->size >= im.max_keys) {
+        im.rotate(); // таблица заполнена
+    } else {
+        im.reclaim();
+    }
+    im.current->insert(key, hash, projector);
+    return projector;
+}
+
+ProjectorCacheStats ProjectorRegistry::stats() const
+{
+    ProjectorCacheStats st;
+    for (const ReaderStripe& s: impl_->stripes) {
+        st.hits += s.hits.load(std::memory_order_relaxed);
+    }
+    const std::lock_guard<std::mutex> lock(impl_->mutex);
+    st.misses = impl_->misses;
+    st.size = impl_->current->size;
+    return st;
+}
+
+void ProjectorRegistry::clear()
+{
+    const std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->rotate();
+    for (ReaderStripe& s: impl_->stripes) {
+        s.hits.store(0, std::memory_order_relaxed);
+    }
+    impl_->misses = 0;
+}
+
+// ===== AEQD =====
+// Встроенная проекция строится на месте: это несколько умножений и sincos, дешевле поиска в кэше под мьютексом
+Point GeoToXYAeqd::geo_to_xy(const GeoPoint& center, const GeoPoint& geo_point) const
+{
+    MYLIB_PROBE_COUNT(Probe::ProjectorForward, 1);
+    return AzimuthalEquidistant(center).forward(geo_point);
+}
+
+void GeoToXYAeqd::geo_to_xy_batch(const GeoPoint& center, span<const GeoPoint> in, span<Point> out) const
+{
+    check_batch_sizes("GeoToXYAeqd::geo_to_xy_batch", in.size(), out.size());
+    MYLIB_PROBE_SCOPE(Probe::ProjectorForward, in.size());
+    AzimuthalEquidistant(center).forward(in, out);
+}
+
+GeoPoint GeoToXYAeqd::xy_to_geo(const GeoPoint& center, const Point& xy) const
+{
+    MYLIB_PROBE_COUNT(Probe::ProjectorInverse, 1);
+    return AzimuthalEquidistant(center).inverse(xy);
+}
+
+void GeoToXYAeqd::xy_to_geo_batch(const GeoPoint& center, span<const Point> in, span<GeoPoint> out) const
+{
+    check_batch_sizes("GeoToXYAeqd::xy_to_geo_batch", in.size(), out.size());
+    MYLIB_PROBE_SCOPE(Probe::ProjectorInverse, in.size());
+    AzimuthalEquidistant(center).inverse(in, out);
+}
+
+std::shared_ptr<const GeoProjector> GeoToXYAeqd::projector(const GeoPoint& center) const
+{
+    return cache_->get(ProjectorKey::aeqd(center));
+}
+
+// ===== UTM =====
+int GeoToXYUtm::utm_zone_from_lon(double lon_deg)
+{
+    return static_cast<int>(std::floor((lon_deg + 180.0) / 6.0)) + 1;
+}
+
+namespace {
+
+// Строится при каждом вызове: коэффициенты рядов — несколько десятков умножений, без трансцендентных функций
+TransverseMercator utm_for(const GeoPoint& center) noexcept
+{
+    return TransverseMercator::utm(GeoToXYUtm::utm_zone_from_lon(center.lon), center.lat >= 0.0);
+}
+
+} // namespace
+
+Point GeoToXYUtm::geo_to_xy(const GeoPoint& center, const GeoPoint& geo_point) const
+{
+    MYLIB_PROBE_COUNT(Probe::ProjectorForward, 1);
+    return utm_for(center).forward(geo_point);
+}
+
+void GeoToXYUtm::geo_to_xy_batch(const GeoPoint& center, span<const GeoPoint> in, span<Point> out) const
+{
+    check_batch_sizes("GeoToXYUtm::geo_to_xy_batch", in.size(), out.size());
+    MYLIB_PROBE_SCOPE(Probe::ProjectorForward, in.size());
+    utm_for(center).forward(in, out);
+}
+
+GeoPoint GeoToXYUtm::xy_to_geo(const GeoPoint& center, const Point& xy) const
+{
+    MYLIB_PROBE_COUNT(Probe::ProjectorInverse, 1);
+    return utm_for(center).inverse(xy);
+}
+
+void GeoToXYUtm::xy_to_geo_batch(const GeoPoint& center, span<const Point> in, span<GeoPoint> out) const
+{
+    check_batch_sizes("GeoToXYUtm::xy_to_geo_batch", in.size(), out.size());
+    MYLIB_PROBE_SCOPE(Probe::ProjectorInverse, in.size());
+    utm_for(center).inverse(in, out);
+}
+
+std::shared_ptr<const GeoProjector> GeoToXYUtm::projector(const GeoPoint& center) const
+{
+    return cache_->get(ProjectorKey::utm(utm_zone_from_lon(center.lon), center.lat >= 0.0));
 }
 
 } // namespace mylib
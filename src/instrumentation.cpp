@@ -0,0 +1,147 @@
+// src/instrumentation.cpp
+#include "instrumentation.h"
+
+#include <mutex>
+
+namespace mylib {
+
+namespace {
+
+const char* const kProbeNames[kProbeCount] = {
+    "dist",
+    "polyline_lengths",
+    "point_on_path",
+    "ring_signed_area",
+    "Polygon::metrics",
+    "Polygon::contains",
+    "GeoToXYEquirectangular::geo_to_xy",
+    "GeoToXYEquirectangular::xy_to_geo",
+    "GeoProjector::forward",
+    "GeoProjector::inverse",
+    "GeoProjector::GeoProjector",
+    "proj_create",
+};
+
+} // namespace
+
+const char* probe_name(Probe p) noexcept
+{
+    const auto i = static_cast<std::size_t>(p);
+    return i < kProbeCount ? kProbeNames[i] : "unknown";
+}
+
+#if defined(MYLIB_INSTRUMENTATION)
+
+namespace detail {
+
+namespace {
+
+// Живые потоки, итоги завершившихся и точка отсчёта последнего сброса
+struct ProbeRegistry {
+    std::mutex mutex;
+    ThreadProbes* head{nullptr};
+    InstrumentationSnapshot retired;
+    InstrumentationSnapshot baseline;
+};
+
+ProbeRegistry& probe_registry()
+{
+    static ProbeRegistry registry;
+    return registry;
+}
+
+void add_thread(InstrumentationSnapshot& to, const ThreadProbes& from) noexcept
+{
+    for (std::size_t i = 0; i < kProbeCount; ++i) {
+        to.probes[i].calls += from.counters[i].calls.load(std::memory_order_relaxed);
+        to.probes[i].points += from.counters[i].points.load(std::memory_order_relaxed);
+        to.probes[i].nanoseconds += from.counters[i].nanoseconds.load(std::memory_order_relaxed);
+    }
+}
+
+// Итоги с запуска процесса; вызывается под мьютексом реестра
+InstrumentationSnapshot totals(const ProbeRegistry& registry) noexcept
+{
+    InstrumentationSnapshot sum = registry.retired;
+    for (const ThreadProbes* t = registry.head; t != nullptr; t = t->next) {
+        add_thread(sum, *t);
+    }
+    return sum;
+}
+
+} // namespace
+
+ThreadProbes::ThreadProbes()
+{
+    ProbeRegistry& registry = probe_registry();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    next = registry.head;
+    registry.head = this;
+}
+
+// Счётчики завершившегося потока переходят в итоги, чтобы снимки не убывали
+ThreadProbes::~ThreadProbes()
+{
+    ProbeRegistry& registry = probe_registry();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    add_thread(registry.retired, *this);
+    for (ThreadProbes** p = &registry.head; *p != nullptr; p = &(*p)->next) {
+        if (*p == this) {
+            *p = next;
+            break;
+        }
+    }
+}
+
+ThreadProbes& thread_probes()
+{
+    thread_local ThreadProbes probes;
+    return probes;
+}
+
+} // namespace detail
+
+bool instrumentation_enabled() noexcept
+{
+    return true;
+}
+
+InstrumentationSnapshot instrumentation_snapshot()
+{
+    detail::ProbeRegistry& registry = detail::probe_registry();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    InstrumentationSnapshot snap = detail::totals(registry);
+    for (std::size_t i = 0; i < kProbeCount; ++i) {
+        snap.probes[i].calls -= registry.baseline.probes[i].calls;
+        snap.probes[i].points -= registry.baseline.probes[i].points;
+        snap.probes[i].nanoseconds -= registry.baseline.probes[i].nanoseconds;
+    }
+    return snap;
+}
+
+void instrumentation_reset()
+{
+    detail::ProbeRegistry& registry = detail::probe_registry();
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.baseline = detail::totals(registry);
+}
+
+#else
+
+bool instrumentation_enabled() noexcept
+{
+    return false;
+}
+
+InstrumentationSnapshot instrumentation_snapshot()
+{
+    return {};
+}
+
+void instrumentation_reset()
+{
+}
+
+#endif
+
+} // namespace mylib
@@ -0,0 +1,83 @@
+// src/instrumentation.h
+// Внутренние макросы замеров. Без MYLIB_INSTRUMENTATION раскрываются в пустое выражение,
+// аргументы не вычисляются.
+#pragma once
+
+#include <mylib/instrumentation.h>
+
+#if defined(MYLIB_INSTRUMENTATION)
+
+#include <atomic>
+#include <chrono>
+
+namespace mylib::detail {
+
+// Счётчики одного потока: пишет только владелец (загрузка и запись без RMW), читает снимок
+struct ThreadProbes {
+    struct Counters {
+        std::atomic<std::uint64_t> calls{0};
+        std::atomic<std::uint64_t> points{0};
+        std::atomic<std::uint64_t> nanoseconds{0};
+    };
+
+    ThreadProbes();
+    ~ThreadProbes();
+    ThreadProbes(const ThreadProbes&) = delete;
+    ThreadProbes& operator=(const ThreadProbes&) = delete;
+
+    std::array<Counters, kProbeCount> counters;
+    ThreadProbes* next{nullptr}; // список живых потоков, под мьютексом реестра
+};
+
+ThreadProbes& thread_probes();
+
+inline void bump(std::atomic<std::uint64_t>& c, std::uint64_t v) noexcept
+{
+    c.store(c.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+}
+
+inline void probe_count(Probe p, std::size_t points)
+{
+    ThreadProbes::Counters& c = thread_probes().counters[static_cast<std::size_t>(p)];
+    bump(c.calls, 1);
+    bump(c.points, points);
+}
+
+// Замер времени области видимости
+class ProbeTimer {
+public:
+    ProbeTimer(Probe p, std::size_t points)
+        : counters_(thread_probes().counters[static_cast<std::size_t>(p)])
+        , points_(points)
+        , start_(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~ProbeTimer()
+    {
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_);
+        bump(counters_.calls, 1);
+        bump(counters_.points, points_);
+        bump(counters_.nanoseconds, static_cast<std::uint64_t>(ns.count()));
+    }
+
+    ProbeTimer(const ProbeTimer&) = delete;
+    ProbeTimer& operator=(const ProbeTimer&) = delete;
+
+private:
+    ThreadProbes::Counters& counters_;
+    std::size_t points_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace mylib::detail
+
+#define MYLIB_PROBE_COUNT(probe, points) ::mylib::detail::probe_count((probe), (points))
+#define MYLIB_PROBE_SCOPE(probe, points) const ::mylib::detail::ProbeTimer mylib_probe_timer_((probe), (points))
+
+#else
+
+#define MYLIB_PROBE_COUNT(probe, points) static_cast<void>(0)
+#define MYLIB_PROBE_SCOPE(probe, points) static_cast<void>(0)
+
+#endif
@@ -0,0 +1,247 @@
+// src/kernels.cpp
+#include <mylib/kernels.h>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#  define MYLIB_X86_DISPATCH 1
+#  include <immintrin.h>
+#endif
+
+namespace mylib {
+
+namespace {
+
+// Параметры центра, вычисленные один раз на вызов
+struct EquirectParams {
+    double lon0;
+    double lat0;
+    double cos_lat0;
+};
+
+EquirectParams equirect_params(const GeoPoint& center)
+{
+    const double lat0 = deg2rad(center.lat);
+    return EquirectParams{deg2rad(center.lon), lat0, std::cos(lat0)};
+}
+
+// Порядок операций везде как в GeoToXYEquirectangular::geo_to_xy:
+//   x = (R * (lon - lon0)) * cos(lat0),  y = R * (lat - lat0)
+// Без FMA — иначе теряется побитовое совпадение со скалярным путём.
+void equirect_scalar(const EquirectParams& p,
+                     const double* lat,
+                     const double* lon,
+                     double* x,
+                     double* y,
+                     std::size_t begin,
+                     std::size_t end)
+{
+    constexpr double R = GeoToXYEquirectangular::R;
+    for (std::size_t i = begin; i < end; ++i) {
+        const double lo = deg2rad(lon[i]);
+        const double la = deg2rad(lat[i]);
+        x[i] = R * (lo - p.lon0) * p.cos_lat0;
+        y[i] = R * (la - p.lat0);
+    }
+}
+
+// Без FMA и с корректно округляемым sqrt — совпадает с векторными вариантами
+void segment_lengths_scalar(const double* xs, const double* ys, double* out, std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i) {
+        const double dx = xs[i + 1] - xs[i];
+        const double dy = ys[i + 1] - ys[i];
+        out[i] = std::sqrt(dx * dx + dy * dy);
+    }
+}
+
+#if defined(MYLIB_X86_DISPATCH)
+
+__attribute__((target("avx2"))) void segment_lengths_avx2(const double* xs,
+                                                            const double* ys,
+                                                            double* out,
+                                                            std::size_t m)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= m; i += 4) {
+        const __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(xs + i + 1), _mm256_loadu_pd(xs + i));
+        const __m256d dy = _mm256_sub_pd(_mm256_loadu_pd(ys + i + 1), _mm256_loadu_pd(ys + i));
+        _mm256_storeu_pd(out + i, _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy))));
+    }
+    segment_lengths_scalar(xs, ys, out, i, m);
+}
+
+__attribute__((target("avx512f"))) void segment_lengths_avx512(const double* xs,
+                                                                 const double* ys,
+                                                                 double* out,
+                                                                 std::size_t m)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= m; i += 8) {
+        const __m512d dx = _mm512_sub_pd(_mm512_loadu_pd(xs + i + 1), _mm512_loadu_pd(xs + i));
+        const __m512d dy = _mm512_sub_pd(_mm512_loadu_pd(ys + i + 1), _mm512_loadu_pd(ys + i));
+        const __m512d sq = _mm512_add_pd(_mm512_mul_pd(dx, dx), _mm512_mul_pd(dy, dy));
+        // _mm512_sqrt_pd в GCC 12 берёт неинициализированный исходный вектор маски (-Wmaybe-uninitialized);
+        // маска на все полосы с нулевым исходным даёт то же самое
+        _mm512_storeu_pd(out + i, _mm512_mask_sqrt_pd(_mm512_setzero_pd(), static_cast<__mmask8>(0xFF), sq));
+    }
+    segment_lengths_scalar(xs, ys, out, i, m);
+}
+
+__attribute__((target("avx2"))) void equirect_avx2(const EquirectParams& p,
+                                                     const double* lat,
+                                                     const double* lon,
+                                                     double* x,
+                                                     double* y,
+                                                     std::size_t n)
+{
+    const __m256d k = _mm256_set1_pd(kPI / 180.0);
+    const __m256d r = _mm256_set1_pd(GeoToXYEquirectangular::R);
+    const __m256d lon0 = _mm256_set1_pd(p.lon0);
+    const __m256d lat0 = _mm256_set1_pd(p.lat0);
+    const __m256d c = _mm256_set1_pd(p.cos_lat0);
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256d lo = _mm256_mul_pd(_mm256_loadu_pd(lon + i), k);
+        const __m256d la = _mm256_mul_pd(_mm256_loadu_pd(lat + i), k);
+        _mm256_storeu_pd(x + i, _mm256_mul_pd(_mm256_mul_pd(r, _mm256_sub_pd(lo, lon0)), c));
+        _mm256_storeu_pd(y + i, _mm256_mul_pd(r, _mm256_sub_pd(la, lat0)));
+    }
+    equirect_scalar(p, lat, lon, x, y, i, n);
+}
+
+__attribute__((target("avx512f"))) void equirect_avx512(const EquirectParams& p,
+                                                          const double* lat,
+                                                          const double* lon,
+                                                          double* x,
+                                                          double* y,
+                                                          std::size_t n)
+{
+    const __m512d k = _mm512_set1_pd(kPI / 180.0);
+    const __m512d r = _mm512_set1_pd(GeoToXYEquirectangular::R);
+    const __m512d lon0 = _mm512_set1_pd(p.lon0);
+    const __m512d lat0 = _mm512_set1_pd(p.lat0);
+    const __m512d c = _mm512_set1_pd(p.cos_lat0);
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512d lo = _mm512_mul_pd(_mm512_loadu_pd(lon + i), k);
+        const __m512d la = _mm512_mul_pd(_mm512_loadu_pd(lat + i), k);
+        _mm512_storeu_pd(x + i, _mm512_mul_pd(_mm512_mul_pd(r, _mm512_sub_pd(lo, lon0)), c));
+        _mm512_storeu_pd(y + i, _mm512_mul_pd(r, _mm512_sub_pd(la, lat0)));
+    }
+    equirect_scalar(p, lat, lon, x, y, i, n);
+}
+
+SimdLevel detect_simd_level() noexcept
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SimdLevel::Avx512;
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::Avx2;
+    return SimdLevel::Scalar;
+}
+
+#else
+
+SimdLevel detect_simd_level() noexcept
+{
+    return SimdLevel::Scalar;
+}
+
+#endif
+
+} // namespace
+
+SimdLevel simd_level() noexcept
+{
+    static const SimdLevel level = detect_simd_level();
+    return level;
+}
+
+bool simd_level_supported(SimdLevel level) noexcept
+{
+    return static_cast<int>(level) <= static_cast<int>(simd_level());
+}
+
+const char* simd_level_name(SimdLevel level) noexcept
+{
+    switch (level) {
+    case SimdLevel::Scalar: return "scalar";
+    case SimdLevel::Avx2: return "avx2";
+    case SimdLevel::Avx512: return "avx512";
+    }
+    return "unknown";
+}
+
+namespace {
+
+void check_level(const char* where, SimdLevel level)
+{
+    if (!simd_level_supported(level)) {
+        throw std::invalid_argument(std::string(where) + ": уровень " + simd_level_name(level) +
+                                    " не поддерживается процессором");
+    }
+}
+
+} // namespace
+
+void equirect_forward_soa(const GeoPoint& center,
+                          span<const double> lat,
+                          span<const double> lon,
+                          span<double> x,
+                          span<double> y)
+{
+    equirect_forward_soa(center, lat, lon, x, y, simd_level());
+}
+
+void equirect_forward_soa(const GeoPoint& center,
+                          span<const double> lat,
+                          span<const double> lon,
+                          span<double> x,
+                          span<double> y,
+                          SimdLevel level)
+{
+    const std::size_t n = lat.size();
+    if (lon.size() != n || x.size() != n || y.size() != n) {
+        throw std::invalid_argument("equirect_forward_soa: размеры буферов не совпадают");
+    }
+    check_level("equirect_forward_soa", level);
+
+    const EquirectParams p = equirect_params(center);
+    switch (level) {
+#if defined(MYLIB_X86_DISPATCH)
+    case SimdLevel::Avx512: equirect_avx512(p, lat.data(), lon.data(), x.data(), y.data(), n); return;
+    case SimdLevel::Avx2: equirect_avx2(p, lat.data(), lon.data(), x.data(), y.data(), n); return;
+#endif
+    default: equirect_scalar(p, lat.data(), lon.data(), x.data(), y.data(), 0, n); return;
+    }
+}
+
+void segment_lengths_soa(span<const double> xs, span<const double> ys, span<double> out)
+{
+    segment_lengths_soa(xs, ys, out, simd_level());
+}
+
+void segment_lengths_soa(span<const double> xs, span<const double> ys, span<double> out, SimdLevel level)
+{
+    const std::size_t n = xs.size();
+    const std::size_t m = n == 0 ? 0 : n - 1;
+    if (ys.size() != n || out.size() != m) {
+        throw std::invalid_argument("segment_lengths_soa: размеры буферов не согласованы");
+    }
+    check_level("segment_lengths_soa", level);
+
+    switch (level) {
+#if defined(MYLIB_X86_DISPATCH)
+    case SimdLevel::Avx512: segment_lengths_avx512(xs.data(), ys.data(), out.data(), m); return;
+    case SimdLevel::Avx2: segment_lengths_avx2(xs.data(), ys.data(), out.data(), m); return;
+#endif
+    default: segment_lengths_scalar(xs.data(), ys.data(), out.data(), 0, m); return;
+    }
+}
+
+} // namespace mylib
@@ -0,0 +1,80 @@
+// src/parallel.h
+// Внутренний заголовок библиотеки (не устанавливается)
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mylib::detail {
+
+/// 0 — по числу аппаратных потоков; результат не меньше 1
+inline std::size_t resolve_threads(std::size_t requested) noexcept
+{
+    if (requested > 0) return requested;
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+/// fn(i) для всех i из [0, count) на threads потоках, включая вызывающий.
+/// Индексы раздаются по одному через атомарный счётчик: задачи разной длины балансируются сами.
+/// Порядок вызовов не определён, поэтому fn должна писать только в ячейку i.
+/// Первое исключение из fn пробрасывается после остановки всех потоков; оставшиеся индексы пропускаются.
+/// Ошибка создания потока так же останавливает запущенные потоки и пробрасывается.
+template <typename Fn>
+void parallel_for(std::size_t count, std::size_t threads, Fn&& fn)
+{
+    threads = std::min(resolve_threads(threads), count);
+    if (threads <= 1) {
+        for (std::size_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto worker = [&]() {
+        for (std::size_t i = next.fetch_add(1, std::memory_order_relaxed); i < count;
+             i = next.fetch_add(1, std::memory_order_relaxed)) {
+            if (failed.load(std::memory_order_relaxed)) return;
+            try {
+                fn(i);
+            } catch (...) {
+                const std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) error = std::current_exception();
+                failed.store(true, std::memory_order_relaxed);
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    try {
+        for (std::size_t t = 1; t < threads; ++t) {
+            pool.emplace_back(worker);
+        }
+    } catch (...) {
+        // Поток не создался (std::system_error): уже запущенные останавливаются и присоединяются,
+        // иначе разрушение присоединяемого std::thread вызвало бы std::terminate
+        failed.store(true, std::memory_order_relaxed);
+        for (auto& th: pool) {
+            th.join();
+        }
+        throw;
+    }
+    worker();
+    for (auto& th: pool) {
+        th.join();
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+} // namespace mylib::detail
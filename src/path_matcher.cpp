@@ -0,0 +1,291 @@
+// src/path_matcher.cpp
+#include <mylib/path_matcher.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace mylib {
+
+namespace {
+
+// Соседи подсказки, проверяемые до обхода сетки
+constexpr std::size_t kHintWindow = 2;
+
+// Предел размера сетки (ячейки плюс записи сегментов): max(kMinGridBudget, kGridBudgetPerSegment * сегментов).
+// Слишком мелкая ячейка, заданная вручную или подобранная, укрупняется вдвое до попадания в предел
+constexpr std::size_t kGridBudgetPerSegment = 64;
+constexpr std::size_t kMinGridBudget = std::size_t{1} << 20;
+
+// Запас при раскладке сегмента по ячейкам, доля ячейки: сегмент, проходящий у самой границы,
+// попадает в обе соседние ячейки независимо от округления
+constexpr double kCellPad = 1e-6;
+
+using Cell = std::ptrdiff_t;
+
+} // namespace
+
+struct PathMatcher::Candidate {
+    std::size_t segment{npos};
+    double t{0.0};
+    double d2{std::numeric_limits<double>::infinity()};
+};
+
+PathMatcher::PathMatcher(std::vector<Point> pts, double cell_size)
+    : path_(std::move(pts))
+{
+    const std::vector<Point>& v = path_.points();
+    const std::vector<double>& s = path_.lengths();
+    const std::size_t segments = v.size() - 1;
+    if (segments >= std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("PathMatcher: слишком много точек");
+    }
+
+    BBox box;
+    for (const Point& p: v) {
+        box.expand(p);
+    }
+    min_x_ = box.min_x;
+    min_y_ = box.min_y;
+    const double w = box.max_x - box.min_x;
+    const double h = box.max_y - box.min_y;
+
+    // Длины ненулевых сегментов и сумма их проекций на оси — для подбора ячейки и оценки числа записей
+    std::vector<double> lengths;
+    lengths.reserve(segments);
+    double manhattan = 0.0;
+    for (std::size_t i = 0; i < segments; ++i) {
+        if (s[i + 1] == s[i]) continue;
+        lengths.push_back(s[i + 1] - s[i]);
+        manhattan += std::abs(v[i + 1].x - v[i].x) + std::abs(v[i + 1].y - v[i].y);
+    }
+
+    // Ячейка — меньшее из медианной длины сегмента и среднего расстояния между линиями пути
+    // (площадь / длина): на плотном треке GNSS в ячейку попадают один-два соседних сегмента,
+    // на челноке с длинными проходами — один проход, а не все проходы поля
+    cell_ = cell_size;
+    if (!(cell_ > 0.0) && !lengths.empty()) {
+        const auto mid = lengths.begin() + static_cast<std::ptrdiff_t>(lengths.size() / 2);
+        std::nth_element(lengths.begin(), mid, lengths.end());
+        cell_ = *mid;
+        const double spacing = w * h / path_.length();
+        if (spacing > 0.0) cell_ = std::min(cell_, spacing);
+    }
+    if (!(cell_ > 0.0)) {
+        cell_ = 1.0; // путь из совпадающих точек
+    }
+    const auto budget = static_cast<double>(std::max(kMinGridBudget, kGridBudgetPerSegment * segments));
+    const auto grid_size = [&](double c) {
+        const double cells = (std::floor(w / c) + 1.0) * (std::floor(h / c) + 1.0);
+        const double items = manhattan / c + 3.0 * static_cast<double>(lengths.size());
+        return cells + items;
+    };
+    while (grid_size(cell_) > budget) {
+        cell_ *= 2.0;
+    }
+    nx_ = static_cast<std::size_t>(w / cell_) + 1;
+    ny_ = static_cast<std::size_t>(h / cell_) + 1;
+
+    const auto cell_x = [this](double x) {
+        return std::min(static_cast<std::size_t>(std::max(0.0, (x - min_x_) / cell_)), nx_ - 1);
+    };
+    const auto cell_y = [this](double y) {
+        return std::min(static_cast<std::size_t>(std::max(0.0, (y - min_y_) / cell_)), ny_ - 1);
+    };
+    // Ячейки, которые пересекает сегмент: обход вдоль линии по столбцам сетки, в каждом столбце —
+    // ячейки между высотами сегмента на границах столбца. Длинный диагональный сегмент занимает
+    // O(длина / ячейка) ячеек, а не весь свой прямоугольник. Сегменты нулевой длины не индексируются —
+    // их точка совпадает с концом соседнего сегмента
+    const auto for_cells = [&](std::size_t i, auto&& fn) {
+        if (s[i + 1] == s[i]) return;
+        Point a = v[i];
+        Point b = v[i + 1];
+        if (b.x < a.x) std::swap(a, b);
+        const double pad = kCellPad * cell_;
+        const double dx = b.x - a.x;
+        const double slope = dx > 0.0 ? (b.y - a.y) / dx : 0.0;
+        const std::size_t x0 = cell_x(a.x - pad), x1 = cell_x(b.x + pad);
+        for (std::size_t x = x0; x <= x1; ++x) {
+            double ya = a.y, yb = b.y;
+            if (dx > 0.0) {
+                const double lo = std::clamp(min_x_ + static_cast<double>(x) * cell_, a.x, b.x);
+                const double hi = std::clamp(min_x_ + static_cast<double>(x + 1) * cell_, a.x, b.x);
+                ya = a.y + (lo - a.x) * slope;
+                yb = a.y + (hi - a.x) * slope;
+            }
+            const std::size_t y0 = cell_y(std::min(ya, yb) - pad), y1 = cell_y(std::max(ya, yb) + pad);
+            for (std::size_t y = y0; y <= y1; ++y) {
+                fn(y * nx_ + x);
+            }
+        }
+    };
+
+    // Два прохода: размеры ячеек, затем раскладка (CSR)
+    std::vector<std::size_t> counts(nx_ * ny_ + 1, 0);
+    for (std::size_t i = 0; i < segments; ++i) {
+        for_cells(i, [&counts](std::size_t c) { ++counts[c + 1]; });
+    }
+    for (std::size_t c = 1; c < counts.size(); ++c) {
+        counts[c] += counts[c - 1];
+    }
+    if (counts.back() >= std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("PathMatcher: слишком мелкая ячейка сетки");
+    }
+    cell_start_.assign(counts.begin(), counts.end());
+    cell_items_.resize(counts.back());
+    for (std::size_t i = 0; i < segments; ++i) {
+        for_cells(i, [&](std::size_t c) { cell_items_[counts[c]++] = static_cast<std::uint32_t>(i); });
+    }
+}
+
+// Расстояние до сегмента i; при равенстве побеждает сегмент ближе к подсказке (без неё — меньший номер)
+void PathMatcher::consider(const Point& p, std::size_t i, std::size_t hint, Candidate& best) const noexcept
+{
+    const Point& a = path_.points()[i];
+    const Point& b = path_.points()[i + 1];
+    const double dx = b.x - a.x;
+    const double dy = b.y - a.y;
+    const double len2 = dx * dx + dy * dy;
+    double t = len2 > 0.0 ? ((p.x - a.x) * dx + (p.y - a.y) * dy) / len2 : 0.0;
+    t = std::clamp(t, 0.0, 1.0);
+    const double qx = a.x + t * dx - p.x;
+    const double qy = a.y + t * dy - p.y;
+    const double d2 = qx * qx + qy * qy;
+
+    if (d2 > best.d2) return;
+    if (d2 == best.d2) {
+        const auto rank = [hint](std::size_t k) {
+            if (hint == npos) return k;
+            return k > hint ? k - hint : hint - k;
+        };
+        if (rank(i) >= rank(best.segment)) return;
+    }
+    best.segment = i;
+    best.t = t;
+    best.d2 = d2;
+}
+
+PathProjection PathMatcher::result(const Point& p, const Candidate& best) const noexcept
+{
+    const std::vector<Point>& v = path_.points();
+    const std::vector<double>& s = path_.lengths();
+    PathProjection r;
+    if (best.segment == npos) {
+        // Путь нулевой длины: одна точка
+        r.point = v.front();
+        r.offset = dist(p, r.point);
+        return r;
+    }
+    const std::size_t i = best.segment;
+    const Point& a = v[i];
+    const Point& b = v[i + 1];
+    r.segment = i;
+    r.point = {a.x + best.t * (b.x - a.x), a.y + best.t * (b.y - a.y)};
+    r.distance = std::min(s[i] + best.t * (s[i + 1] - s[i]), s[i + 1]);
+    const double cross = (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+    const double d = std::sqrt(best.d2);
+    r.offset = cross < 0.0 ? -d : d;
+    return r;
+}
+
+PathProjection PathMatcher::project(const Point& p) const
+{
+    Hint hint;
+    return project(p, hint);
+}
+
+PathProjection PathMatcher::project(const Point& p, Hint& hint) const
+{
+    // Пропуск решения GNSS: привязывать нечего, подсказка сохраняется для следующего фикса
+    if (!std::isfinite(p.x) || !std::isfinite(p.y)) {
+        PathProjection r;
+        r.distance = std::numeric_limits<double>::quiet_NaN();
+        r.offset = std::numeric_limits<double>::quiet_NaN();
+        r.point = {r.offset, r.offset};
+        r.segment = npos;
+        return r;
+    }
+    const std::vector<double>& s = path_.lengths();
+    const std::size_t segments = s.size() - 1;
+    const std::size_t h = hint.segment < segments ? hint.segment : npos;
+    Candidate best;
+
+    // Соседи подсказки задают начальный радиус поиска
+    if (h != npos) {
+        const std::size_t lo = h > kHintWindow ? h - kHintWindow : 0;
+        const std::size_t hi = std::min(h + kHintWindow, segments - 1);
+        for (std::size_t i = lo; i <= hi; ++i) {
+            if (s[i + 1] != s[i]) consider(p, i, h, best);
+        }
+    }
+
+    // Кольца ячеек вокруг ячейки фикса (для фикса вне сетки — ближайшей к нему)
+    const auto nx = static_cast<Cell>(nx_);
+    const auto ny = static_cast<Cell>(ny_);
+    const double fx = (p.x - min_x_) / cell_;
+    const double fy = (p.y - min_y_) / cell_;
+    const Cell cx = fx <= 0.0 ? 0 : std::min(static_cast<Cell>(std::min(fx, static_cast<double>(nx_))), nx - 1);
+    const Cell cy = fy <= 0.0 ? 0 : std::min(static_cast<Cell>(std::min(fy, static_cast<double>(ny_))), ny - 1);
+
+    const auto visit = [&](Cell x, Cell y) {
+        if (x < 0 || y < 0 || x >= nx || y >= ny) return;
+        const auto c = static_cast<std::size_t>(y * nx + x);
+        for (std::uint32_t k = cell_start_[c]; k < cell_start_[c + 1]; ++k) {
+            consider(p, cell_items_[k], h, best);
+        }
+    };
+
+    for (Cell k = 0;; ++k) {
+        if (k > 0) {
+            if (cx - k < 0 && cy - k < 0 && cx + k >= nx && cy + k >= ny) break; // кольцо целиком вне сетки
+            // Кольцо k лежит вне квадрата колец 0..k-1: расстояние до него не меньше расстояния
+            // от фикса до границы квадрата (если фикс внутри квадрата)
+            const double left = min_x_ + static_cast<double>(cx - k + 1) * cell_;
+            const double right = min_x_ + static_cast<double>(cx + k) * cell_;
+            const double bottom = min_y_ + static_cast<double>(cy - k + 1) * cell_;
+            const double top = min_y_ + static_cast<double>(cy + k) * cell_;
+            double bound = std::min({p.x - left, right - p.x, p.y - bottom, top - p.y});
+            bound = std::max(bound, 0.0);
+            if (bound * bound > best.d2) break;
+        }
+        if (k == 0) {
+            visit(cx, cy);
+            continue;
+        }
+        // Стороны кольца, обрезанные по сетке
+        const Cell x0 = std::max<Cell>(cx - k, 0), x1 = std::min(cx + k, nx - 1);
+        const Cell y0 = std::max<Cell>(cy - k + 1, 0), y1 = std::min(cy + k - 1, ny - 1);
+        for (Cell x = x0; x <= x1; ++x) {
+            visit(x, cy - k);
+            visit(x, cy + k);
+        }
+        for (Cell y = y0; y <= y1; ++y) {
+            visit(cx - k, y);
+            visit(cx + k, y);
+        }
+    }
+
+    hint.segment = best.segment;
+    return result(p, best);
+}
+
+void PathMatcher::project(span<const Point> fixes, span<PathProjection> out) const
+{
+    Hint hint;
+    project(fixes, out, hint);
+}
+
+void PathMatcher::project(span<const Point> fixes, span<PathProjection> out, Hint& hint) const
+{
+    if (fixes.size() != out.size()) {
+        throw std::invalid_argument("PathMatcher::project: размеры входного и выходного буферов не совпадают");
+    }
+    for (std::size_t i = 0; i < fixes.size(); ++i) {
+        out[i] = project(fixes[i], hint);
+    }
+}
+
+} // namespace mylib
@@ -0,0 +1,112 @@
+// src/polygon_batch.cpp
+#include <mylib/polygon_batch.h>
+
+#include <mylib/binary_format.h>
+
+#include "parallel.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+namespace mylib {
+
+namespace {
+
+// Порция не мельче kMinChunkWeight вершин: меньшие не окупают раздачу через общий счётчик.
+// До kChunksPerThread порций на поток сглаживают разброс размеров полей.
+constexpr std::size_t kMinChunkWeight = std::size_t{1} << 14;
+constexpr std::size_t kChunksPerThread = 8;
+
+template <typename Offset>
+void check_table(span<const Offset> offsets, std::size_t limit)
+{
+    if (offsets.empty() || static_cast<std::size_t>(offsets.back()) > limit) {
+        throw std::invalid_argument("polygon_metrics: неверная таблица смещений");
+    }
+    for (std::size_t i = 1; i < offsets.size(); ++i) {
+        if (offsets[i] < offsets[i - 1]) {
+            throw std::invalid_argument("polygon_metrics: неверная таблица смещений");
+        }
+    }
+}
+
+template <typename Offset>
+void compute_all(span<const Point> points, span<const Offset> ring_offsets, span<const Offset> polygon_rings,
+                 span<PolygonMetrics> out, std::size_t threads)
+{
+    const std::size_t n = out.size();
+    if (n == 0) return;
+
+    // Вес полигона — число вершин плюс один (пустые полигоны тоже стоят вызова). Префикс весов
+    // weight(i) = первая вершина полигона i + i монотонен, и границы порций ищутся двоичным поиском.
+    const auto weight = [&](std::size_t i) {
+        return static_cast<std::size_t>(ring_offsets[static_cast<std::size_t>(polygon_rings[i])]) + i;
+    };
+    const std::size_t first = weight(0);
+    const std::size_t total = weight(n) - first;
+
+    threads = detail::resolve_threads(threads);
+    const std::size_t chunks = std::clamp<std::size_t>(total / kMinChunkWeight, 1, threads * kChunksPerThread);
+    std::vector<std::size_t> bounds(chunks + 1, n);
+    bounds[0] = 0;
+    for (std::size_t k = 1; k < chunks; ++k) {
+        const std::size_t target = first + total / chunks * k;
+        std::size_t lo = bounds[k - 1], hi = n;
+        while (lo < hi) {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if (weight(mid) < target) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        bounds[k] = lo;
+    }
+
+    detail::parallel_for(chunks, threads, [&](std::size_t c) {
+        for (std::size_t i = bounds[c]; i < bounds[c + 1]; ++i) {
+            const auto r0 = static_cast<std::size_t>(polygon_rings[i]);
+            const auto rings = static_cast<std::size_t>(polygon_rings[i + 1]) - r0;
+            out[i] = detail::compute_polygon_metrics(rings, [&](std::size_t r) {
+                const auto begin = static_cast<std::size_t>(ring_offsets[r0 + r]);
+                const auto end = static_cast<std::size_t>(ring_offsets[r0 + r + 1]);
+                return points.subspan(begin, end - begin);
+            });
+        }
+    });
+}
+
+void check_output(std::size_t polygons, span<PolygonMetrics> out)
+{
+    if (out.size() != polygons) {
+        throw std::invalid_argument("polygon_metrics: размер выходного буфера не совпадает с числом полигонов");
+    }
+}
+
+} // namespace
+
+void polygon_metrics(const FlatPolygons& polygons, span<PolygonMetrics> out, std::size_t threads)
+{
+    if (polygons.polygon_rings.empty() && out.empty()) return;
+    check_table(polygons.ring_offsets, polygons.points.size());
+    check_table(polygons.polygon_rings, polygons.ring_offsets.size() - 1);
+    check_output(polygons.size(), out);
+    compute_all(polygons.points, polygons.ring_offsets, polygons.polygon_rings, out, threads);
+}
+
+std::vector<PolygonMetrics> polygon_metrics(const FlatPolygons& polygons, std::size_t threads)
+{
+    std::vector<PolygonMetrics> out(polygons.size());
+    polygon_metrics(polygons, out, threads);
+    return out;
+}
+
+void polygon_metrics(const PolygonsFile& file, span<PolygonMetrics> out, std::size_t threads)
+{
+    // Таблицы файла проверены при открытии
+    check_output(file.size(), out);
+    compute_all(file.vertices(), file.ring_offsets(), file.polygon_rings(), out, threads);
+}
+
+} // namespace mylib
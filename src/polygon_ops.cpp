@@ -0,0 +1,614 @@
+// src/polygon_ops.cpp
+#include <mylib/polygon_ops.h>
+
+#include <mylib/polygon_set.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+namespace mylib {
+
+namespace {
+
+// Число проходов разбиения: после первого новые пересечения появляются только из-за округления точек.
+// Если и после последнего прохода пересечения остались, Sweep получил бы нарушенный инвариант — бросаем.
+constexpr int kMaxSplitRounds = 4;
+
+// Косинус угла поворота, выше которого сходящийся угол смещения заменяется точкой пересечения рёбер
+constexpr double kMiterCos = 0.99;
+
+double orient(const Point& a, const Point& b, const Point& c) noexcept
+{
+    return (b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y);
+}
+
+bool lex_less(const Point& a, const Point& b) noexcept
+{
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+// Ребро с упорядоченными концами: l лексикографически меньше r (порядок заметания).
+// wind — изменение числа обхода своего операнда при переходе через ребро снизу вверх:
+// +1, если кольцо проходит ребро от l к r, иначе -1.
+struct Edge {
+    Point l;
+    Point r;
+    int operand;
+    int wind;
+};
+
+// Числа обхода обоих операндов в области
+struct Winding {
+    int subject{0};
+    int clip{0};
+};
+
+bool inside(const Winding& w, BooleanOp op) noexcept
+{
+    const bool a = w.subject > 0;
+    const bool b = w.clip > 0;
+    switch (op) {
+    case BooleanOp::Intersection:
+        return a && b;
+    case BooleanOp::Union:
+        return a || b;
+    case BooleanOp::Difference:
+        return a && !b;
+    case BooleanOp::Xor:
+        return a != b;
+    }
+    return false;
+}
+
+struct Cut {
+    std::size_t edge;
+    Point p;
+};
+
+// Внутренняя точка отрезка, лежащая на его прямой
+bool strictly_inside(const Edge& e, const Point& p) noexcept
+{
+    return lex_less(e.l, p) && lex_less(p, e.r);
+}
+
+void intersect(const std::vector<Edge>& edges, std::size_t i, std::size_t j, std::vector<Cut>& cuts)
+{
+    const Edge& e = edges[i];
+    const Edge& f = edges[j];
+    const double o1 = orient(e.l, e.r, f.l);
+    const double o2 = orient(e.l, e.r, f.r);
+    const double o3 = orient(f.l, f.r, e.l);
+    const double o4 = orient(f.l, f.r, e.r);
+
+    if (((o1 > 0.0 && o2 < 0.0) || (o1 < 0.0 && o2 > 0.0)) && ((o3 > 0.0 && o4 < 0.0) || (o3 < 0.0 && o4 > 0.0))) {
+        // Собственное пересечение: одна и та же точка идёт в оба ребра, зажатая в их общий bbox
+        const double t = o3 / (o3 - o4);
+        Point p{e.l.x + t * (e.r.x - e.l.x), e.l.y + t * (e.r.y - e.l.y)};
+        p.x = std::clamp(p.x, std::max(e.l.x, f.l.x), std::min(e.r.x, f.r.x));
+        p.y = std::clamp(p.y, std::max(std::min(e.l.y, e.r.y), std::min(f.l.y, f.r.y)),
+                         std::min(std::max(e.l.y, e.r.y), std::max(f.l.y, f.r.y)));
+        // Точка, совпавшая с концом или ушедшая за него при округлении, ребро не разбивает:
+        // иначе у куска поменялся бы порядок концов
+        if (strictly_inside(e, p)) cuts.push_back({i, p});
+        if (strictly_inside(f, p)) cuts.push_back({j, p});
+        return;
+    }
+
+    // Касания и наложения: конец одного ребра внутри другого
+    if (o1 == 0.0 && strictly_inside(e, f.l)) cuts.push_back({i, f.l});
+    if (o2 == 0.0 && strictly_inside(e, f.r)) cuts.push_back({i, f.r});
+    if (o3 == 0.0 && strictly_inside(f, e.l)) cuts.push_back({j, e.l});
+    if (o4 == 0.0 && strictly_inside(f, e.r)) cuts.push_back({j, e.r});
+}
+
+// Один проход: пары рёбер с перекрывающимися x-интервалами находятся заметанием по x со списком активных
+// рёбер, рёбра разбиваются в найденных точках. O(n log n + n a + k), a — число активных рёбер: для длинных
+// рёбер, перекрывающихся по x (полосы поперёк поля), это до n, то есть проход квадратичен.
+// false — разбивать нечего.
+bool split_edges(std::vector<Edge>& edges)
+{
+    std::vector<std::size_t> order(edges.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return edges[a].l.x < edges[b].l.x; });
+
+    std::vector<Cut> cuts;
+    std::vector<std::size_t> active;
+    for (const std::size_t i: order) {
+        const Edge& e = edges[i];
+        active.erase(std::remove_if(active.begin(), active.end(), [&](std::size_t j) { return edges[j].r.x < e.l.x; }),
+                     active.end());
+        const double y0 = std::min(e.l.y, e.r.y);
+        const double y1 = std::max(e.l.y, e.r.y);
+        for (const std::size_t j: active) {
+            const Edge& f = edges[j];
+            if (std::max(f.l.y, f.r.y) < y0 || std::min(f.l.y, f.r.y) > y1) continue;
+            intersect(edges, i, j, cuts);
+        }
+        active.push_back(i);
+    }
+    if (cuts.empty()) return false;
+
+    // Точки на ребре от l к r идут в лексикографическом порядке
+    std::sort(cuts.begin(), cuts.end(), [](const Cut& a, const Cut& b) {
+        return a.edge < b.edge || (a.edge == b.edge && lex_less(a.p, b.p));
+    });
+    std::vector<Edge> out;
+    out.reserve(edges.size() + cuts.size());
+    std::size_t c = 0;
+    for (std::size_t i = 0; i < edges.size(); ++i) {
+        const Edge& e = edges[i];
+        Point from = e.l;
+        for (; c < cuts.size() && cuts[c].edge == i; ++c) {
+            if (cuts[c].p == from) continue;
+            out.push_back({from, cuts[c].p, e.operand, e.wind});
+            from = cuts[c].p;
+        }
+        if (!(from == e.r)) out.push_back({from, e.r, e.operand, e.wind});
+    }
+    edges = std::move(out);
+    return true;
+}
+
+struct Event {
+    std::size_t edge;
+    bool left;
+};
+
+// Заметание плоскости: для каждого ребра — числа обхода над ним и под стопкой совпадающих с ним рёбер.
+// Рёбра после split_edges не пересекаются внутренними точками, поэтому порядок в статусе
+// между событиями не меняется.
+class Sweep {
+public:
+    explicit Sweep(const std::vector<Edge>& edges)
+        : edges_(edges)
+        , rank_(edges.size())
+        , above_(edges.size())
+        , group_below_(edges.size())
+        , covered_(edges.size(), 0)
+    {
+    }
+
+    void run()
+    {
+        std::vector<Event> events;
+        events.reserve(2 * edges_.size());
+        for (std::size_t i = 0; i < edges_.size(); ++i) {
+            events.push_back({i, true});
+            events.push_back({i, false});
+        }
+        std::sort(events.begin(), events.end(), [this](const Event& a, const Event& b) { return event_less(a, b); });
+        std::size_t rank = 0;
+        for (const Event& ev: events) {
+            if (ev.left) rank_[ev.edge] = rank++;
+        }
+
+        Status status(SegmentLess{this});
+        std::vector<Status::iterator> where(edges_.size());
+        for (const Event& ev: events) {
+            const std::size_t e = ev.edge;
+            if (!ev.left) {
+                status.erase(where[e]);
+                continue;
+            }
+            const auto it = status.insert(e);
+            where[e] = it;
+
+            Winding below;
+            group_below_[e] = below;
+            if (it != status.begin()) {
+                const std::size_t p = *std::prev(it);
+                below = above_[p];
+                group_below_[e] = below;
+                if (edges_[p].l == edges_[e].l && edges_[p].r == edges_[e].r) {
+                    covered_[p] = 1;
+                    group_below_[e] = group_below_[p];
+                }
+            }
+            above_[e] = below;
+            (edges_[e].operand == 0 ? above_[e].subject : above_[e].clip) += edges_[e].wind;
+        }
+    }
+
+    // Верхнее ребро стопки совпадающих рёбер; остальные уже учтены в его числах обхода
+    [[nodiscard]] bool top(std::size_t e) const noexcept { return !covered_[e]; }
+    [[nodiscard]] const Winding& above(std::size_t e) const noexcept { return above_[e]; }
+    [[nodiscard]] const Winding& below(std::size_t e) const noexcept { return group_below_[e]; }
+
+private:
+    struct SegmentLess {
+        const Sweep* self;
+        bool operator()(std::size_t a, std::size_t b) const noexcept { return self->segment_less(a, b); }
+    };
+    using Status = std::multiset<std::size_t, SegmentLess>;
+
+    [[nodiscard]] const Point& point(const Event& ev) const noexcept
+    {
+        return ev.left ? edges_[ev.edge].l : edges_[ev.edge].r;
+    }
+
+    // Порядок событий: по точке; в одной точке сначала правые концы, затем рёбра снизу вверх
+    [[nodiscard]] bool event_less(const Event& a, const Event& b) const noexcept
+    {
+        const Point& p = point(a);
+        const Point& q = point(b);
+        if (!(p == q)) return lex_less(p, q);
+        if (a.left != b.left) return !a.left;
+        const Edge& ea = edges_[a.edge];
+        const Edge& eb = edges_[b.edge];
+        const double o = orient(ea.l, ea.r, b.left ? eb.r : eb.l);
+        if (o != 0.0) return o > 0.0;
+        if (ea.operand != eb.operand) return ea.operand < eb.operand;
+        return a.edge < b.edge;
+    }
+
+    // Ребро a ниже ребра b на текущей вертикали заметания
+    [[nodiscard]] bool segment_less(std::size_t a, std::size_t b) const noexcept
+    {
+        if (a == b) return false;
+        const Edge& ea = edges_[a];
+        const Edge& eb = edges_[b];
+        const double o1 = orient(ea.l, ea.r, eb.l);
+        const double o2 = orient(ea.l, ea.r, eb.r);
+        if (o1 != 0.0 || o2 != 0.0) {
+            if (ea.l == eb.l) return o2 > 0.0;
+            if (ea.l.x == eb.l.x) return ea.l.y < eb.l.y;
+            // Сравнение по левому концу ребра, вставленного позже
+            if (rank_[a] > rank_[b]) return orient(eb.l, eb.r, ea.l) <= 0.0;
+            return o1 > 0.0;
+        }
+        // На одной прямой: совпадающие рёбра складываются в стопку в порядке вставки
+        return rank_[a] < rank_[b];
+    }
+
+    const std::vector<Edge>& edges_;
+    std::vector<std::size_t> rank_;
+    std::vector<Winding> above_;
+    std::vector<Winding> group_below_;
+    std::vector<unsigned char> covered_;
+};
+
+// Удаление вершин на прямой между соседями (в том числе в месте замыкания)
+void drop_collinear(std::vector<Point>& ring)
+{
+    std::vector<Point> out;
+    out.reserve(ring.size());
+    for (const Point& p: ring) {
+        out.push_back(p);
+        while (out.size() >= 3 && orient(out[out.size() - 3], out[out.size() - 2], out.back()) == 0.0) {
+            out.erase(out.end() - 2);
+        }
+    }
+    std::size_t first = 0;
+    for (bool changed = true; changed && out.size() - first >= 3;) {
+        changed = false;
+        if (orient(out[out.size() - 2], out.back(), out[first]) == 0.0) {
+            out.pop_back();
+            changed = true;
+        } else if (orient(out.back(), out[first], out[first + 1]) == 0.0) {
+            ++first;
+            changed = true;
+        }
+    }
+    ring.assign(out.begin() + static_cast<std::ptrdiff_t>(first), out.end());
+}
+
+// Сборка колец из направленных рёбер результата (область слева от каждого ребра) и раскладка дыр
+// по внешним контурам.
+std::vector<Polygon> assemble(std::vector<BoundPoints> directed)
+{
+    // Вершины — уникальные начала рёбер
+    std::vector<Point> vertices;
+    vertices.reserve(directed.size());
+    for (const auto& d: directed) {
+        vertices.push_back(d.start);
+    }
+    std::sort(vertices.begin(), vertices.end(), lex_less);
+    vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+    const auto vertex_of = [&](const Point& p) {
+        return static_cast<std::size_t>(std::lower_bound(vertices.begin(), vertices.end(), p, lex_less)
+                                        - vertices.begin());
+    };
+
+    // Исходящие рёбра каждой вершины (CSR)
+    std::vector<std::size_t> offsets(vertices.size() + 1, 0);
+    std::vector<std::size_t> from(directed.size());
+    for (std::size_t i = 0; i < directed.size(); ++i) {
+        from[i] = vertex_of(directed[i].start);
+        ++offsets[from[i] + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<std::size_t> outgoing(directed.size());
+    {
+        std::vector<std::size_t> fill(offsets.begin(), offsets.end() - 1);
+        for (std::size_t i = 0; i < directed.size(); ++i) {
+            outgoing[fill[from[i]]++] = i;
+        }
+    }
+
+    std::vector<unsigned char> used(directed.size(), 0);
+    // Следующее ребро грани слева: первое исходящее по часовой стрелке от обратного направления входящего
+    const auto next_edge = [&](std::size_t in, std::size_t start) {
+        const BoundPoints& e = directed[in];
+        const auto v = std::lower_bound(vertices.begin(), vertices.end(), e.end, lex_less) - vertices.begin();
+        if (v == static_cast<std::ptrdiff_t>(vertices.size()) || !(vertices[static_cast<std::size_t>(v)] == e.end)) {
+            return directed.size();
+        }
+        const double back = std::atan2(e.start.y - e.end.y, e.start.x - e.end.x);
+        std::size_t best = directed.size();
+        double best_turn = 0.0;
+        for (std::size_t k = offsets[static_cast<std::size_t>(v)]; k < offsets[static_cast<std::size_t>(v) + 1]; ++k) {
+            const std::size_t j = outgoing[k];
+            if (used[j] && j != start) continue;
+            const BoundPoints& f = directed[j];
+            double turn = back - std::atan2(f.end.y - f.start.y, f.end.x - f.start.x);
+            while (turn <= 0.0) turn += 2.0 * kPI;
+            while (turn > 2.0 * kPI) turn -= 2.0 * kPI;
+            if (best == directed.size() || turn < best_turn) {
+                best = j;
+                best_turn = turn;
+            }
+        }
+        return best;
+    };
+
+    std::vector<std::vector<Point>> outers;
+    std::vector<std::vector<Point>> holes;
+    std::vector<Point> ring;
+    for (std::size_t s = 0; s < directed.size(); ++s) {
+        if (used[s]) continue;
+        ring.clear();
+        bool closed = false;
+        for (std::size_t i = s;;) {
+            used[i] = 1;
+            ring.push_back(directed[i].start);
+            const std::size_t j = next_edge(i, s);
+            if (j == s) {
+                closed = true;
+                break;
+            }
+            if (j == directed.size()) break;
+            i = j;
+        }
+        if (!closed) continue;
+        drop_collinear(ring);
+        if (ring.size() < 3) continue;
+        const double area = ring_signed_area(ring);
+        if (area > 0.0) outers.push_back(ring);
+        else if (area < 0.0) holes.push_back(ring);
+    }
+
+    // Дыра принадлежит наименьшему внешнему контуру, содержащему середину её первого ребра
+    std::vector<Polygon> probes;
+    std::vector<std::size_t> by_area(outers.size());
+    probes.reserve(outers.size());
+    for (const auto& o: outers) {
+        probes.emplace_back(o);
+    }
+    std::iota(by_area.begin(), by_area.end(), std::size_t{0});
+    std::sort(by_area.begin(), by_area.end(),
+              [&](std::size_t a, std::size_t b) { return probes[a].area() < probes[b].area(); });
+
+    std::vector<std::vector<std::vector<Point>>> owned(outers.size());
+    for (auto& h: holes) {
+        const Point p{0.5 * (h[0].x + h[1].x), 0.5 * (h[0].y + h[1].y)};
+        for (const std::size_t o: by_area) {
+            if (probes[o].contains(p)) {
+                owned[o].push_back(std::move(h));
+                break;
+            }
+        }
+    }
+
+    std::vector<Polygon> result;
+    result.reserve(outers.size());
+    for (std::size_t o = 0; o < outers.size(); ++o) {
+        result.emplace_back(std::move(outers[o]), std::move(owned[o]));
+    }
+    return result;
+}
+
+class Overlay {
+public:
+    /// reverse — обходить кольцо в обратном порядке
+    void add_ring(span<const Point> ring, int operand, bool reverse)
+    {
+        const std::size_t n = ring.size();
+        if (n < 3) return;
+        for (std::size_t i = 0; i < n; ++i) {
+            Point a = ring[i];
+            Point b = ring[i + 1 == n ? 0 : i + 1];
+            if (reverse) std::swap(a, b);
+            if (a == b) continue;
+            if (lex_less(a, b)) edges_.push_back({a, b, operand, +1});
+            else edges_.push_back({b, a, operand, -1});
+        }
+    }
+
+    /// Внешний контур против часовой стрелки, дыры по часовой: число обхода внутри равно 1.
+    /// Field — Polygon или PolygonView
+    template <typename Field>
+    void add_polygon(const Field& polygon, int operand)
+    {
+        add_ring(polygon.vertices(), operand, ring_signed_area(polygon.vertices()) < 0.0);
+        for (const auto& h: polygon.holes()) {
+            add_ring(h, operand, ring_signed_area(h) > 0.0);
+        }
+    }
+
+    std::vector<Polygon> run(BooleanOp op)
+    {
+        bool split = true;
+        for (int round = 0; round <= kMaxSplitRounds && split; ++round) {
+            split = split_edges(edges_);
+        }
+        if (split) {
+            throw std::runtime_error("boolean_op: рёбра всё ещё пересекаются после разбиения (вырожденная геометрия)");
+        }
+
+        Sweep sweep(edges_);
+        sweep.run();
+
+        std::vector<BoundPoints> directed;
+        for (std::size_t e = 0; e < edges_.size(); ++e) {
+            if (!sweep.top(e)) continue;
+            const bool in_below = inside(sweep.below(e), op);
+            const bool in_above = inside(sweep.above(e), op);
+            if (in_below == in_above) continue;
+            // Область результата слева по ходу ребра
+            if (in_above) directed.push_back({edges_[e].l, edges_[e].r});
+            else directed.push_back({edges_[e].r, edges_[e].l});
+        }
+        return assemble(std::move(directed));
+    }
+
+private:
+    std::vector<Edge> edges_;
+};
+
+// Сырое смещённое кольцо: рёбра сдвигаются вправо по ходу на distance, на расходящихся углах — дуга,
+// на сходящихся — петля через исходную вершину (при почти прямом угле — точка пересечения рёбер).
+// Петли имеют неположительное число обхода и отсекаются последующим объединением.
+void offset_ring(std::vector<Point> ring, double distance, double arc_tolerance, std::vector<Point>& out)
+{
+    out.clear();
+    ring.erase(std::unique(ring.begin(), ring.end()), ring.end());
+    while (ring.size() > 1 && ring.front() == ring.back()) {
+        ring.pop_back();
+    }
+    const std::size_t n = ring.size();
+    if (n < 3) return;
+
+    const double r = std::abs(distance);
+    const double step = arc_tolerance < r ? 2.0 * std::acos(1.0 - arc_tolerance / r) : 0.5 * kPI;
+
+    const auto unit = [](const Point& a, const Point& b) {
+        const double len = dist(a, b);
+        return Point{(b.x - a.x) / len, (b.y - a.y) / len};
+    };
+    for (std::size_t i = 0; i < n; ++i) {
+        const Point& prev = ring[i == 0 ? n - 1 : i - 1];
+        const Point& v = ring[i];
+        const Point& next = ring[i + 1 == n ? 0 : i + 1];
+        const Point e1 = unit(prev, v);
+        const Point e2 = unit(v, next);
+        const Point n1{e1.y, -e1.x};
+        const Point n2{e2.y, -e2.x};
+        const Point p1{v.x + distance * n1.x, v.y + distance * n1.y};
+        const Point p2{v.x + distance * n2.x, v.y + distance * n2.y};
+
+        const double cross = e1.x * e2.y - e1.y * e2.x;
+        const double dotp = e1.x * e2.x + e1.y * e2.y;
+        if (cross == 0.0 && dotp > 0.0) {
+            out.push_back(p1);
+            continue;
+        }
+        // Поворот нормали от n1 к n2; разворот на 180° — дугой на стороне смещения
+        const double turn = cross == 0.0 ? (distance > 0.0 ? kPI : -kPI) : std::atan2(cross, dotp);
+        if (turn * distance > 0.0) {
+            const auto steps = static_cast<int>(std::ceil(std::abs(turn) / step));
+            for (int k = 0; k <= steps; ++k) {
+                const double a = turn * k / steps;
+                const double c = std::cos(a), s = std::sin(a);
+                out.push_back({v.x + distance * (n1.x * c - n1.y * s), v.y + distance * (n1.x * s + n1.y * c)});
+            }
+        } else if (dotp > kMiterCos) {
+            // Почти прямой угол: точка пересечения сдвинутых рёбер, петля не нужна
+            const double k = distance / (1.0 + dotp);
+            out.push_back({v.x + k * (n1.x + n2.x), v.y + k * (n1.y + n2.y)});
+        } else {
+            out.push_back(p1);
+            out.push_back(v);
+            out.push_back(p2);
+        }
+    }
+}
+
+} // namespace
+
+namespace {
+
+template <typename Field>
+std::vector<Polygon> offset_polygon_impl(const Field& polygon, double distance, double arc_tolerance)
+{
+    if (!std::isfinite(distance)) {
+        throw std::invalid_argument("offset_polygon: смещение должно быть числом");
+    }
+    if (!(arc_tolerance > 0.0)) {
+        throw std::invalid_argument("offset_polygon: допуск дуги должен быть положительным");
+    }
+
+    Overlay overlay;
+    if (distance == 0.0) {
+        overlay.add_polygon(polygon, 0);
+        return overlay.run(BooleanOp::Union);
+    }
+
+    // Кольца приводятся к ориентации «область слева», тогда сдвиг вправо — наружу от области
+    std::vector<Point> raw;
+    const auto add = [&](span<const Point> ring, bool ccw) {
+        std::vector<Point> oriented(ring.begin(), ring.end());
+        if ((ring_signed_area(ring) > 0.0) != ccw) std::reverse(oriented.begin(), oriented.end());
+        offset_ring(std::move(oriented), distance, arc_tolerance, raw);
+        overlay.add_ring(raw, 0, false);
+    };
+    add(polygon.vertices(), true);
+    for (const auto& h: polygon.holes()) {
+        add(h, false);
+    }
+    return overlay.run(BooleanOp::Union);
+}
+
+} // namespace
+
+std::vector<Polygon> boolean_op(span<const Polygon> subject, span<const Polygon> clip, BooleanOp op)
+{
+    Overlay overlay;
+    for (const Polygon& p: subject) {
+        overlay.add_polygon(p, 0);
+    }
+    for (const Polygon& p: clip) {
+        overlay.add_polygon(p, 1);
+    }
+    return overlay.run(op);
+}
+
+std::vector<Polygon> boolean_op(const FlatPolygons& subject, const FlatPolygons& clip, BooleanOp op)
+{
+    Overlay overlay;
+    for (std::size_t i = 0; i < subject.size(); ++i) {
+        overlay.add_polygon(PolygonView(subject, i), 0);
+    }
+    for (std::size_t i = 0; i < clip.size(); ++i) {
+        overlay.add_polygon(PolygonView(clip, i), 1);
+    }
+    return overlay.run(op);
+}
+
+std::vector<Polygon> boolean_op(const Polygon& subject, const Polygon& clip, BooleanOp op)
+{
+    return boolean_op(span<const Polygon>(&subject, 1), span<const Polygon>(&clip, 1), op);
+}
+
+std::vector<Polygon> boolean_op(const PolygonView& subject, const PolygonView& clip, BooleanOp op)
+{
+    Overlay overlay;
+    overlay.add_polygon(subject, 0);
+    overlay.add_polygon(clip, 1);
+    return overlay.run(op);
+}
+
+std::vector<Polygon> offset_polygon(const Polygon& polygon, double distance, double arc_tolerance)
+{
+    return offset_polygon_impl(polygon, distance, arc_tolerance);
+}
+
+std::vector<Polygon> offset_polygon(const PolygonView& polygon, double distance, double arc_tolerance)
+{
+    return offset_polygon_impl(polygon, distance, arc_tolerance);
+}
+
+} // namespace mylib
@@ -0,0 +1,199 @@
+// src/polygon_set.cpp
+#include <mylib/polygon_set.h>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace mylib {
+
+namespace {
+
+// p указывает внутрь v: вставка из него же может перевыделить буфер под читающим указателем
+template <class T>
+bool points_into(const T* p, const std::pmr::vector<T>& v) noexcept
+{
+    return !v.empty() && !std::less<const T*>{}(p, v.data()) && std::less<const T*>{}(p, v.data() + v.size());
+}
+
+// Дописать range в конец v; range может лежать в самом v
+template <class T>
+void append_range(std::pmr::vector<T>& v, span<const T> range)
+{
+    if (!points_into(range.data(), v)) {
+        v.insert(v.end(), range.begin(), range.end());
+        return;
+    }
+    const auto first = static_cast<std::size_t>(range.data() - v.data());
+    const std::size_t old_size = v.size();
+    v.resize(old_size + range.size());
+    std::copy_n(v.begin() + static_cast<std::ptrdiff_t>(first), range.size(),
+                v.begin() + static_cast<std::ptrdiff_t>(old_size));
+}
+
+} // namespace
+
+// clear() за O(1): разрушение элементов не требует прохода
+static_assert(std::is_trivially_destructible_v<Point> && std::is_trivially_destructible_v<GeoPoint>);
+
+// ==== PolygonView ====
+
+PolygonMetrics PolygonView::metrics() const noexcept
+{
+    const RingList r = rings();
+    return detail::compute_polygon_metrics(r.size(), [&r](std::size_t k) { return r[k]; });
+}
+
+BBox PolygonView::bbox() const noexcept
+{
+    BBox box;
+    for (const Point& p: vertices()) {
+        box.expand(p);
+    }
+    return box;
+}
+
+bool PolygonView::contains(const Point& p) const noexcept
+{
+    const RingList r = rings();
+    return detail::rings_contain(r.size(), [&r](std::size_t k) { return r[k]; }, p);
+}
+
+Polygon PolygonView::to_polygon() const
+{
+    const span<const Point> outer = vertices();
+    std::vector<std::vector<Point>> holes;
+    for (const span<const Point> h: this->holes()) {
+        holes.emplace_back(h.begin(), h.end());
+    }
+    return Polygon(std::vector<Point>(outer.begin(), outer.end()), std::move(holes));
+}
+
+// ==== PolygonSet ====
+
+PolygonSet::PolygonSet(std::pmr::memory_resource* resource)
+    : points_(resource)
+    , ring_offsets_(1, 0, resource)
+    , polygon_rings_(1, 0, resource)
+{
+}
+
+PolygonSet::PolygonSet(const PolygonSet& other, std::pmr::memory_resource* resource)
+    : points_(other.points_, resource)
+    , ring_offsets_(other.ring_offsets_, resource)
+    , polygon_rings_(other.polygon_rings_, resource)
+{
+}
+
+void PolygonSet::reserve(std::size_t polygons, std::size_t rings, std::size_t points)
+{
+    polygon_rings_.reserve(polygons + 1);
+    ring_offsets_.reserve(rings + 1);
+    points_.reserve(points);
+}
+
+void PolygonSet::restore_offsets()
+{
+    if (polygon_rings_.empty()) {
+        ring_offsets_.assign(1, 0);
+        polygon_rings_.assign(1, 0);
+    }
+}
+
+void PolygonSet::append_ring(span<const Point> ring)
+{
+    append_range(points_, ring);
+    ring_offsets_.push_back(points_.size());
+}
+
+std::size_t PolygonSet::add(span<const Point> outer)
+{
+    restore_offsets();
+    append_ring(outer);
+    polygon_rings_.push_back(ring_count());
+    return size() - 1;
+}
+
+std::size_t PolygonSet::add(const Polygon& polygon)
+{
+    const std::size_t i = add(polygon.vertices());
+    for (const auto& h: polygon.holes()) {
+        add_hole(h);
+    }
+    return i;
+}
+
+std::size_t PolygonSet::add(const PolygonView& polygon)
+{
+    // Вид этого же набора устареет после первого перевыделения буферов — добавляем его копию
+    if (points_into(polygon.base_, points_) || points_into(polygon.offsets_.data(), ring_offsets_)) {
+        return add(polygon.to_polygon());
+    }
+    const std::size_t i = add(polygon.vertices());
+    for (const span<const Point> h: polygon.holes()) {
+        add_hole(h);
+    }
+    return i;
+}
+
+void PolygonSet::add_hole(span<const Point> hole)
+{
+    if (empty()) {
+        throw std::logic_error("PolygonSet::add_hole: набор пуст");
+    }
+    append_ring(hole);
+    polygon_rings_.back() = ring_count();
+}
+
+void PolygonSet::clear() noexcept
+{
+    points_.clear();
+    ring_offsets_.resize(1);
+    polygon_rings_.resize(1);
+}
+
+// ==== TrackStore ====
+
+TrackStore::TrackStore(std::pmr::memory_resource* resource)
+    : points_(resource)
+    , offsets_(1, 0, resource)
+{
+}
+
+TrackStore::TrackStore(const TrackStore& other, std::pmr::memory_resource* resource)
+    : points_(other.points_, resource)
+    , offsets_(other.offsets_, resource)
+{
+}
+
+void TrackStore::reserve(std::size_t tracks, std::size_t points)
+{
+    offsets_.reserve(tracks + 1);
+    points_.reserve(points);
+}
+
+std::size_t TrackStore::add(span<const GeoPoint> track)
+{
+    if (offsets_.empty()) offsets_.assign(1, 0); // перемещённый набор
+    append_range(points_, track);
+    offsets_.push_back(points_.size());
+    return size() - 1;
+}
+
+void TrackStore::append(span<const GeoPoint> points)
+{
+    if (empty()) {
+        throw std::logic_error("TrackStore::append: набор пуст");
+    }
+    append_range(points_, points);
+    offsets_.back() = points_.size();
+}
+
+void TrackStore::clear() noexcept
+{
+    points_.clear();
+    offsets_.resize(1);
+}
+
+} // namespace mylib
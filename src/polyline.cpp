@@ -0,0 +1,152 @@
+// src/polyline.cpp
+#include <mylib/polyline.h>
+#include <mylib/kernels.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace mylib {
+
+PolylineIndex::PolylineIndex(std::vector<Point> pts)
+    : pts_(std::move(pts))
+{
+    if (pts_.empty()) {
+        throw std::invalid_argument("Список точек пуст");
+    }
+    s_ = polyline_lengths(pts_);
+}
+
+void PolylineIndex::check_distance(double distance) const
+{
+    // NaN не проходит ни одно сравнение, поэтому проверка записана через отрицание
+    if (!(distance >= 0.0)) {
+        throw std::invalid_argument("Дистанция не может быть отрицательной или NaN");
+    }
+    if (distance > length()) {
+        throw std::invalid_argument("Дистанция больше длины траектории");
+    }
+}
+
+// Требует s_[i-1] <= distance < s_[i]: сегмент заведомо ненулевой
+Point PolylineIndex::interpolate(std::size_t i, double distance) const
+{
+    const Point& p1 = pts_[i - 1];
+    const Point& p2 = pts_[i];
+    const double t = (distance - s_[i - 1]) / (s_[i] - s_[i - 1]);
+    return Point{p1.x + t * (p2.x - p1.x), p1.y + t * (p2.y - p1.y)};
+}
+
+Point PolylineIndex::point_at(double distance) const
+{
+    Cursor cursor;
+    cursor.segment = 0; // заставляет выполнить двоичный поиск
+    return point_at(distance, cursor);
+}
+
+Point PolylineIndex::point_at(double distance, Cursor& cursor) const
+{
+    check_distance(distance);
+
+    if (distance == 0.0) {
+        return pts_.front();
+    }
+    if (distance == length()) {
+        return pts_.back();
+    }
+
+    std::size_t i = cursor.segment;
+    if (i == 0 || i >= s_.size() || distance < s_[i - 1]) {
+        // Первый правый конец с s[i] > distance; нулевые сегменты пропускаются сами собой
+        i = static_cast<std::size_t>(std::upper_bound(s_.begin(), s_.end(), distance) - s_.begin());
+    } else {
+        while (s_[i] <= distance) {
+            ++i; // не выходит за конец: distance < length()
+        }
+    }
+
+    cursor.segment = i;
+    return interpolate(i, distance);
+}
+
+std::vector<Point> PolylineIndex::resample(double step) const
+{
+    if (!(step > 0.0)) {
+        throw std::invalid_argument("Шаг должен быть положительным");
+    }
+
+    const double total = length();
+    const auto count = static_cast<std::size_t>(std::floor(total / step)) + 1;
+
+    std::vector<Point> out;
+    out.reserve(count + 1);
+
+    Cursor cursor;
+    for (std::size_t k = 0; k < count; ++k) {
+        // Умножение, а не накопление: ошибка округления не растёт вдоль пути
+        const double d = std::min(static_cast<double>(k) * step, total);
+        out.push_back(point_at(d, cursor));
+    }
+    if (static_cast<double>(count - 1) * step < total) {
+        out.push_back(pts_.back());
+    }
+    return out;
+}
+
+void PolylineLengthAccumulator::append(const Point& p) noexcept
+{
+    if (count_ > 0) {
+        length_ += dist(last_, p);
+    }
+    last_ = p;
+    ++count_;
+}
+
+void PolylineLengthAccumulator::append(span<const Point> pts) noexcept
+{
+    for (const Point& p: pts) {
+        append(p);
+    }
+}
+
+void PolylineLengthAccumulator::append(span<const Point> pts, span<double> out)
+{
+    if (out.size() != pts.size()) {
+        throw std::invalid_argument("PolylineLengthAccumulator::append: размеры буферов не совпадают");
+    }
+    for (std::size_t i = 0; i < pts.size(); ++i) {
+        append(pts[i]);
+        out[i] = length_;
+    }
+}
+
+void PolylineLengthAccumulator::append(span<const double> xs, span<const double> ys)
+{
+    if (xs.size() != ys.size()) {
+        throw std::invalid_argument("PolylineLengthAccumulator::append: размеры массивов x и y не совпадают");
+    }
+    if (xs.empty()) return;
+
+    append(Point{xs[0], ys[0]});
+
+    // Блок сегментов на стеке: соседние блоки перекрываются на одну точку
+    constexpr std::size_t kBlock = 256;
+    double seg[kBlock];
+    for (std::size_t begin = 0; begin + 1 < xs.size(); begin += kBlock) {
+        const std::size_t m = std::min(kBlock, xs.size() - 1 - begin);
+        segment_lengths_soa(xs.subspan(begin, m + 1), ys.subspan(begin, m + 1), span<double>(seg, m));
+        for (std::size_t i = 0; i < m; ++i) {
+            length_ += seg[i];
+        }
+    }
+    last_ = Point{xs[xs.size() - 1], ys[ys.size() - 1]};
+    count_ += xs.size() - 1;
+}
+
+void PolylineLengthAccumulator::reset() noexcept
+{
+    *this = PolylineLengthAccumulator{};
+}
+
+} // namespace mylib
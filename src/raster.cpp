@@ -0,0 +1,477 @@
+// src/raster.cpp
+#include <mylib/raster.h>
+
+#include <mylib/polygon_set.h>
+
+#include "parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace mylib {
+
+namespace {
+
+// Полоса не короче kMinBandRows строк; до kBandsPerThread полос на поток выравнивают нагрузку
+// между широкими и узкими участками фигуры
+constexpr std::size_t kMinBandRows = 16;
+constexpr std::size_t kBandsPerThread = 4;
+
+// Доли ближе к 0 или 1, чем kSnap, — шум округления префиксной суммы
+constexpr double kSnap = 1e-9;
+
+// Допустимое отклонение хорды веера от окружности, в долях ячейки
+constexpr double kArcTolerance = 0.05;
+
+// Ребро в координатах растра (единица — ячейка), y0 < y1. sign — вклад в долю ячеек справа от ребра
+// на единицу высоты: знак выбран так, что внутренность внешнего контура даёт +1, дыры — -1.
+struct GridEdge {
+    double x0, y0;
+    double x1, y1;
+    double dxdy;
+    double sign;
+};
+
+// Выпуклая часть полосы: рёбра edges[first, last)
+struct Piece {
+    std::size_t first;
+    std::size_t last;
+    double y0;
+    double y1;
+};
+
+void check_grid(const RasterGrid& grid)
+{
+    if (!(grid.cell_size > 0.0) || !std::isfinite(grid.cell_size)) {
+        throw std::invalid_argument("rasterize: размер ячейки должен быть положительным");
+    }
+    const bool overflow = grid.cols != 0 && grid.rows > std::numeric_limits<std::size_t>::max() / grid.cols;
+    if (overflow || grid.cells.size() != grid.cols * grid.rows) {
+        throw std::invalid_argument("rasterize: размер буфера не совпадает с cols * rows");
+    }
+}
+
+Point to_grid(const RasterGrid& grid, const Point& p) noexcept
+{
+    return {(p.x - grid.origin.x) / grid.cell_size, (p.y - grid.origin.y) / grid.cell_size};
+}
+
+// sign — вклад при обходе ребра снизу вверх
+void append_edge(Point a, Point b, double sign, std::vector<GridEdge>& edges)
+{
+    if (a.y == b.y) return; // горизонтальное ребро не меняет долю
+    if (a.y > b.y) {
+        std::swap(a, b);
+        sign = -sign;
+    }
+    edges.push_back({a.x, a.y, b.x, b.y, (b.x - a.x) / (b.y - a.y), sign});
+}
+
+// Для кольца против часовой стрелки префиксная сумма вкладов внутри равна -1 (см. RowCoverage),
+// поэтому знак берётся обратным знаку площади; у дыры — ещё раз обратным
+void append_ring(span<const Point> ring, const RasterGrid& grid, bool hole, std::vector<GridEdge>& edges)
+{
+    const std::size_t n = ring.size();
+    if (n < 3) return;
+    const double area = ring_signed_area(ring);
+    if (area == 0.0) return;
+    const double sign = (area > 0.0 ? -1.0 : 1.0) * (hole ? -1.0 : 1.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        append_edge(to_grid(grid, ring[i]), to_grid(grid, ring[i + 1 == n ? 0 : i + 1]), sign, edges);
+    }
+}
+
+// Точная доля площади ячеек строки. Часть ребра высотой dy со средней абсциссой x в столбце c даёт
+// ячейке c долю dy * (1 - (x - c)), всем ячейкам правее — dy; вклады копятся в acc и разворачиваются
+// префиксной суммой. Части левее растра целиком идут в столбец 0, правее — отбрасываются.
+class RowCoverage {
+public:
+    explicit RowCoverage(std::size_t cols)
+        : cols_(cols)
+        , acc_(cols + 1, 0.0)
+    {
+    }
+
+    void add(const GridEdge& e, double row) noexcept
+    {
+        const double ya = std::max(e.y0, row);
+        const double yb = std::min(e.y1, row + 1.0);
+        if (!(ya < yb)) return;
+        const double xa = e.x0 + (ya - e.y0) * e.dxdy;
+        const double xb = e.x0 + (yb - e.y0) * e.dxdy;
+        add_piece(std::min(xa, xb), std::max(xa, xb), (yb - ya) * e.sign);
+    }
+
+    /// fn(столбец, доля) для ячеек с ненулевой долей; накопитель обнуляется
+    template <typename Fn>
+    void flush(Fn&& fn) noexcept
+    {
+        if (lo_ > hi_) return;
+        double s = 0.0;
+        for (std::size_t c = lo_; c <= hi_; ++c) {
+            s += acc_[c];
+            acc_[c] = 0.0;
+            if (s < kSnap) continue;
+            fn(c, s > 1.0 - kSnap ? 1.0 : s);
+        }
+        acc_[hi_ + 1] = 0.0;
+        lo_ = std::numeric_limits<std::size_t>::max();
+        hi_ = 0;
+    }
+
+private:
+    void add_piece(double lo, double hi, double dy) noexcept
+    {
+        const auto cols = static_cast<double>(cols_);
+        if (lo < 0.0) {
+            const double part = hi > lo ? dy * (std::min(hi, 0.0) - lo) / (hi - lo) : dy;
+            acc_[0] += part;
+            touch(0, 0);
+            if (hi <= 0.0) return;
+            dy -= part;
+            lo = 0.0;
+        }
+        if (lo >= cols) {
+            hi_ = cols_ - 1; // доля, накопленная левее, тянется до края растра
+            return;
+        }
+        if (hi > cols) {
+            dy *= (cols - lo) / (hi - lo);
+            hi = cols;
+        }
+
+        auto c = static_cast<std::size_t>(lo);
+        const std::size_t last = std::min(static_cast<std::size_t>(hi), cols_ - 1);
+        touch(c, last);
+        if (c == last) {
+            cell(c, 0.5 * (lo + hi), dy);
+            return;
+        }
+        const double k = dy / (hi - lo);
+        for (double x = lo; x < hi; ++c) {
+            const double nx = std::min(static_cast<double>(c + 1), hi);
+            cell(c, 0.5 * (x + nx), k * (nx - x));
+            x = nx;
+        }
+    }
+
+    void cell(std::size_t c, double mid, double dy) noexcept
+    {
+        const double f = mid - static_cast<double>(c);
+        acc_[c] += dy * (1.0 - f);
+        acc_[c + 1] += dy * f;
+    }
+
+    void touch(std::size_t first, std::size_t last) noexcept
+    {
+        lo_ = std::min(lo_, first);
+        hi_ = std::max(hi_, last);
+    }
+
+    std::size_t cols_;
+    std::vector<double> acc_; // cols_ + 1
+    std::size_t lo_{std::numeric_limits<std::size_t>::max()};
+    std::size_t hi_{0};
+};
+
+// Ячейки строки с центром внутри: пересечения горизонтали через центры с рёбрами, пары по чёт-нечет
+class RowCenters {
+public:
+    explicit RowCenters(std::size_t cols)
+        : cols_(cols)
+    {
+    }
+
+    void add(const GridEdge& e, double row)
+    {
+        const double y = row + 0.5;
+        if (e.y0 <= y && y < e.y1) {
+            xs_.push_back(e.x0 + (y - e.y0) * e.dxdy);
+        }
+    }
+
+    template <typename Fn>
+    void flush(Fn&& fn)
+    {
+        std::sort(xs_.begin(), xs_.end());
+        const auto last = static_cast<double>(cols_) - 1.0;
+        for (std::size_t i = 0; i + 1 < xs_.size(); i += 2) {
+            // Центр c + 0.5 в [xs_[i], xs_[i + 1])
+            const double c0 = std::max(std::ceil(xs_[i] - 0.5), 0.0);
+            const double c1 = std::min(std::ceil(xs_[i + 1] - 0.5) - 1.0, last);
+            for (double c = c0; c <= c1; ++c) {
+                fn(static_cast<std::size_t>(c), 1.0);
+            }
+        }
+        xs_.clear();
+    }
+
+private:
+    std::size_t cols_;
+    std::vector<double> xs_;
+};
+
+// Запись доли f значения в ячейку
+class CellWriter {
+public:
+    explicit CellWriter(const RasterParams& params)
+        : merge_(params.merge)
+        , value_(params.value)
+    {
+    }
+
+    void operator()(float& out, double f) const noexcept
+    {
+        switch (merge_) {
+        case RasterMerge::Replace:
+            out = static_cast<float>(out + f * (value_ - out));
+            break;
+        case RasterMerge::Max:
+            out = std::max(out, static_cast<float>(f * value_));
+            break;
+        case RasterMerge::Add:
+            out = static_cast<float>(out + f * value_);
+            break;
+        }
+    }
+
+private:
+    RasterMerge merge_;
+    double value_;
+};
+
+// Строки [y0, y1) в координатах растра, обрезанные по растру
+std::pair<std::size_t, std::size_t> row_range(const RasterGrid& grid, double y0, double y1) noexcept
+{
+    const auto rows = static_cast<double>(grid.rows);
+    const double r0 = std::clamp(std::floor(y0), 0.0, rows);
+    const double r1 = std::clamp(std::ceil(y1), 0.0, rows);
+    if (!(r0 < r1)) return {0, 0};
+    return {static_cast<std::size_t>(r0), static_cast<std::size_t>(r1)};
+}
+
+// fn(b0, b1) для полос строк [b0, b1), покрывающих [r0, r1), на threads потоках
+template <typename Fn>
+void for_each_band(std::size_t r0, std::size_t r1, std::size_t threads, Fn&& fn)
+{
+    if (r0 >= r1) return;
+    const std::size_t rows = r1 - r0;
+    threads = detail::resolve_threads(threads);
+    const std::size_t bands = std::clamp<std::size_t>(rows / kMinBandRows, 1, threads * kBandsPerThread);
+    detail::parallel_for(bands, threads,
+                         [&](std::size_t b) { fn(r0 + rows * b / bands, r0 + rows * (b + 1) / bands); });
+}
+
+// Полигон: общий список активных рёбер на полосу
+template <typename Row>
+void burn_edges(std::vector<GridEdge>& edges, const RasterGrid& grid, const RasterParams& params)
+{
+    if (edges.empty()) return;
+    std::sort(edges.begin(), edges.end(), [](const GridEdge& a, const GridEdge& b) { return a.y0 < b.y0; });
+    double y_max = edges.front().y1;
+    for (const GridEdge& e: edges) {
+        y_max = std::max(y_max, e.y1);
+    }
+    const auto [r0, r1] = row_range(grid, edges.front().y0, y_max);
+    const CellWriter write(params);
+
+    for_each_band(r0, r1, params.threads, [&](std::size_t b0, std::size_t b1) {
+        Row row(grid.cols);
+        std::vector<const GridEdge*> active;
+        std::size_t next = 0;
+        for (std::size_t r = b0; r < b1; ++r) {
+            const auto y = static_cast<double>(r);
+            while (next < edges.size() && edges[next].y0 < y + 1.0) {
+                active.push_back(&edges[next++]);
+            }
+            active.erase(std::remove_if(active.begin(), active.end(), [y](const GridEdge* e) { return e->y1 <= y; }),
+                         active.end());
+            for (const GridEdge* e: active) {
+                row.add(*e, y);
+            }
+            float* out = grid.cells.data() + r * grid.cols;
+            row.flush([&](std::size_t c, double f) { write(out[c], f); });
+        }
+    });
+}
+
+template <typename Field>
+void rasterize_field(const Field& polygon, const RasterGrid& grid, const RasterParams& params)
+{
+    check_grid(grid);
+    if (grid.cols == 0 || grid.rows == 0) return;
+    std::vector<GridEdge> edges;
+    append_ring(polygon.vertices(), grid, false, edges);
+    for (const auto& hole: polygon.holes()) {
+        append_ring(hole, grid, true, edges);
+    }
+    if (params.coverage == RasterCoverage::Exact) {
+        burn_edges<RowCoverage>(edges, grid, params);
+    } else {
+        burn_edges<RowCenters>(edges, grid, params);
+    }
+}
+
+// Выпуклая часть полосы в координатах растра
+void append_piece(const std::vector<Point>& poly, std::vector<GridEdge>& edges, std::vector<Piece>& pieces)
+{
+    const std::size_t n = poly.size();
+    double twice_area = 0.0;
+    double y0 = poly[0].y;
+    double y1 = y0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const Point& a = poly[i];
+        const Point& b = poly[i + 1 == n ? 0 : i + 1];
+        twice_area += (a.x - poly[0].x) * (b.y - poly[0].y) - (b.x - poly[0].x) * (a.y - poly[0].y);
+        y0 = std::min(y0, a.y);
+        y1 = std::max(y1, a.y);
+    }
+    if (twice_area == 0.0) return;
+    const double sign = twice_area > 0.0 ? -1.0 : 1.0;
+    const std::size_t first = edges.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        append_edge(poly[i], poly[i + 1 == n ? 0 : i + 1], sign, edges);
+    }
+    pieces.push_back({first, edges.size(), y0, y1});
+}
+
+// Прямоугольники сегментов и веера с внешней стороны поворотов для участка без пропусков (координаты растра)
+void build_run(const std::vector<Point>& g, double h, double step, std::vector<GridEdge>& edges,
+               std::vector<Piece>& pieces)
+{
+    std::vector<Point> poly;
+    for (std::size_t i = 0; i + 1 < g.size(); ++i) {
+        const Point& a = g[i];
+        const Point& b = g[i + 1];
+        const double len = std::hypot(b.x - a.x, b.y - a.y);
+        if (!std::isfinite(len)) continue; // выброс за пределы представимых расстояний
+        const Point d{(b.x - a.x) / len, (b.y - a.y) / len};
+        const Point n{-d.y * h, d.x * h};
+        poly = {{a.x + n.x, a.y + n.y}, {a.x - n.x, a.y - n.y}, {b.x - n.x, b.y - n.y}, {b.x + n.x, b.y + n.y}};
+        append_piece(poly, edges, pieces);
+
+        if (i + 2 >= g.size()) break;
+        const Point& c = g[i + 2];
+        const double len2 = std::hypot(c.x - b.x, c.y - b.y);
+        const Point d2{(c.x - b.x) / len2, (c.y - b.y) / len2};
+        const double turn = std::atan2(d.x * d2.y - d.y * d2.x, d.x * d2.x + d.y * d2.y);
+        if (turn == 0.0 || !std::isfinite(turn)) continue;
+        // Внешняя сторона поворота: справа при повороте налево
+        const double side = turn > 0.0 ? -1.0 : 1.0;
+        const auto steps = static_cast<int>(std::ceil(std::abs(turn) / step));
+        poly.assign(1, b);
+        for (int k = 0; k <= steps; ++k) {
+            const double ang = turn * k / steps;
+            const double cs = std::cos(ang);
+            const double sn = std::sin(ang);
+            poly.push_back({b.x + side * (n.x * cs - n.y * sn), b.y + side * (n.x * sn + n.y * cs)});
+        }
+        append_piece(poly, edges, pieces);
+    }
+}
+
+// Точка с нечисловой координатой (пропуск решения GNSS) разрывает полосу, как выключение агрегата
+// в CoverageAccumulator: участки до и после неё строятся отдельно
+void build_strip(span<const Point> path, double width, const RasterGrid& grid, std::vector<GridEdge>& edges,
+                 std::vector<Piece>& pieces)
+{
+    const double h = 0.5 * width / grid.cell_size;
+    const double step = kArcTolerance < h ? std::min(2.0 * std::acos(1.0 - kArcTolerance / h), 0.25 * kPI) : 0.25 * kPI;
+
+    std::vector<Point> g;
+    g.reserve(path.size());
+    for (const Point& p: path) {
+        const Point q = to_grid(grid, p);
+        if (!std::isfinite(q.x) || !std::isfinite(q.y)) {
+            build_run(g, h, step, edges, pieces);
+            g.clear();
+            continue;
+        }
+        if (g.empty() || !(q == g.back())) g.push_back(q);
+    }
+    build_run(g, h, step, edges, pieces);
+}
+
+// Полоса: доля ячейки — наибольшая по частям; части активны в строках своего диапазона y
+template <typename Row>
+void burn_pieces(const std::vector<GridEdge>& edges, std::vector<Piece>& pieces, const RasterGrid& grid,
+                 const RasterParams& params)
+{
+    if (pieces.empty()) return;
+    std::sort(pieces.begin(), pieces.end(), [](const Piece& a, const Piece& b) { return a.y0 < b.y0; });
+    double y_max = pieces.front().y1;
+    for (const Piece& p: pieces) {
+        y_max = std::max(y_max, p.y1);
+    }
+    const auto [r0, r1] = row_range(grid, pieces.front().y0, y_max);
+    const CellWriter write(params);
+
+    for_each_band(r0, r1, params.threads, [&](std::size_t b0, std::size_t b1) {
+        Row row(grid.cols);
+        std::vector<double> best(grid.cols, 0.0);
+        std::vector<const Piece*> active;
+        std::size_t next = 0;
+        for (std::size_t r = b0; r < b1; ++r) {
+            const auto y = static_cast<double>(r);
+            while (next < pieces.size() && pieces[next].y0 < y + 1.0) {
+                active.push_back(&pieces[next++]);
+            }
+            active.erase(std::remove_if(active.begin(), active.end(), [y](const Piece* p) { return p->y1 <= y; }),
+                         active.end());
+
+            std::size_t lo = grid.cols;
+            std::size_t hi = 0;
+            for (const Piece* p: active) {
+                for (std::size_t k = p->first; k < p->last; ++k) {
+                    row.add(edges[k], y);
+                }
+                row.flush([&](std::size_t c, double f) {
+                    best[c] = std::max(best[c], f);
+                    lo = std::min(lo, c);
+                    hi = std::max(hi, c);
+                });
+            }
+            float* out = grid.cells.data() + r * grid.cols;
+            for (std::size_t c = lo; c <= hi && lo < grid.cols; ++c) {
+                if (best[c] > 0.0) {
+                    write(out[c], best[c]);
+                    best[c] = 0.0;
+                }
+            }
+        }
+    });
+}
+
+} // namespace
+
+void rasterize(const Polygon& polygon, const RasterGrid& grid, const RasterParams& params)
+{
+    rasterize_field(polygon, grid, params);
+}
+
+void rasterize(const PolygonView& polygon, const RasterGrid& grid, const RasterParams& params)
+{
+    rasterize_field(polygon, grid, params);
+}
+
+void rasterize_strip(span<const Point> path, double width, const RasterGrid& grid, const RasterParams& params)
+{
+    check_grid(grid);
+    if (!(width > 0.0) || !std::isfinite(width)) {
+        throw std::invalid_argument("rasterize_strip: ширина полосы должна быть положительной");
+    }
+    if (grid.cols == 0 || grid.rows == 0) return;
+    std::vector<GridEdge> edges;
+    std::vector<Piece> pieces;
+    build_strip(path, width, grid, edges, pieces);
+    if (params.coverage == RasterCoverage::Exact) {
+        burn_pieces<RowCoverage>(edges, pieces, grid, params);
+    } else {
+        burn_pieces<RowCenters>(edges, pieces, grid, params);
+    }
+}
+
+} // namespace mylib
@@ -0,0 +1,290 @@
+// src/simplify.cpp
+#include <mylib/simplify.h>
+
+#include <mylib/polygon_set.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace mylib {
+
+namespace {
+
+// Квадрат расстояния от p до отрезка ab
+double segment_dist2(const Point& p, const Point& a, const Point& b) noexcept
+{
+    const double dx = b.x - a.x, dy = b.y - a.y;
+    const double px = p.x - a.x, py = p.y - a.y;
+    const double len2 = dx * dx + dy * dy;
+    double t = len2 > 0.0 ? (px * dx + py * dy) / len2 : 0.0;
+    t = std::clamp(t, 0.0, 1.0);
+    const double ex = px - t * dx, ey = py - t * dy;
+    return ex * ex + ey * ey;
+}
+
+double triangle_area(const Point& a, const Point& b, const Point& c) noexcept
+{
+    return 0.5 * std::abs((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y));
+}
+
+} // namespace
+
+Simplifier::Simplifier(SimplifyMethod method, double tolerance)
+    : method_(method)
+    , tolerance_(tolerance)
+{
+    if (!(tolerance >= 0.0) || !std::isfinite(tolerance)) {
+        throw std::invalid_argument("Simplifier: допуск должен быть неотрицательным числом");
+    }
+}
+
+// Отрезки [first, last] обходятся через явный стек. last может быть равен pts.size() — это первая точка
+// (замыкающее ребро кольца); внутренние индексы всегда меньше pts.size().
+void Simplifier::mark_douglas_peucker(span<const Point> pts, std::size_t first, std::size_t last)
+{
+    const double tol2 = tolerance_ * tolerance_;
+    const std::size_t n = pts.size();
+    stack_.clear();
+    stack_.push_back(first);
+    stack_.push_back(last);
+    while (!stack_.empty()) {
+        const std::size_t b = stack_.back();
+        stack_.pop_back();
+        const std::size_t a = stack_.back();
+        stack_.pop_back();
+        if (b - a < 2) continue;
+
+        const Point& pa = pts[a];
+        const Point& pb = pts[b % n];
+        double worst = -1.0;
+        std::size_t k = a;
+        for (std::size_t i = a + 1; i < b; ++i) {
+            const double d2 = segment_dist2(pts[i], pa, pb);
+            if (d2 > worst) {
+                worst = d2;
+                k = i;
+            }
+        }
+        if (worst > tol2) {
+            keep_[k] = 1;
+            stack_.push_back(a);
+            stack_.push_back(k);
+            stack_.push_back(k);
+            stack_.push_back(b);
+        }
+    }
+}
+
+// Куча по возрастанию площади; при равенстве раньше удаляется меньший индекс — результат детерминирован
+bool Simplifier::heap_less(std::size_t a, std::size_t b) const noexcept
+{
+    return area_[a] < area_[b] || (area_[a] == area_[b] && a < b);
+}
+
+// Восстановление кучи после изменения ключа элемента в позиции h
+void Simplifier::heap_place(std::size_t h)
+{
+    const std::size_t v = heap_[h];
+    while (h > 0 && heap_less(v, heap_[(h - 1) / 2])) {
+        heap_[h] = heap_[(h - 1) / 2];
+        heap_pos_[heap_[h]] = h;
+        h = (h - 1) / 2;
+    }
+    for (;;) {
+        std::size_t c = 2 * h + 1;
+        if (c >= heap_.size()) break;
+        if (c + 1 < heap_.size() && heap_less(heap_[c + 1], heap_[c])) ++c;
+        if (!heap_less(heap_[c], v)) break;
+        heap_[h] = heap_[c];
+        heap_pos_[heap_[h]] = h;
+        h = c;
+    }
+    heap_[h] = v;
+    heap_pos_[v] = h;
+}
+
+// Вершина с наименьшей эффективной площадью удаляется, пока эта площадь меньше допуска.
+// Площадь соседа после удаления не опускается ниже удалённой — так порядок удаления монотонен.
+// Куча индексная: ключ соседа меняется на месте, поэтому в ней не больше n элементов.
+void Simplifier::mark_visvalingam(span<const Point> pts, bool ring)
+{
+    const std::size_t n = pts.size();
+    prev_.resize(n);
+    next_.resize(n);
+    area_.resize(n);
+    heap_pos_.resize(n);
+    heap_.clear();
+
+    const auto fixed = [&](std::size_t i) { return !ring && (i == 0 || i + 1 == n); };
+    for (std::size_t i = 0; i < n; ++i) {
+        prev_[i] = i == 0 ? n - 1 : i - 1;
+        next_[i] = i + 1 == n ? 0 : i + 1;
+        area_[i] = triangle_area(pts[prev_[i]], pts[i], pts[next_[i]]);
+        if (!fixed(i)) {
+            heap_pos_[i] = heap_.size();
+            heap_.push_back(i);
+        }
+    }
+    for (std::size_t h = heap_.size() / 2; h-- > 0;) {
+        heap_place(h);
+    }
+
+    std::size_t remaining = n;
+    while (!heap_.empty() && area_[heap_.front()] < tolerance_) {
+        if (ring && remaining == 3) break;
+        const std::size_t i = heap_.front();
+        const double floor = area_[i];
+        heap_.front() = heap_.back();
+        heap_pos_[heap_.front()] = 0;
+        heap_.pop_back();
+        if (!heap_.empty()) heap_place(0);
+
+        keep_[i] = 0;
+        --remaining;
+        const std::size_t p = prev_[i], q = next_[i];
+        next_[p] = q;
+        prev_[q] = p;
+        for (const std::size_t j: {p, q}) {
+            if (fixed(j)) continue;
+            area_[j] = std::max(triangle_area(pts[prev_[j]], pts[j], pts[next_[j]]), floor);
+            heap_place(heap_pos_[j]);
+        }
+    }
+}
+
+SimplifyStats Simplifier::compact(span<const Point> in, span<Point> out) const
+{
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        if (keep_[i]) out[k++] = in[i]; // k <= i: безопасно и при out == in
+    }
+    return SimplifyStats{in.size(), k};
+}
+
+SimplifyStats Simplifier::simplify(span<const Point> in, span<Point> out)
+{
+    if (out.size() < in.size()) {
+        throw std::invalid_argument("Simplifier: выходной буфер меньше входа");
+    }
+    const std::size_t n = in.size();
+    if (method_ == SimplifyMethod::DouglasPeucker) {
+        keep_.assign(n, 0);
+        if (n > 0) {
+            keep_.front() = 1;
+            keep_.back() = 1;
+            mark_douglas_peucker(in, 0, n - 1);
+        }
+    } else {
+        keep_.assign(n, 1);
+        if (n > 2) mark_visvalingam(in, false);
+    }
+    return compact(in, out);
+}
+
+SimplifyStats Simplifier::simplify(std::vector<Point>& pts)
+{
+    const SimplifyStats stats =
+        simplify(span<const Point>(pts.data(), pts.size()), span<Point>(pts.data(), pts.size()));
+    pts.resize(stats.output_size);
+    return stats;
+}
+
+SimplifyStats Simplifier::simplify_ring(span<const Point> in, span<Point> out)
+{
+    if (out.size() < in.size()) {
+        throw std::invalid_argument("Simplifier: выходной буфер меньше входа");
+    }
+    const std::size_t n = in.size();
+    if (n <= 3) {
+        keep_.assign(n, 1);
+        return compact(in, out);
+    }
+
+    if (method_ == SimplifyMethod::Visvalingam) {
+        keep_.assign(n, 1);
+        mark_visvalingam(in, true);
+        return compact(in, out);
+    }
+
+    // Кольцо делится на две цепочки: от вершины 0 до самой далёкой от неё вершины f и обратно
+    keep_.assign(n, 0);
+    std::size_t f = 0;
+    double far2 = -1.0;
+    for (std::size_t i = 1; i < n; ++i) {
+        const double dx = in[i].x - in[0].x, dy = in[i].y - in[0].y;
+        if (dx * dx + dy * dy > far2) {
+            far2 = dx * dx + dy * dy;
+            f = i;
+        }
+    }
+    keep_[0] = 1;
+    keep_[f] = 1;
+    mark_douglas_peucker(in, 0, f);
+    mark_douglas_peucker(in, f, n);
+
+    // Вырожденный результат: добавляется вершина, самая далёкая от хорды 0-f
+    if (std::count(keep_.begin(), keep_.end(), 1) < 3) {
+        std::size_t k = 0;
+        double worst = -1.0;
+        for (std::size_t i = 1; i < n; ++i) {
+            if (keep_[i]) continue;
+            const double d2 = segment_dist2(in[i], in[0], in[f]);
+            if (d2 > worst) {
+                worst = d2;
+                k = i;
+            }
+        }
+        keep_[k] = 1;
+    }
+    return compact(in, out);
+}
+
+namespace {
+
+// Field — Polygon или PolygonView: нужны vertices() и перебор holes()
+template <typename Field>
+Polygon simplify_polygon(Simplifier& simplifier, const Field& polygon, SimplifyStats* stats)
+{
+    SimplifyStats total;
+    auto ring = [&](span<const Point> in) {
+        std::vector<Point> out(in.size());
+        const SimplifyStats s = simplifier.simplify_ring(in, out);
+        out.resize(s.output_size);
+        total.input_size += s.input_size;
+        total.output_size += s.output_size;
+        return out;
+    };
+
+    std::vector<Point> outer = ring(polygon.vertices());
+    std::vector<std::vector<Point>> holes;
+    holes.reserve(polygon.holes().size());
+    for (const auto& h: polygon.holes()) {
+        holes.push_back(ring(h));
+    }
+    if (stats) *stats = total;
+    return Polygon(std::move(outer), std::move(holes));
+}
+
+} // namespace
+
+Polygon Simplifier::simplify(const Polygon& polygon, SimplifyStats* stats)
+{
+    return simplify_polygon(*this, polygon, stats);
+}
+
+Polygon Simplifier::simplify(const PolygonView& polygon, SimplifyStats* stats)
+{
+    return simplify_polygon(*this, polygon, stats);
+}
+
+std::vector<Point> simplify_polyline(span<const Point> pts, SimplifyMethod method, double tolerance)
+{
+    std::vector<Point> out(pts.size());
+    Simplifier simplifier(method, tolerance);
+    out.resize(simplifier.simplify(pts, out).output_size);
+    return out;
+}
+
+} // namespace mylib
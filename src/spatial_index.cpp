@@ -0,0 +1,204 @@
+// src/spatial_index.cpp
+#include <mylib/spatial_index.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace mylib {
+
+namespace {
+
+double center_x(const BBox& b) noexcept
+{
+    return 0.5 * (b.min_x + b.max_x);
+}
+
+double center_y(const BBox& b) noexcept
+{
+    return 0.5 * (b.min_y + b.max_y);
+}
+
+// Sort-Tile-Recursive: сортировка по x, нарезка на вертикальные полосы по sqrt(P) узлов,
+// сортировка внутри полосы по y. Соседние группы по capacity элементов становятся узлами.
+template <typename BoxOf>
+void str_order(std::vector<std::size_t>& order, std::size_t capacity, BoxOf box_of)
+{
+    const std::size_t n = order.size();
+    const std::size_t node_count = (n + capacity - 1) / capacity;
+    const auto slices = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(node_count))));
+    const std::size_t slice_size = slices * capacity;
+
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return center_x(box_of(a)) < center_x(box_of(b));
+    });
+    for (std::size_t begin = 0; begin < n; begin += slice_size) {
+        const auto first = order.begin() + static_cast<std::ptrdiff_t>(begin);
+        const auto last = order.begin() + static_cast<std::ptrdiff_t>(std::min(n, begin + slice_size));
+        std::sort(first, last, [&](std::size_t a, std::size_t b) {
+            return center_y(box_of(a)) < center_y(box_of(b));
+        });
+    }
+}
+
+} // namespace
+
+PolygonIndex::PolygonIndex(std::vector<Polygon> polygons, std::size_t node_capacity)
+    : polygons_(std::move(polygons))
+{
+    const std::size_t capacity = std::clamp<std::size_t>(node_capacity, 2, 64);
+
+    std::vector<BBox> boxes(polygons_.size());
+    std::vector<std::size_t> order;
+    order.reserve(polygons_.size());
+    for (std::size_t i = 0; i < polygons_.size(); ++i) {
+        boxes[i] = polygons_[i].bbox();
+        if (!boxes[i].empty()) {
+            order.push_back(i);
+        }
+    }
+    if (order.empty()) return;
+
+    // Листья
+    str_order(order, capacity, [&](std::size_t i) -> const BBox& { return boxes[i]; });
+    items_ = order;
+    item_boxes_.reserve(items_.size());
+    for (std::size_t id: items_) {
+        item_boxes_.push_back(boxes[id]);
+    }
+    for (std::size_t begin = 0; begin < items_.size(); begin += capacity) {
+        Node node{BBox{}, begin, std::min(capacity, items_.size() - begin)};
+        for (std::size_t k = begin; k < begin + node.count; ++k) {
+            node.box.expand(item_boxes_[k]);
+        }
+        nodes_.push_back(node);
+    }
+    leaf_count_ = nodes_.size();
+
+    // Внутренние уровни: узлы уровня переупорядочиваются по STR, затем группируются в родителей
+    std::size_t level_begin = 0;
+    std::size_t level_end = nodes_.size();
+    while (level_end - level_begin > 1) {
+        std::vector<std::size_t> level(level_end - level_begin);
+        std::iota(level.begin(), level.end(), level_begin);
+        str_order(level, capacity, [&](std::size_t i) -> const BBox& { return nodes_[i].box; });
+
+        std::vector<Node> sorted;
+        sorted.reserve(level.size());
+        for (std::size_t i: level) {
+            sorted.push_back(nodes_[i]);
+        }
+        std::copy(sorted.begin(), sorted.end(), nodes_.begin() + static_cast<std::ptrdiff_t>(level_begin));
+
+        for (std::size_t begin = level_begin; begin < level_end; begin += capacity) {
+            Node parent{BBox{}, begin, std::min(capacity, level_end - begin)};
+            for (std::size_t k = begin; k < begin + parent.count; ++k) {
+                parent.box.expand(nodes_[k].box);
+            }
+            nodes_.push_back(parent);
+        }
+        level_begin = level_end;
+        level_end = nodes_.size();
+    }
+}
+
+// Обход узлов, чей прямоугольник содержит точку; fn(id) возвращает true для остановки обхода
+template <typename Visit>
+bool PolygonIndex::visit(std::size_t node, const Point& p, Visit& fn) const
+{
+    const Node& nd = nodes_[node];
+    if (!nd.box.contains(p)) return false;
+
+    if (node < leaf_count_) {
+        for (std::size_t k = nd.first; k < nd.first + nd.count; ++k) {
+            if (item_boxes_[k].contains(p) && fn(items_[k])) return true;
+        }
+        return false;
+    }
+    for (std::size_t k = nd.first; k < nd.first + nd.count; ++k) {
+        if (visit(k, p, fn)) return true;
+    }
+    return false;
+}
+
+template <typename Visit>
+void PolygonIndex::visit(std::size_t node, const BBox& box, Visit& fn) const
+{
+    const Node& nd = nodes_[node];
+    if (!nd.box.intersects(box)) return;
+
+    if (node < leaf_count_) {
+        for (std::size_t k = nd.first; k < nd.first + nd.count; ++k) {
+            if (item_boxes_[k].intersects(box)) fn(items_[k]);
+        }
+        return;
+    }
+    for (std::size_t k = nd.first; k < nd.first + nd.count; ++k) {
+        visit(k, box, fn);
+    }
+}
+
+std::vector<std::size_t> PolygonIndex::query_point(const Point& p) const
+{
+    std::vector<std::size_t> out;
+    query_point(p, out);
+    return out;
+}
+
+void PolygonIndex::query_point(const Point& p, std::vector<std::size_t>& out) const
+{
+    out.clear();
+    if (nodes_.empty()) return;
+
+    auto collect = [&](std::size_t id) {
+        if (polygons_[id].contains(p)) out.push_back(id);
+        return false;
+    };
+    visit(nodes_.size() - 1, p, collect);
+    std::sort(out.begin(), out.end());
+}
+
+std::size_t PolygonIndex::locate(const Point& p) const
+{
+    std::size_t found = npos;
+    if (nodes_.empty()) return found;
+
+    auto first = [&](std::size_t id) {
+        if (!polygons_[id].contains(p)) return false;
+        found = id;
+        return true;
+    };
+    visit(nodes_.size() - 1, p, first);
+    return found;
+}
+
+void PolygonIndex::locate(span<const Point> pts, span<std::size_t> out) const
+{
+    if (pts.size() != out.size()) {
+        throw std::invalid_argument("PolygonIndex::locate: размеры входного и выходного буферов не совпадают");
+    }
+    for (std::size_t i = 0; i < pts.size(); ++i) {
+        out[i] = locate(pts[i]);
+    }
+}
+
+std::vector<std::size_t> PolygonIndex::query_bbox(const BBox& box) const
+{
+    std::vector<std::size_t> out;
+    query_bbox(box, out);
+    return out;
+}
+
+void PolygonIndex::query_bbox(const BBox& box, std::vector<std::size_t>& out) const
+{
+    out.clear();
+    if (nodes_.empty() || box.empty()) return;
+
+    auto collect = [&](std::size_t id) { out.push_back(id); };
+    visit(nodes_.size() - 1, box, collect);
+    std::sort(out.begin(), out.end());
+}
+
+} // namespace mylib
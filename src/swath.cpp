@@ -0,0 +1,242 @@
+// src/swath.cpp
+#include <mylib/swath.h>
+
+#include <mylib/polygon_set.h>
+
+#include "parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace mylib {
+
+namespace {
+
+// Ребро в системе проходов: u — поперёк, v — вдоль; u0 < u1
+struct Edge {
+    double u0, v0;
+    double u1, v1;
+};
+
+void append_ring_edges(span<const Point> ring, const Point& o, const Point& across, const Point& along,
+                       std::vector<Edge>& edges)
+{
+    const std::size_t n = ring.size();
+    if (n < 3) return;
+    for (std::size_t i = 0, j = n - 1; i < n; j = i++) {
+        const double ax = ring[j].x - o.x, ay = ring[j].y - o.y;
+        const double bx = ring[i].x - o.x, by = ring[i].y - o.y;
+        Edge e{dot(ax, ay, across.x, across.y), dot(ax, ay, along.x, along.y), dot(bx, by, across.x, across.y),
+               dot(bx, by, along.x, along.y)};
+        if (e.u0 == e.u1) continue; // параллельно проходам: полуоткрытый интервал пуст
+        if (e.u0 > e.u1) {
+            std::swap(e.u0, e.u1);
+            std::swap(e.v0, e.v1);
+        }
+        edges.push_back(e);
+    }
+}
+
+void check_swath_params(const SwathParams& params)
+{
+    if (!(params.width > 0.0) || !std::isfinite(params.width)) {
+        throw std::invalid_argument("plan_swaths: ширина захвата должна быть положительной");
+    }
+    if (!std::isfinite(params.heading_deg)) {
+        throw std::invalid_argument("plan_swaths: направление проходов должно быть конечным");
+    }
+}
+
+// Проходы в порядке движения: emit(const BoundPoints&). Параметры должны быть проверены.
+// Field — Polygon или PolygonView: нужны vertices() и перебор holes()
+template <typename Field, typename Emit>
+void for_each_swath(const Field& field, const SwathParams& params, Emit&& emit)
+{
+    if (field.vertices().size() < 3) return;
+
+    // Локальная система: начало в первой вершине, v — вдоль прохода, u — вправо от него
+    const double h = deg2rad(params.heading_deg);
+    const Point along{std::sin(h), std::cos(h)};
+    const Point across{along.y, -along.x};
+    const Point o = field.vertices().front();
+
+    std::vector<Edge> edges;
+    append_ring_edges(field.vertices(), o, across, along, edges);
+    for (const auto& hole: field.holes()) {
+        append_ring_edges(hole, o, across, along, edges);
+    }
+    if (edges.empty()) return;
+    std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) { return a.u0 < b.u0; });
+
+    double u_min = edges.front().u0;
+    double u_max = u_min;
+    for (const Edge& e: edges) {
+        u_max = std::max(u_max, e.u1);
+    }
+
+    auto to_world = [&](double u, double v) {
+        return Point{o.x + u * across.x + v * along.x, o.y + u * across.y + v * along.y};
+    };
+
+    std::vector<const Edge*> active;
+    std::vector<double> crossings;
+    std::vector<BoundPoints> line;
+    std::size_t next_edge = 0;
+    bool forward = true;
+
+    for (std::size_t k = 0;; ++k) {
+        const double u = u_min + (static_cast<double>(k) + 0.5) * params.width;
+        if (u >= u_max) break;
+
+        // Ребро пересекает линию, если u0 <= u < u1: общая вершина соседних рёбер считается один раз
+        while (next_edge < edges.size() && edges[next_edge].u0 <= u) {
+            active.push_back(&edges[next_edge++]);
+        }
+        active.erase(std::remove_if(active.begin(), active.end(), [u](const Edge* e) { return e->u1 <= u; }),
+                     active.end());
+
+        crossings.clear();
+        for (const Edge* e: active) {
+            const double t = (u - e->u0) / (e->u1 - e->u0);
+            crossings.push_back(e->v0 + t * (e->v1 - e->v0));
+        }
+        std::sort(crossings.begin(), crossings.end());
+
+        // Пары соседних пересечений ограничивают участки внутри поля
+        line.clear();
+        for (std::size_t i = 0; i + 1 < crossings.size(); i += 2) {
+            const double v0 = crossings[i];
+            const double v1 = crossings[i + 1];
+            if (!(v1 - v0 > 0.0) || v1 - v0 < params.min_length) continue;
+            line.push_back(BoundPoints{to_world(u, v0), to_world(u, v1)});
+        }
+        if (line.empty()) continue;
+
+        if (!forward) {
+            std::reverse(line.begin(), line.end());
+            for (BoundPoints& s: line) {
+                std::swap(s.start, s.end);
+            }
+        }
+        forward = !forward;
+        for (const BoundPoints& s: line) {
+            emit(s);
+        }
+    }
+}
+
+template <typename Field>
+SwathPlan plan_swaths_impl(const Field& field, const SwathParams& params)
+{
+    check_swath_params(params);
+
+    SwathPlan plan;
+    for_each_swath(field, params, [&](const BoundPoints& s) {
+        if (!plan.swaths.empty()) {
+            plan.transition_length += dist(plan.swaths.back().end, s.start);
+        }
+        plan.working_length += dist(s.start, s.end);
+        plan.swaths.push_back(s);
+    });
+
+    plan.path.reserve(2 * plan.swaths.size());
+    for (const BoundPoints& s: plan.swaths) {
+        plan.path.push_back(s.start);
+        plan.path.push_back(s.end);
+    }
+    return plan;
+}
+
+template <typename Field>
+HeadingSweepResult sweep_headings_impl(const Field& field, span<const double> headings_deg,
+                                       const HeadingSweepParams& params)
+{
+    if (headings_deg.empty()) {
+        throw std::invalid_argument("sweep_headings: список направлений пуст");
+    }
+    for (double h: headings_deg) {
+        check_swath_params({params.width, h, params.min_length});
+    }
+
+    HeadingSweepResult result;
+    result.table.resize(headings_deg.size());
+
+    detail::parallel_for(headings_deg.size(), params.threads, [&](std::size_t i) {
+        HeadingCost c;
+        c.heading_deg = headings_deg[i];
+        Point prev_end;
+        for_each_swath(field, {params.width, c.heading_deg, params.min_length}, [&](const BoundPoints& s) {
+            if (c.swaths > 0) {
+                c.transition_length += dist(prev_end, s.start);
+            }
+            c.working_length += dist(s.start, s.end);
+            prev_end = s.end;
+            ++c.swaths;
+        });
+        c.turns = c.swaths == 0 ? 0 : c.swaths - 1;
+        c.cost = c.working_length + c.transition_length + params.turn_cost * static_cast<double>(c.turns);
+        result.table[i] = c;
+    });
+
+    // Последовательная свёртка по индексу: выбор не зависит от порядка завершения потоков
+    for (std::size_t i = 1; i < result.table.size(); ++i) {
+        if (result.table[i].cost < result.table[result.best].cost) {
+            result.best = i;
+        }
+    }
+    return result;
+}
+
+template <typename Field>
+HeadingSweepResult sweep_headings_impl(const Field& field, double step_deg, const HeadingSweepParams& params)
+{
+    if (!(step_deg > 0.0) || !(step_deg <= 180.0)) {
+        throw std::invalid_argument("sweep_headings: шаг перебора должен быть в (0, 180]");
+    }
+    std::vector<double> headings;
+    for (std::size_t k = 0;; ++k) {
+        // Умножение, а не накопление: без дрейфа на сотнях шагов
+        const double h = static_cast<double>(k) * step_deg;
+        if (h >= 180.0) break;
+        headings.push_back(h);
+    }
+    return sweep_headings_impl(field, span<const double>(headings), params);
+}
+
+} // namespace
+
+SwathPlan plan_swaths(const Polygon& field, const SwathParams& params)
+{
+    return plan_swaths_impl(field, params);
+}
+
+SwathPlan plan_swaths(const PolygonView& field, const SwathParams& params)
+{
+    return plan_swaths_impl(field, params);
+}
+
+HeadingSweepResult sweep_headings(const Polygon& field, span<const double> headings_deg,
+                                  const HeadingSweepParams& params)
+{
+    return sweep_headings_impl(field, headings_deg, params);
+}
+
+HeadingSweepResult sweep_headings(const PolygonView& field, span<const double> headings_deg,
+                                  const HeadingSweepParams& params)
+{
+    return sweep_headings_impl(field, headings_deg, params);
+}
+
+HeadingSweepResult sweep_headings(const Polygon& field, double step_deg, const HeadingSweepParams& params)
+{
+    return sweep_headings_impl(field, step_deg, params);
+}
+
+HeadingSweepResult sweep_headings(const PolygonView& field, double step_deg, const HeadingSweepParams& params)
+{
+    return sweep_headings_impl(field, step_deg, params);
+}
+
+} // namespace mylib
@@ -0,0 +1,53 @@
+// src/text_parse.h
+// Внутренний заголовок библиотеки (не устанавливается): разбор текста на месте, без выделения памяти
+#pragma once
+
+#include <mylib/geometry.h>
+
+#include <charconv>
+#include <system_error>
+
+namespace mylib::detail {
+
+inline const char* skip_blanks(const char* p, const char* last) noexcept
+{
+    while (p != last && (*p == ' ' || *p == '\t')) {
+        ++p;
+    }
+    return p;
+}
+
+// Число в [p, last) с пробелами вокруг; p сдвигается за число и пробелы после него
+inline bool parse_double(const char*& p, const char* last, double& value) noexcept
+{
+    p = skip_blanks(p, last);
+    if (p != last && *p == '+') ++p; // from_chars не принимает явный плюс
+    const auto [ptr, ec] = std::from_chars(p, last, value);
+    if (ec != std::errc{}) return false;
+    p = skip_blanks(ptr, last);
+    return true;
+}
+
+enum class CsvLine { Point, Skip, Error };
+
+/// Строка "lat,lon[,alt]" без перевода строки; '\r' в конце допускается.
+/// Пустые строки и строки, начинающиеся с '#', — Skip.
+inline CsvLine parse_csv_line(const char* first, const char* last, GeoPoint& out) noexcept
+{
+    if (last != first && last[-1] == '\r') --last;
+    const char* p = skip_blanks(first, last);
+    if (p == last || *p == '#') return CsvLine::Skip;
+
+    GeoPoint pt;
+    if (!parse_double(p, last, pt.lat) || p == last || *p++ != ',') return CsvLine::Error;
+    if (!parse_double(p, last, pt.lon)) return CsvLine::Error;
+    if (p != last) {
+        double alt = 0.0;
+        if (*p++ != ',' || !parse_double(p, last, alt) || p != last) return CsvLine::Error;
+        pt.alt = alt;
+    }
+    out = pt;
+    return CsvLine::Point;
+}
+
+} // namespace mylib::detail
@@ -0,0 +1,389 @@
+// src/track_stream.cpp
+#include <mylib/track_stream.h>
+
+#include "text_parse.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace mylib {
+
+// ===================================================CSV============================================================
+
+CsvGeoPointSource::CsvGeoPointSource(std::istream& in, bool has_header, std::size_t block_size)
+    : in_(in)
+    , buf_(std::max<std::size_t>(block_size, 64))
+    , skip_header_(has_header)
+{
+}
+
+bool CsvGeoPointSource::parse_line(const char* first, const char* last, GeoPoint& out)
+{
+    ++line_;
+    const detail::CsvLine kind = detail::parse_csv_line(first, last, out);
+    if (kind == detail::CsvLine::Skip) return false;
+    if (skip_header_) {
+        skip_header_ = false;
+        return false;
+    }
+    if (kind == detail::CsvLine::Point) return true;
+
+    if (last != first && last[-1] == '\r') --last;
+    throw std::runtime_error("CsvGeoPointSource: ошибка разбора в строке " + std::to_string(line_) + ": '"
+                             + std::string(first, last) + "'");
+}
+
+std::size_t CsvGeoPointSource::read(span<GeoPoint> out)
+{
+    std::size_t n = 0;
+    while (n < out.size()) {
+        const char* data = buf_.data();
+        const void* nl = std::memchr(data + begin_, '\n', end_ - begin_);
+        if (nl != nullptr) {
+            const auto line_end = static_cast<std::size_t>(static_cast<const char*>(nl) - data);
+            if (parse_line(data + begin_, data + line_end, out[n])) ++n;
+            begin_ = line_end + 1;
+            continue;
+        }
+        if (eof_) {
+            // Последняя строка без перевода строки
+            if (begin_ != end_) {
+                const std::size_t line_end = end_;
+                const std::size_t line_begin = begin_;
+                begin_ = end_;
+                if (parse_line(data + line_begin, data + line_end, out[n])) ++n;
+            }
+            break;
+        }
+
+        // Остаток неполной строки переносится в начало буфера, дальше дочитывается следующий блок
+        std::copy(buf_.begin() + static_cast<std::ptrdiff_t>(begin_), buf_.begin() + static_cast<std::ptrdiff_t>(end_),
+                  buf_.begin());
+        end_ -= begin_;
+        begin_ = 0;
+        if (end_ == buf_.size()) {
+            throw std::runtime_error("CsvGeoPointSource: строка " + std::to_string(line_ + 1)
+                                     + " длиннее буфера чтения");
+        }
+        in_.read(buf_.data() + end_, static_cast<std::streamsize>(buf_.size() - end_));
+        const auto got = static_cast<std::size_t>(in_.gcount());
+        end_ += got;
+        if (got == 0 || !in_) eof_ = true;
+    }
+    return n;
+}
+
+// ================================================PIPELINE==========================================================
+
+namespace {
+
+constexpr std::size_t kNoChunk = static_cast<std::size_t>(-1);
+
+struct Chunk {
+    std::vector<GeoPoint> pts;
+    std::size_t size{0};
+};
+
+} // namespace
+
+struct TrackPipeline::Impl {
+    const IGeoPointToXY& projection;
+    const GeoPoint center;
+    const TrackPipelineConfig config;
+
+    // Все блоки выделяются один раз; между потоками передаются только их номера
+    std::vector<Chunk> chunks;
+    std::vector<std::size_t> free_chunks;  // стек свободных
+    std::vector<std::size_t> ready_chunks; // кольцевая очередь заполненных
+    std::size_t ready_head{0};
+    std::size_t ready_count{0};
+    std::size_t current{kNoChunk}; // блок, заполняемый производителем
+
+    std::mutex mutex;
+    std::condition_variable free_cv;
+    std::condition_variable ready_cv;
+    bool closed{false};
+    bool finished{false};
+    std::exception_ptr error;
+    std::atomic<bool> has_error{false}; // error установлен; читается производителем без мьютекса
+    std::thread worker;
+
+    // Состояние потребителя
+    std::vector<Point> xy;
+    TrackStats stats;
+    double twice_area{0.0};
+
+    // Цепочка подряд идущих выбросов, согласованных между собой, — кандидат на продолжение после разрыва.
+    // Площадь цепочки — относительно её первой точки
+    std::size_t gap_count{0};
+    Point gap_first;
+    Point gap_last;
+    double gap_length{0.0};
+    double gap_twice_area{0.0};
+
+    Impl(const IGeoPointToXY& projection_, const GeoPoint& center_, const TrackPipelineConfig& config_)
+        : projection(projection_)
+        , center(center_)
+        , config(config_)
+        , chunks(config_.chunk_count)
+        , ready_chunks(config_.chunk_count)
+        , xy(config_.chunk_size)
+    {
+        free_chunks.reserve(chunks.size());
+        for (std::size_t i = chunks.size(); i-- > 0;) {
+            chunks[i].pts.resize(config.chunk_size);
+            free_chunks.push_back(i);
+        }
+        worker = std::thread([this] { consume(); });
+    }
+
+    void check_open()
+    {
+        if (finished) {
+            throw std::logic_error("TrackPipeline: конвейер уже завершён");
+        }
+        if (has_error.load(std::memory_order_acquire)) {
+            const std::lock_guard<std::mutex> lock(mutex);
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Свободный блок для производителя; ждёт, пока потребитель не вернёт хотя бы один
+    std::size_t acquire()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        free_cv.wait(lock, [this] { return !free_chunks.empty() || error; });
+        if (error) std::rethrow_exception(error);
+        const std::size_t i = free_chunks.back();
+        free_chunks.pop_back();
+        chunks[i].size = 0;
+        return i;
+    }
+
+    void submit(std::size_t i)
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            ready_chunks[(ready_head + ready_count) % ready_chunks.size()] = i;
+            ++ready_count;
+        }
+        ready_cv.notify_one();
+    }
+
+    // Текущий блок производителя, при заполнении — отправка и взятие следующего
+    Chunk& current_chunk()
+    {
+        if (current != kNoChunk && chunks[current].size == config.chunk_size) {
+            submit(std::exchange(current, kNoChunk));
+        }
+        if (current == kNoChunk) {
+            current = acquire();
+        }
+        return chunks[current];
+    }
+
+    void consume()
+    {
+        for (;;) {
+            std::size_t i = kNoChunk;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                ready_cv.wait(lock, [this] { return ready_count > 0 || closed; });
+                if (ready_count == 0) return; // closed и очередь пуста
+                i = ready_chunks[ready_head];
+                ready_head = (ready_head + 1) % ready_chunks.size();
+                --ready_count;
+            }
+
+            // После ошибки блоки только возвращаются, чтобы производитель не завис в acquire
+            bool failed = false;
+            {
+                const std::lock_guard<std::mutex> lock(mutex);
+                failed = static_cast<bool>(error);
+            }
+            if (!failed) {
+                try {
+                    process(chunks[i]);
+                } catch (...) {
+                    const std::lock_guard<std::mutex> lock(mutex);
+                    error = std::current_exception();
+                    has_error.store(true, std::memory_order_release);
+                }
+            }
+            {
+                const std::lock_guard<std::mutex> lock(mutex);
+                free_chunks.push_back(i);
+            }
+            free_cv.notify_one();
+        }
+    }
+
+    void process(const Chunk& chunk)
+    {
+        const std::size_t n = chunk.size;
+        projection.geo_to_xy_batch(center, span<const GeoPoint>(chunk.pts.data(), n), span<Point>(xy.data(), n));
+        stats.points_in += n;
+
+        for (std::size_t k = 0; k < n; ++k) {
+            const Point& p = xy[k];
+            if (!std::isfinite(p.x) || !std::isfinite(p.y)) continue;
+
+            if (stats.points_accepted == 0) {
+                stats.first = p;
+                stats.last = p;
+                stats.points_accepted = 1;
+                continue;
+            }
+            const double d = dist(stats.last, p);
+            if (d < config.min_step) continue;
+            if (d > config.max_step) {
+                extend_gap(p);
+                continue;
+            }
+
+            // Площадь относительно первой точки: замыкающее ребро к ней даёт ноль
+            twice_area += cross(stats.last, p, stats.first);
+            stats.length += d;
+            stats.last = p;
+            ++stats.points_accepted;
+            gap_count = 0;
+        }
+    }
+
+    // Удвоенная площадь треугольника (o, a, b)
+    static double cross(const Point& a, const Point& b, const Point& o) noexcept
+    {
+        return (a.x - o.x) * (b.y - o.y) - (b.x - o.x) * (a.y - o.y);
+    }
+
+    void extend_gap(const Point& p)
+    {
+        if (config.reanchor_after == 0) return;
+        if (gap_count > 0) {
+            const double d = dist(gap_last, p);
+            if (d < config.min_step) return;
+            if (d <= config.max_step) {
+                gap_twice_area += cross(gap_last, p, gap_first);
+                gap_length += d;
+                gap_last = p;
+                ++gap_count;
+                if (gap_count >= config.reanchor_after) reanchor();
+                return;
+            }
+        }
+        // Первый выброс или не согласован с цепочкой: цепочка начинается заново
+        gap_first = p;
+        gap_last = p;
+        gap_count = 1;
+        gap_length = 0.0;
+        gap_twice_area = 0.0;
+        if (gap_count >= config.reanchor_after) reanchor();
+    }
+
+    // Трек продолжается цепочкой выбросов; ребро скачка не входит ни в длину, ни в площадь
+    void reanchor()
+    {
+        if (stats.points_accepted == 1) {
+            // Одиночная первая точка — сама выброс
+            stats.first = gap_first;
+            stats.points_accepted = 0;
+            twice_area = gap_twice_area;
+        } else {
+            // Перенос площади цепочки к первой точке трека
+            const double dx = gap_first.x - stats.first.x, dy = gap_first.y - stats.first.y;
+            twice_area += gap_twice_area + dx * (gap_last.y - gap_first.y) - dy * (gap_last.x - gap_first.x);
+            ++stats.gaps;
+        }
+        stats.length += gap_length;
+        stats.last = gap_last;
+        stats.points_accepted += gap_count;
+        gap_count = 0;
+    }
+
+    void close() noexcept
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+        ready_cv.notify_one();
+        if (worker.joinable()) worker.join();
+    }
+};
+
+TrackPipeline::TrackPipeline(const IGeoPointToXY& projection, const GeoPoint& center, TrackPipelineConfig config)
+{
+    if (config.chunk_size == 0 || config.chunk_count == 0) {
+        throw std::invalid_argument("TrackPipeline: размер и число блоков должны быть положительными");
+    }
+    if (!(config.min_step >= 0.0) || !(config.max_step >= config.min_step)) {
+        throw std::invalid_argument("TrackPipeline: требуется 0 <= min_step <= max_step");
+    }
+    impl_ = std::make_unique<Impl>(projection, center, config);
+}
+
+TrackPipeline::~TrackPipeline()
+{
+    impl_->close();
+}
+
+void TrackPipeline::push(span<const GeoPoint> pts)
+{
+    impl_->check_open();
+    while (!pts.empty()) {
+        Chunk& chunk = impl_->current_chunk();
+        const std::size_t m = std::min(pts.size(), impl_->config.chunk_size - chunk.size);
+        std::copy(pts.begin(), pts.begin() + m, chunk.pts.begin() + static_cast<std::ptrdiff_t>(chunk.size));
+        chunk.size += m;
+        pts = pts.subspan(m);
+    }
+}
+
+void TrackPipeline::push(const GeoPoint& p)
+{
+    push(span<const GeoPoint>(&p, 1));
+}
+
+void TrackPipeline::run(IGeoPointSource& source)
+{
+    impl_->check_open();
+    for (;;) {
+        Chunk& chunk = impl_->current_chunk();
+        const std::size_t room = impl_->config.chunk_size - chunk.size;
+        const std::size_t got = source.read(span<GeoPoint>(chunk.pts.data() + chunk.size, room));
+        if (got == 0) break;
+        chunk.size += got;
+    }
+}
+
+TrackStats TrackPipeline::finish()
+{
+    Impl& im = *impl_;
+    if (!im.finished) {
+        im.finished = true;
+        if (im.current != kNoChunk) {
+            if (im.chunks[im.current].size > 0) {
+                im.submit(im.current);
+            } else {
+                const std::lock_guard<std::mutex> lock(im.mutex);
+                im.free_chunks.push_back(im.current);
+            }
+            im.current = kNoChunk;
+        }
+        im.close();
+        im.stats.enclosed_area = 0.5 * im.twice_area;
+    }
+    if (im.error) std::rethrow_exception(im.error);
+    return im.stats;
+}
+
+} // namespace mylib
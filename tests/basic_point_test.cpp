@@ -0,0 +1,156 @@
+// tests/basic_point_test.cpp
+#include <mylib/geometry.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Челнок в локальных координатах поля, шаг ~1 м
+template <class P>
+std::vector<P> shuttle(std::size_t n)
+{
+    using T = typename P::value_type;
+    std::vector<P> pts(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double x = static_cast<double>(i % 500);
+        const double y = 12.0 * static_cast<double>(i / 500) + 0.1 * std::sin(0.01 * static_cast<double>(i));
+        if constexpr (P::dimension == 2) {
+            pts[i] = P{static_cast<T>(x), static_cast<T>(y)};
+        } else {
+            pts[i] = P{static_cast<T>(x), static_cast<T>(y), static_cast<T>(0.5 * std::cos(0.02 * x))};
+        }
+    }
+    return pts;
+}
+
+} // namespace
+
+TEST(basic_point_test, point_is_double_2d_instantiation)
+{
+    static_assert(std::is_same_v<Point, BasicPoint<double, 2>>);
+    static_assert(sizeof(Point2f) == 8);
+    static_assert(sizeof(Point) == 16);
+    static_assert(sizeof(Point3f) == 12);
+    static_assert(sizeof(Point3d) == 24);
+    static_assert(std::is_trivially_copyable_v<Point2f> && std::is_trivially_copyable_v<Point3d>);
+
+    constexpr Point3f p{1.0f, 2.0f, 3.0f};
+    EXPECT_EQ(p, Point3f(1.0f, 2.0f, 3.0f));
+    EXPECT_FALSE(p == Point3f(1.0f, 2.0f, 4.0f));
+}
+
+TEST(basic_point_test, dist_and_dot)
+{
+    EXPECT_FLOAT_EQ(dist(Point2f{0.0f, 0.0f}, Point2f{3.0f, 4.0f}), 5.0f);
+    EXPECT_DOUBLE_EQ(dist(Point3d{1, 2, 3}, Point3d{3, 5, 9}), 7.0);
+    EXPECT_FLOAT_EQ(dot(Point3f{1, 2, 3}, Point3f{4, -5, 6}), 12.0f);
+    EXPECT_DOUBLE_EQ(dot(Point2d{1, 2}, Point2d{3, 4}), dot(1.0, 2.0, 3.0, 4.0));
+
+    // Для Point — прежняя нешаблонная функция
+    static_assert(std::is_same_v<decltype(dist(Point{}, Point{})), double>);
+    EXPECT_EQ(dist(Point{0, 0}, Point{3, 4}), 5.0);
+}
+
+TEST(basic_point_test, float_lengths_track_double_reference)
+{
+    const auto pd = shuttle<Point>(20000);
+    std::vector<Point2f> pf(pd.size());
+    for (std::size_t i = 0; i < pd.size(); ++i) {
+        pf[i] = {static_cast<float>(pd[i].x), static_cast<float>(pd[i].y)};
+    }
+
+    const std::vector<double> ref = polyline_lengths(pd);
+    const std::vector<float> sf = polyline_lengths(pf);
+    ASSERT_EQ(sf.size(), ref.size());
+    // Сумма в double: расхождение — только от округления координат, не растёт как n * eps * L
+    EXPECT_NEAR(sf.back(), ref.back(), 1e-6 * ref.back());
+
+    std::vector<double> sd(pd.size());
+    polyline_lengths(span<const Point2d>(pd), span<double>(sd));
+    for (std::size_t i = 0; i < sd.size(); ++i) {
+        ASSERT_EQ(sd[i], ref[i]);
+    }
+
+    std::vector<float> bad(3);
+    EXPECT_THROW(polyline_lengths(span<const Point2f>(pf), span<float>(bad)), std::invalid_argument);
+    EXPECT_EQ(polyline_lengths(std::vector<Point3f>{}).size(), 1u);
+}
+
+TEST(basic_point_test, point_on_path_matches_double_api)
+{
+    const auto pd = shuttle<Point>(3000);
+    const double length = polyline_lengths(pd).back();
+    for (const double d: {0.0, 0.25, 1.0, 499.5, 0.5 * length, length - 1e-3, length}) {
+        const Point expected = point_on_path(pd, d);
+        const Point got = point_on_path(span<const Point>(pd), d);
+        EXPECT_NEAR(got.x, expected.x, 1e-9) << d;
+        EXPECT_NEAR(got.y, expected.y, 1e-9) << d;
+    }
+    EXPECT_EQ(point_on_path(span<const Point>(pd), length), pd.back());
+
+    const auto p3 = shuttle<Point3f>(1000);
+    const Point3f mid = point_on_path(p3, 250.0);
+    EXPECT_NEAR(mid.x, 250.0f, 0.05f);
+    EXPECT_NEAR(mid.z, 0.5f * std::cos(0.02f * mid.x), 0.01f);
+
+    EXPECT_THROW(point_on_path(std::vector<Point2f>{}, 0.0), std::invalid_argument);
+    EXPECT_THROW(point_on_path(p3, -1.0), std::invalid_argument);
+    EXPECT_THROW(point_on_path(p3, 1e9), std::invalid_argument);
+    // Путь из одной точки и повторяющиеся точки
+    EXPECT_EQ(point_on_path(std::vector<Point2f>{{1, 2}}, 0.0), Point2f(1, 2));
+    EXPECT_EQ(point_on_path(std::vector<Point2f>{{0, 0}, {0, 0}, {2, 0}}, 1.0), Point2f(1, 0));
+}
+
+TEST(basic_point_test, float_polygon_matches_polygon)
+{
+    const std::vector<Point> outer{{0, 0}, {100, 0}, {100, 60}, {40, 80}, {0, 60}};
+    const std::vector<Point> hole{{20, 20}, {20, 40}, {40, 40}, {40, 20}};
+    const Polygon ref(outer, {hole});
+
+    const auto to_f = [](const std::vector<Point>& ring) {
+        std::vector<Point2f> out;
+        for (const Point& p: ring) {
+            out.push_back({static_cast<float>(p.x), static_cast<float>(p.y)});
+        }
+        return out;
+    };
+    auto closed = to_f(outer);
+    closed.push_back(closed.front());
+    const Polygon2f poly(closed, {to_f(hole)});
+
+    EXPECT_EQ(poly.vertices().size(), outer.size());
+    EXPECT_DOUBLE_EQ(poly.area(), ref.area());
+    EXPECT_DOUBLE_EQ(poly.signed_area(), ref.signed_area());
+    EXPECT_NEAR(poly.perimeter(), ref.perimeter(), 1e-4);
+    EXPECT_EQ(poly.bbox().max_y, 80.0);
+    for (const Point& q: std::vector<Point>{{10, 10}, {30, 30}, {90, 65}, {60, 75}, {-1, 5}, {50, 50}}) {
+        const Point2f qf{static_cast<float>(q.x), static_cast<float>(q.y)};
+        EXPECT_EQ(poly.contains(qf), ref.contains(q)) << q.x << "," << q.y;
+    }
+}
+
+TEST(basic_point_test, double_polygon_matches_polygon_exactly)
+{
+    // Далеко от начала координат, чтобы разница в суммировании была видна
+    std::vector<Point> outer;
+    for (int i = 0; i < 37; ++i) {
+        const double a = 2.0 * kPI * i / 37.0;
+        outer.push_back({500000.0 + 300.0 * std::cos(a), 6200000.0 + 170.0 * std::sin(a)});
+    }
+    const std::vector<Point> hole{{500010.0, 6200010.0}, {500010.0, 6200030.0}, {500040.0, 6200030.0}};
+    const Polygon ref(outer, {hole});
+    const BasicPolygon<double> poly(outer, {hole});
+
+    EXPECT_EQ(poly.signed_area(), ref.signed_area());
+    EXPECT_EQ(poly.perimeter(), ref.perimeter());
+    EXPECT_EQ(poly.centroid(), ref.centroid());
+    EXPECT_EQ(poly.metrics().signed_area, ref.signed_area());
+    EXPECT_EQ(poly.contains({500020.0, 6200020.0}), ref.contains({500020.0, 6200020.0}));
+    EXPECT_EQ(poly.contains({500100.0, 6200000.0}), ref.contains({500100.0, 6200000.0}));
+}
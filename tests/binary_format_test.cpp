@@ -0,0 +1,173 @@
+// tests/binary_format_test.cpp
+#include <mylib/binary_format.h>
+#include <mylib/kernels.h>
+#include <mylib/polygon_set.h>
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Временный файл, удаляемый в деструкторе
+struct TempPath {
+    std::string path;
+
+    explicit TempPath(const std::string& name)
+        : path((std::filesystem::temp_directory_path() / ("mylib_" + name)).string())
+    {
+    }
+    ~TempPath() { std::remove(path.c_str()); }
+};
+
+} // namespace
+
+TEST(binary_format_test, points_round_trip)
+{
+    const TempPath tmp("points.bin");
+    const std::vector<Point> pts{{1.0, 2.0}, {-3.5, 4.25}, {1e300, -0.0}};
+    write_points_file(tmp.path, pts);
+
+    const PointsFile file(tmp.path);
+    ASSERT_EQ(file.size(), pts.size());
+    for (std::size_t i = 0; i < pts.size(); ++i) {
+        EXPECT_EQ(file.points()[i], pts[i]);
+    }
+    // Span из отображения годится для функций геометрии напрямую
+    std::vector<double> s(pts.size());
+    polyline_lengths(file.points().first(2), span<double>(s.data(), 2));
+    EXPECT_DOUBLE_EQ(s[1], dist(pts[0], pts[1]));
+}
+
+TEST(binary_format_test, geo_points_keep_nullable_altitude)
+{
+    const TempPath tmp("geo.bin");
+    std::vector<GeoPoint> pts;
+    for (int i = 0; i < 19; ++i) {
+        pts.push_back({55.0 + i * 1e-3, 37.0 - i * 1e-3, i % 3 == 0 ? std::optional<double>(100.0 + i) : std::nullopt});
+    }
+    write_geo_points_file(tmp.path, pts);
+
+    const GeoPointsFile file(tmp.path);
+    ASSERT_EQ(file.size(), pts.size());
+    for (std::size_t i = 0; i < pts.size(); ++i) {
+        EXPECT_EQ(file.lat()[i], pts[i].lat);
+        EXPECT_EQ(file.lon()[i], pts[i].lon);
+        EXPECT_EQ(file.alt(i), pts[i].alt);
+    }
+    const auto copy = file.to_vector();
+    EXPECT_EQ(copy.back().alt, pts.back().alt);
+
+    // Столбцы подаются в SoA-ядро без копирования
+    std::vector<double> x(pts.size()), y(pts.size());
+    equirect_forward_soa(pts[0], file.lat(), file.lon(), x, y);
+    EXPECT_EQ(x[0], 0.0);
+    EXPECT_EQ(y[0], 0.0);
+}
+
+TEST(binary_format_test, polygons_round_trip_with_holes)
+{
+    const TempPath tmp("polygons.bin");
+    const std::vector<Polygon> polygons{
+        Polygon({{0.0, 0.0}, {10.0, 0.0}, {10.0, 10.0}, {0.0, 10.0}},
+                {{{1.0, 1.0}, {2.0, 1.0}, {2.0, 2.0}}, {{5.0, 5.0}, {6.0, 5.0}, {6.0, 6.0}, {5.0, 6.0}}}),
+        Polygon({}),
+        Polygon({{20.0, 20.0}, {30.0, 20.0}, {25.0, 30.0}}),
+    };
+    write_polygons_file(tmp.path, polygons);
+
+    const PolygonsFile file(tmp.path);
+    ASSERT_EQ(file.size(), 3u);
+    EXPECT_EQ(file.ring_count(0), 3u);
+    EXPECT_EQ(file.ring_count(1), 1u);
+    EXPECT_TRUE(file.outer(1).empty());
+    EXPECT_EQ(file.ring(0, 2).size(), 4u);
+    EXPECT_EQ(file.vertices().size(), 4u + 3u + 4u + 3u);
+
+    const auto loaded = file.to_vector();
+    for (std::size_t i = 0; i < polygons.size(); ++i) {
+        EXPECT_EQ(loaded[i].vertices(), polygons[i].vertices());
+        EXPECT_EQ(loaded[i].holes(), polygons[i].holes());
+        EXPECT_DOUBLE_EQ(loaded[i].area(), polygons[i].area());
+    }
+    EXPECT_DOUBLE_EQ(ring_signed_area(file.outer(2)), polygons[2].signed_area());
+}
+
+TEST(binary_format_test, empty_collections)
+{
+    const TempPath tmp("empty.bin");
+    write_geo_points_file(tmp.path, {});
+    EXPECT_EQ(GeoPointsFile(tmp.path).size(), 0u);
+    write_polygons_file(tmp.path, std::vector<Polygon>{});
+    EXPECT_EQ(PolygonsFile(tmp.path).size(), 0u);
+    write_polygons_file(tmp.path, FlatPolygons{});
+    EXPECT_EQ(PolygonsFile(tmp.path).size(), 0u);
+}
+
+TEST(binary_format_test, flat_polygons_match_polygon_writer)
+{
+    const std::vector<Polygon> polygons{
+        Polygon({{0.0, 0.0}, {10.0, 0.0}, {10.0, 10.0}, {0.0, 10.0}}, {{{1.0, 1.0}, {2.0, 1.0}, {2.0, 2.0}}}),
+        Polygon({{20.0, 20.0}, {30.0, 20.0}, {25.0, 30.0}}),
+        Polygon({{40.0, 0.0}, {50.0, 0.0}, {50.0, 5.0}}, {{{45.0, 1.0}, {46.0, 1.0}, {46.0, 2.0}}}),
+    };
+    PolygonSet set;
+    for (const Polygon& p: polygons) {
+        set.add(p);
+    }
+
+    const TempPath from_vector("polygons_vector.bin");
+    const TempPath from_set("polygons_set.bin");
+    write_polygons_file(from_vector.path, polygons);
+    write_polygons_file(from_set.path, set.flat());
+    std::ifstream a(from_vector.path, std::ios::binary);
+    std::ifstream b(from_set.path, std::ios::binary);
+    const std::string bytes_a((std::istreambuf_iterator<char>(a)), std::istreambuf_iterator<char>());
+    const std::string bytes_b((std::istreambuf_iterator<char>(b)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(bytes_a, bytes_b);
+
+    // Вид на часть набора: смещения в файле отсчитываются от его первого кольца и вершины
+    const FlatPolygons all = set.flat();
+    const FlatPolygons tail{all.points, all.ring_offsets, all.polygon_rings.subspan(1)};
+    write_polygons_file(from_set.path, tail);
+    const auto loaded = PolygonsFile(from_set.path).to_vector();
+    ASSERT_EQ(loaded.size(), 2u);
+    EXPECT_EQ(loaded[0].vertices(), polygons[1].vertices());
+    EXPECT_EQ(loaded[1].vertices(), polygons[2].vertices());
+    EXPECT_EQ(loaded[1].holes(), polygons[2].holes());
+
+    const std::vector<std::size_t> broken{0, 9}; // колец в наборе пять
+    EXPECT_THROW(write_polygons_file(from_set.path, FlatPolygons{all.points, all.ring_offsets, broken}),
+                 std::invalid_argument);
+}
+
+TEST(binary_format_test, rejects_foreign_and_damaged_files)
+{
+    const TempPath tmp("bad.bin");
+    EXPECT_THROW(PointsFile("/nonexistent/mylib.bin"), std::runtime_error);
+
+    write_points_file(tmp.path, std::vector<Point>(100));
+    EXPECT_THROW(PolygonsFile{tmp.path}, std::runtime_error); // другой вид данных
+
+    // Обрезанный файл: секция выходит за границы
+    std::filesystem::resize_file(tmp.path, 64 + 100);
+    EXPECT_THROW(PointsFile{tmp.path}, std::runtime_error);
+
+    {
+        std::ofstream out(tmp.path, std::ios::binary | std::ios::trunc);
+        out << std::string(128, 'x');
+    }
+    EXPECT_THROW(PointsFile{tmp.path}, std::runtime_error); // неверная сигнатура
+
+    {
+        std::ofstream out(tmp.path, std::ios::binary | std::ios::trunc);
+        out << "AGRO";
+    }
+    EXPECT_THROW(PointsFile{tmp.path}, std::runtime_error); // короче заголовка
+}
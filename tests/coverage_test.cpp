@@ -0,0 +1,224 @@
+// tests/coverage_test.cpp
+#include <mylib/coverage.h>
+#include <mylib/polygon_ops.h>
+#include <mylib/swath.h>
+
+#include "test_helpers.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace mylib;
+
+TEST(coverage_test, straight_pass)
+{
+    CoverageAccumulator acc(rect(0, 0, 100, 100), 0.1);
+    EXPECT_NEAR(acc.field_area(), 10000.0, 1e-6);
+
+    acc.add({10.0, 50.0}, 6.0);
+    EXPECT_EQ(acc.covered_area(), 0.0);
+    acc.add({90.0, 50.0}, 6.0);
+    EXPECT_NEAR(acc.covered_area(), 80.0 * 6.0, 80.0 * 0.1 + 6.0 * 0.1);
+    EXPECT_DOUBLE_EQ(acc.applied_area(), acc.covered_area());
+    EXPECT_NEAR(acc.coverage_ratio(), acc.covered_area() / 10000.0, 1e-12);
+}
+
+TEST(coverage_test, repeated_pass_counts_once)
+{
+    CoverageAccumulator acc(rect(0, 0, 100, 100), 0.25);
+    for (int k = 0; k < 3; ++k) {
+        acc.break_track();
+        acc.add({10.0, 50.0}, 6.0);
+        acc.add({90.0, 50.0}, 6.0);
+    }
+    EXPECT_NEAR(acc.covered_area(), 80.0 * 6.0, 80.0 * 0.25 + 6.0 * 0.25);
+    EXPECT_DOUBLE_EQ(acc.applied_area(), 3.0 * acc.covered_area());
+
+    // Туда и обратно без выключения штанги — один проход: разворот не считается перекрытием
+    acc.reset();
+    const std::vector<Point> there_and_back{{10, 50}, {90, 50}, {10, 50}, {90, 50}};
+    acc.add(there_and_back, 6.0);
+    const double fan = 4.0 * 0.5 * 9.0 * std::sin(0.25 * kPI);
+    EXPECT_NEAR(acc.covered_area(), 80.0 * 6.0 + 2.0 * fan, 80.0 * 0.25 + 6.0 * 0.25);
+    EXPECT_DOUBLE_EQ(acc.applied_area(), acc.covered_area());
+}
+
+TEST(coverage_test, noisy_single_pass_has_no_overlap)
+{
+    // 20 Гц, шаг 0.15 м, штанга 24 м: соседние прямоугольники почти целиком перекрываются
+    const Polygon field = rect(0, 0, 400, 60);
+    std::mt19937 rng(11);
+    for (const double sigma: {0.0, 0.02, 0.05}) {
+        std::normal_distribution<double> noise(0.0, sigma > 0.0 ? sigma : 1.0);
+        CoverageAccumulator acc(field, 0.25);
+        for (double x = 10.0; x <= 390.0; x += 0.15) {
+            acc.add({x, 30.0 + (sigma > 0.0 ? noise(rng) : 0.0)}, 24.0);
+        }
+        // Дрожание курса поворачивает штангу — покрытая площадь немного растёт, но не в разы
+        EXPECT_NEAR(acc.covered_area(), 380.0 * 24.0, 0.03 * 380.0 * 24.0) << sigma;
+        EXPECT_DOUBLE_EQ(acc.applied_area(), acc.covered_area()) << sigma;
+    }
+
+    // Дуга: веера на каждом стыке перекрывают прямоугольники внутри прохода
+    CoverageAccumulator arc(rect(-100, -100, 100, 100), 0.25);
+    for (int k = 0; k <= 600; ++k) {
+        const double t = kPI * k / 600.0;
+        arc.add({50.0 * std::cos(t), 50.0 * std::sin(t)}, 12.0);
+    }
+    EXPECT_NEAR(arc.covered_area(), 0.5 * kPI * (56.0 * 56.0 - 44.0 * 44.0), 20.0);
+    EXPECT_DOUBLE_EQ(arc.applied_area(), arc.covered_area());
+
+    // Второй проход по той же дуге — полное перекрытие
+    arc.break_track();
+    for (int k = 0; k <= 600; ++k) {
+        const double t = kPI * k / 600.0;
+        arc.add({50.0 * std::cos(t), 50.0 * std::sin(t)}, 12.0);
+    }
+    EXPECT_DOUBLE_EQ(arc.applied_area(), 2.0 * arc.covered_area());
+}
+
+TEST(coverage_test, only_field_and_not_holes)
+{
+    // Проход насквозь через поле с колком 20x20 посередине
+    const Polygon field({{0, 0}, {100, 0}, {100, 100}, {0, 100}}, {{{40, 40}, {60, 40}, {60, 60}, {40, 60}}});
+    CoverageAccumulator acc(field, 0.1);
+    EXPECT_NEAR(acc.field_area(), 9600.0, 1e-6);
+
+    acc.add({-50.0, 50.0}, 10.0);
+    acc.add({150.0, 50.0}, 10.0);
+    EXPECT_NEAR(acc.covered_area(), 80.0 * 10.0, 1.0);
+}
+
+TEST(coverage_test, width_zero_and_break_leave_gaps)
+{
+    CoverageAccumulator acc(rect(0, 0, 100, 100), 0.1);
+    acc.add({10.0, 10.0}, 4.0);
+    acc.add({10.0, 90.0}, 0.0); // переезд с выключенной штангой
+    EXPECT_EQ(acc.covered_area(), 0.0);
+
+    acc.add({50.0, 90.0}, 4.0);
+    const double one = acc.covered_area();
+    EXPECT_NEAR(one, 40.0 * 4.0, 1.0);
+
+    acc.break_track();
+    acc.add({90.0, 10.0}, 4.0);
+    EXPECT_EQ(acc.covered_area(), one);
+
+    acc.reset();
+    EXPECT_EQ(acc.covered_area(), 0.0);
+    EXPECT_EQ(acc.applied_area(), 0.0);
+    EXPECT_NEAR(acc.field_area(), 10000.0, 1e-6);
+}
+
+TEST(coverage_test, matches_polygon_union_of_swept_strips)
+{
+    // Случайный трек с поворотами: эталон — объединение прямоугольников и вееров, отсечённое полем
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> step(5.0, 25.0);
+    std::uniform_real_distribution<double> turn(-1.2, 1.2);
+    const double width = 8.0;
+    const double r = 0.5 * width;
+
+    std::vector<Point> track{{30.0, 30.0}};
+    double heading = 0.3;
+    for (int i = 0; i < 40; ++i) {
+        heading += turn(rng);
+        const Point& p = track.back();
+        track.push_back({p.x + step(rng) * std::cos(heading), p.y + step(rng) * std::sin(heading)});
+    }
+
+    std::vector<Polygon> swept;
+    for (std::size_t i = 1; i < track.size(); ++i) {
+        const Point& a = track[i - 1];
+        const Point& b = track[i];
+        const double len = dist(a, b);
+        const Point n{-(b.y - a.y) / len * r, (b.x - a.x) / len * r};
+        swept.emplace_back(std::vector<Point>{
+            {a.x - n.x, a.y - n.y}, {b.x - n.x, b.y - n.y}, {b.x + n.x, b.y + n.y}, {a.x + n.x, a.y + n.y}});
+        if (i >= 2) {
+            // Диск на стыке покрывает веер; разница с веером — только внутренняя сторона поворота, закрытая полосами
+            std::vector<Point> fan{a};
+            const Point& z = track[i - 2];
+            const double a0 = std::atan2(a.y - z.y, a.x - z.x);
+            const double a1 = std::atan2(b.y - a.y, b.x - a.x);
+            double t = a1 - a0;
+            while (t > kPI) t -= 2.0 * kPI;
+            while (t < -kPI) t += 2.0 * kPI;
+            const double s = t > 0.0 ? -0.5 * kPI : 0.5 * kPI;
+            for (int k = 0; k <= 64; ++k) {
+                const double ang = a0 + s + t * k / 64.0;
+                fan.push_back({a.x + r * std::cos(ang), a.y + r * std::sin(ang)});
+            }
+            if (std::abs(t) > 1e-9) swept.emplace_back(std::move(fan));
+        }
+    }
+
+    const Polygon field({{0, 0}, {200, 0}, {200, 150}, {120, 180}, {0, 150}});
+    const double expected = total_area(boolean_op(std::vector<Polygon>{field}, swept, BooleanOp::Intersection));
+
+    CoverageAccumulator acc(field, 0.05);
+    acc.add(track, width);
+    // Веер растра — ломаная с шагом 45°, эталон — почти дуга: разница не больше суммы сегментов
+    EXPECT_NEAR(acc.covered_area(), expected, 0.02 * expected);
+}
+
+TEST(coverage_test, boustrophedon_plan_covers_field)
+{
+    const Polygon field({{0, 0}, {300, 0}, {320, 200}, {-20, 220}});
+    const SwathPlan plan = plan_swaths(field, {12.0, 0.0, 0.0});
+
+    CoverageAccumulator acc(field, 0.25);
+    for (const auto& s: plan.swaths) {
+        acc.break_track();
+        acc.add(s.start, 12.0);
+        acc.add(s.end, 12.0);
+    }
+    EXPECT_GT(acc.coverage_ratio(), 0.97);
+    EXPECT_LE(acc.coverage_ratio(), 1.0);
+    EXPECT_LT(acc.applied_area() - acc.covered_area(), 0.01 * acc.covered_area());
+}
+
+TEST(coverage_test, invalid_arguments)
+{
+    EXPECT_THROW(CoverageAccumulator(rect(0, 0, 1, 1), 0.0), std::invalid_argument);
+    EXPECT_THROW(CoverageAccumulator(Polygon(std::vector<Point>{}), 1.0), std::invalid_argument);
+    EXPECT_THROW(CoverageAccumulator(rect(0, 0, 1e6, 1e6), 1e-4), std::invalid_argument);
+
+    CoverageAccumulator acc(rect(0, 0, 10, 10), 0.5);
+    EXPECT_THROW(acc.add({1.0, 1.0}, -1.0), std::invalid_argument);
+    EXPECT_THROW(acc.add({1.0, 1.0}, std::nan("")), std::invalid_argument);
+}
+
+TEST(coverage_test, non_finite_and_far_positions)
+{
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    CoverageAccumulator acc(rect(0, 0, 100, 100), 0.1);
+
+    // Пропуск решения разрывает проход: отрезок через него не закрашивается
+    acc.add({10.0, 10.0}, 4.0);
+    acc.add({nan, 50.0}, 4.0);
+    acc.add({10.0, 90.0}, 4.0);
+    EXPECT_EQ(acc.covered_area(), 0.0);
+    acc.add({50.0, 90.0}, 4.0);
+    const double one = acc.covered_area();
+    EXPECT_NEAR(one, 40.0 * 4.0, 1.0);
+
+    acc.add({inf, 90.0}, 4.0);
+    acc.add({50.0, -inf}, 4.0);
+    EXPECT_EQ(acc.covered_area(), one);
+
+    // Далёкие выбросы: отрезок, уходящий за сетку, закрашивает только её часть; длина сверх double — пропуск
+    acc.break_track();
+    acc.add({50.0, 50.0}, 2.0);
+    acc.add({1e300, 50.0}, 2.0);
+    EXPECT_NEAR(acc.covered_area() - one, 50.0 * 2.0, 1.0);
+    acc.add({-1e308, -1e308}, 2.0);
+    acc.add({1e308, 1e308}, 2.0);
+    EXPECT_LE(acc.covered_area(), acc.field_area());
+    EXPECT_LE(acc.applied_area(), 2.0 * acc.field_area());
+}
@@ -0,0 +1,174 @@
+// tests/geo_reader_test.cpp
+#include <mylib/geo_reader.h>
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace mylib;
+
+TEST(read_csv_test, parses_points_with_optional_altitude)
+{
+    const auto pts = read_csv("lat,lon,alt\n# комментарий\n55.5, 37.25 ,120\r\n\n-10,+20\n1e-3,2.5e1", {true});
+    ASSERT_EQ(pts.size(), 3u);
+    EXPECT_DOUBLE_EQ(pts[0].lat, 55.5);
+    EXPECT_DOUBLE_EQ(pts[0].lon, 37.25);
+    EXPECT_EQ(pts[0].alt, std::optional<double>(120.0));
+    EXPECT_FALSE(pts[1].alt.has_value());
+    EXPECT_DOUBLE_EQ(pts[1].lon, 20.0);
+    EXPECT_DOUBLE_EQ(pts[2].lat, 1e-3);
+    EXPECT_DOUBLE_EQ(pts[2].lon, 25.0);
+}
+
+TEST(read_csv_test, reports_line_of_error)
+{
+    try {
+        (void)read_csv("1,2\n3,4\n5;6\n");
+        FAIL() << "ожидалось исключение";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("строке 3"), std::string::npos);
+    }
+    EXPECT_THROW((void)read_csv("1,2,3,4\n"), std::runtime_error);
+    EXPECT_THROW((void)read_csv("1\n"), std::runtime_error);
+}
+
+TEST(read_csv_test, buffer_source_feeds_pipeline_in_portions)
+{
+    std::string text;
+    for (int i = 0; i < 100; ++i) {
+        text += std::to_string(55.0 + i * 1e-4) + "," + std::to_string(37.0) + "\n";
+    }
+    CsvBufferSource source(text);
+    std::vector<GeoPoint> buf(7);
+    std::size_t total = 0;
+    for (std::size_t n; (n = source.read(buf)) > 0;) {
+        total += n;
+    }
+    EXPECT_EQ(total, 100u);
+
+    CsvBufferSource again(text);
+    const GeoToXYEquirectangular proj;
+    TrackPipeline pipeline(proj, {55.0, 37.0, std::nullopt}, {16, 2});
+    pipeline.run(again);
+    EXPECT_EQ(pipeline.finish().points_in, 100u);
+}
+
+TEST(read_geojson_test, feature_collection_with_mixed_geometries)
+{
+    const std::string text = R"({
+      "type": "FeatureCollection",
+      "features": [
+        {"type": "Feature", "properties": {"name": "поле \"1\"", "coordinates": [1, 2], "area": 1.5e3, "ok": true},
+         "geometry": {"type": "Polygon", "coordinates": [
+            [[37.0, 55.0], [37.1, 55.0], [37.1, 55.1], [37.0, 55.1], [37.0, 55.0]],
+            [[37.02, 55.02], [37.03, 55.02], [37.03, 55.03], [37.02, 55.02]]]}},
+        {"type": "Feature", "properties": null,
+         "geometry": {"coordinates": [[[[38.0, 56.0, 150.5], [38.1, 56.0], [38.0, 56.1], [38.0, 56.0]]],
+                                      [[[39.0, 57.0], [39.1, 57.0], [39.0, 57.1], [39.0, 57.0]]]],
+                      "type": "MultiPolygon"}},
+        {"type": "Feature", "geometry": {"type": "LineString", "coordinates": [[37.5, 55.5], [37.6, 55.6]]}},
+        {"type": "Feature", "geometry": {"type": "Point", "coordinates": [37.5, 55.5]}},
+        {"type": "Feature", "geometry": {"type": "GeometryCollection", "geometries": [
+            {"type": "MultiLineString", "coordinates": [[[1, 2], [3, 4]], [[5, 6], [7, 8], [9, 10]]]}]}}
+      ]
+    })";
+
+    GeoJsonGeometries g;
+    read_geojson(text, g);
+
+    ASSERT_EQ(g.polygon_count(), 3u);
+    EXPECT_EQ(g.ring_count(0), 2u);
+    EXPECT_EQ(g.ring(0, 0).size(), 5u);
+    EXPECT_EQ(g.ring(0, 1).size(), 4u);
+    EXPECT_DOUBLE_EQ(g.ring(0, 0)[1].lon, 37.1);
+    EXPECT_DOUBLE_EQ(g.ring(0, 0)[1].lat, 55.0);
+
+    // "coordinates" раньше "type" и высота в позиции
+    EXPECT_EQ(g.ring_count(1), 1u);
+    EXPECT_EQ(g.ring(1, 0)[0].alt, std::optional<double>(150.5));
+    EXPECT_FALSE(g.ring(1, 0)[1].alt.has_value());
+    EXPECT_DOUBLE_EQ(g.ring(2, 0)[0].lon, 39.0);
+
+    ASSERT_EQ(g.line_count(), 3u);
+    EXPECT_EQ(g.line(0).size(), 2u);
+    EXPECT_EQ(g.line(2).size(), 3u);
+    EXPECT_DOUBLE_EQ(g.line(2)[2].lat, 10.0);
+
+    // Повторное чтение в тот же буфер очищает его
+    read_geojson(R"({"type": "LineString", "coordinates": [[0, 0], [1, 1]]})", g);
+    EXPECT_EQ(g.polygon_count(), 0u);
+    EXPECT_EQ(g.line_count(), 1u);
+}
+
+TEST(read_geojson_test, projected_polygon_matches_area)
+{
+    const std::string text = R"({"type": "Polygon", "coordinates": [
+        [[37.0, 55.0], [37.01, 55.0], [37.01, 55.01], [37.0, 55.01], [37.0, 55.0]]]})";
+    GeoJsonGeometries g;
+    read_geojson(text, g);
+
+    const GeoPoint center{55.0, 37.0, std::nullopt};
+    const Polygon poly = to_polygon(g, 0, GeoToXYEquirectangular{}, center);
+    EXPECT_EQ(poly.vertices().size(), 4u); // замыкающая точка убрана
+    const double side_lat = deg2rad(0.01) * kEarthRadius;
+    const double side_lon = side_lat * std::cos(deg2rad(55.0));
+    EXPECT_NEAR(poly.area(), side_lat * side_lon, 1e-6 * side_lat * side_lon);
+}
+
+TEST(read_geojson_test, batches_split_between_geometries)
+{
+    std::string text = R"({"type": "FeatureCollection", "features": [)";
+    for (int i = 0; i < 50; ++i) {
+        if (i > 0) text += ",";
+        text += R"({"type": "Feature", "geometry": {"type": "Polygon", "coordinates": [[[0,0],[1,0],[1,1],[0,0]]]}})";
+    }
+    text += "]}";
+
+    std::size_t batches = 0;
+    std::size_t polygons = 0;
+    read_geojson(
+        text,
+        [&](const GeoJsonGeometries& g) {
+            ++batches;
+            polygons += g.polygon_count();
+            EXPECT_LE(g.points.size(), 40u);
+        },
+        40);
+    EXPECT_EQ(polygons, 50u);
+    EXPECT_EQ(batches, 5u);
+}
+
+TEST(read_geojson_test, syntax_errors_throw)
+{
+    GeoJsonGeometries g;
+    EXPECT_THROW(read_geojson(R"({"type": "Polygon", "coordinates": [[[0, 0], [1, 0]])", g), std::runtime_error);
+    EXPECT_THROW(read_geojson(R"({"type": "Polygon", "coordinates": [[[0], [1, 0]]]})", g), std::runtime_error);
+    EXPECT_THROW(read_geojson(R"({"type": "Polygon"} x)", g), std::runtime_error);
+    EXPECT_THROW(read_geojson(R"({"a": "\)", g), std::runtime_error);
+    EXPECT_THROW(read_geojson(std::string(1000, '['), g), std::runtime_error);
+
+    // nan и inf — не числа JSON, хотя from_chars их читает
+    EXPECT_THROW(read_geojson(R"({"type":"LineString","coordinates":[[nan,1],[1,2]]})", g), std::runtime_error);
+    EXPECT_THROW(read_geojson(R"({"type":"LineString","coordinates":[[1,inf],[1,2]]})", g), std::runtime_error);
+    EXPECT_THROW(read_geojson(R"({"type":"LineString","coordinates":[[-inf,1],[1,2]]})", g), std::runtime_error);
+    EXPECT_THROW(read_geojson(R"({"type":"Point","coordinates":[1,2],"x":nan})", g), std::runtime_error);
+    EXPECT_THROW(read_geojson(R"({"type":"Point","coordinates":[1,2],"x":-})", g), std::runtime_error);
+    EXPECT_NO_THROW(read_geojson(R"({"type":"Point","coordinates":[-1.5e1,2],"x":-0.5})", g));
+}
+
+TEST(read_geojson_test, reads_mapped_file)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "mylib_reader.geojson").string();
+    {
+        std::ofstream out(path);
+        out << R"({"type": "MultiPolygon", "coordinates": [[[[0,0],[1,0],[1,1],[0,0]]], [[[2,2],[3,2],[3,3],[2,2]]]]})";
+    }
+    std::size_t polygons = 0;
+    read_geojson_file(path, [&](const GeoJsonGeometries& g) { polygons += g.polygon_count(); });
+    std::remove(path.c_str());
+    EXPECT_EQ(polygons, 2u);
+}
@@ -2,7 +2,14 @@
 #include <mylib/geometry.h>
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
 #include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
 #include <vector>
 
 constexpr double kEps = 1e-12;
@@ -184,6 +191,129 @@ TEST(polygon_test, area_colinear_points_zero)
     EXPECT_NEAR(colinear.area(), 0.0, kEps);
 }
 
+TEST(polygon_test, metrics_of_rectangle)
+{
+    // Обход против часовой стрелки — положительная ориентированная площадь
+    const mylib::Polygon rect({{1.0, 2.0}, {5.0, 2.0}, {5.0, 4.0}, {1.0, 4.0}});
+    EXPECT_DOUBLE_EQ(rect.signed_area(), 8.0);
+    EXPECT_DOUBLE_EQ(rect.area(), 8.0);
+    EXPECT_DOUBLE_EQ(rect.perimeter(), 12.0);
+    EXPECT_NEAR(rect.centroid().x, 3.0, kEps);
+    EXPECT_NEAR(rect.centroid().y, 3.0, kEps);
+
+    const BBox box = rect.bbox();
+    EXPECT_DOUBLE_EQ(box.min_x, 1.0);
+    EXPECT_DOUBLE_EQ(box.min_y, 2.0);
+    EXPECT_DOUBLE_EQ(box.max_x, 5.0);
+    EXPECT_DOUBLE_EQ(box.max_y, 4.0);
+
+    const mylib::Polygon cw({{1.0, 4.0}, {5.0, 4.0}, {5.0, 2.0}, {1.0, 2.0}});
+    EXPECT_DOUBLE_EQ(cw.signed_area(), -8.0);
+    EXPECT_DOUBLE_EQ(cw.area(), 8.0);
+    EXPECT_NEAR(cw.centroid().x, 3.0, kEps);
+}
+
+TEST(polygon_test, metrics_of_degenerate_polygons)
+{
+    const mylib::Polygon empty({});
+    EXPECT_TRUE(empty.bbox().empty());
+    EXPECT_EQ(empty.centroid(), Point(0.0, 0.0));
+    EXPECT_DOUBLE_EQ(empty.perimeter(), 0.0);
+
+    // Нулевая площадь: центроид — среднее вершин
+    const mylib::Polygon segment({{0.0, 0.0}, {2.0, 2.0}});
+    EXPECT_DOUBLE_EQ(segment.perimeter(), 2.0 * std::sqrt(8.0));
+    EXPECT_EQ(segment.centroid(), Point(1.0, 1.0));
+}
+
+TEST(polygon_test, mutation_invalidates_cached_metrics)
+{
+    mylib::Polygon poly({{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}});
+    ASSERT_DOUBLE_EQ(poly.area(), 4.0);
+
+    poly.set_vertex(2, {4.0, 2.0});
+    EXPECT_DOUBLE_EQ(poly.area(), 6.0);
+    EXPECT_DOUBLE_EQ(poly.bbox().max_x, 4.0);
+
+    poly.erase_vertex(3);
+    EXPECT_DOUBLE_EQ(poly.area(), 2.0);
+
+    poly.insert_vertex(3, {0.0, 2.0});
+    EXPECT_DOUBLE_EQ(poly.area(), 6.0);
+
+    poly.set_vertices({{0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}, {0.0, 0.0}});
+    EXPECT_EQ(poly.vertices().size(), 3u);
+    EXPECT_DOUBLE_EQ(poly.area(), 0.5);
+
+    EXPECT_THROW(poly.set_vertex(3, {}), std::out_of_range);
+    EXPECT_THROW(poly.insert_vertex(4, {}), std::out_of_range);
+    EXPECT_THROW(poly.erase_vertex(3), std::out_of_range);
+}
+
+TEST(polygon_test, copies_keep_metrics_independent)
+{
+    mylib::Polygon a({{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}});
+    ASSERT_DOUBLE_EQ(a.area(), 4.0); // кэш заполнен до копирования
+
+    mylib::Polygon b = a;
+    b.set_vertex(2, {4.0, 2.0});
+    EXPECT_DOUBLE_EQ(a.area(), 4.0);
+    EXPECT_DOUBLE_EQ(b.area(), 6.0);
+
+    a = b;
+    EXPECT_DOUBLE_EQ(a.area(), 6.0);
+    const mylib::Polygon c = std::move(a);
+    EXPECT_DOUBLE_EQ(c.area(), 6.0);
+}
+
+TEST(polygon_test, holes_are_subtracted)
+{
+    // Квадрат 10x10 с дырой 2x2 (ориентация дыры не важна)
+    mylib::Polygon poly({{0.0, 0.0}, {10.0, 0.0}, {10.0, 10.0}, {0.0, 10.0}},
+                        {{{6.0, 6.0}, {6.0, 8.0}, {8.0, 8.0}, {8.0, 6.0}, {6.0, 6.0}}});
+    ASSERT_EQ(poly.holes().size(), 1u);
+    EXPECT_EQ(poly.holes()[0].size(), 4u);
+
+    EXPECT_DOUBLE_EQ(poly.area(), 96.0);
+    EXPECT_DOUBLE_EQ(poly.perimeter(), 48.0);
+    // Центроид смещается от дыры: (100 * 5 - 4 * 7) / 96
+    EXPECT_NEAR(poly.centroid().x, 472.0 / 96.0, kEps);
+    EXPECT_NEAR(poly.centroid().y, 472.0 / 96.0, kEps);
+
+    EXPECT_TRUE(poly.contains({2.0, 2.0}));
+    EXPECT_FALSE(poly.contains({7.0, 7.0}));
+
+    poly.add_hole({{1.0, 1.0}, {3.0, 1.0}, {3.0, 3.0}, {1.0, 3.0}});
+    EXPECT_DOUBLE_EQ(poly.area(), 92.0);
+    EXPECT_FALSE(poly.contains({2.0, 2.0}));
+
+    poly.set_holes({});
+    EXPECT_DOUBLE_EQ(poly.area(), 100.0);
+    EXPECT_TRUE(poly.contains({7.0, 7.0}));
+}
+
+TEST(ring_signed_area_test, compensated_matches_long_double_far_from_origin)
+{
+    // Многоугольник на 10 000 вершин с координатами-двоичными дробями: сдвиг на 2^22 точен,
+    // поэтому эталон — площадь того же кольца у начала координат
+    constexpr std::size_t n = 10000;
+    constexpr double offset = 4194304.0;
+    std::vector<Point> local(n);
+    std::vector<Point> far(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double a = 2.0 * kPI * static_cast<double>(i) / static_cast<double>(n);
+        const double r = 500.0 + 37.0 * std::sin(7.0 * a);
+        local[i] = {std::round(r * std::cos(a) * 1024.0) / 1024.0, std::round(r * std::sin(a) * 1024.0) / 1024.0};
+        far[i] = {local[i].x + offset, local[i].y + offset};
+    }
+
+    const double expected = ring_signed_area(local, AreaSummation::LongDouble);
+    EXPECT_GT(expected, 0.0);
+    EXPECT_NEAR(ring_signed_area(far, AreaSummation::Compensated), expected, expected * 1e-14);
+    EXPECT_NEAR(ring_signed_area(far, AreaSummation::LongDouble), expected, expected * 1e-14);
+    EXPECT_DOUBLE_EQ(mylib::Polygon(far).area(), ring_signed_area(far));
+}
+
 
 static inline void expect_near_point(const Point& p, const Point& q, double eps)
 {
@@ -214,30 +344,128 @@ TEST(geo_to_xy_equirectangular, small_shift_matches_formula)
     expect_near_point(xy, expected, 1e-6);
 }
 
+TEST(geo_to_xy_equirectangular, batch_matches_per_point_exactly)
+{
+    mylib::GeoToXYEquirectangular prj;
+    const GeoPoint c{55.751244, 37.618423};
+    std::vector<GeoPoint> in;
+    for (int i = 0; i < 100; ++i) {
+        in.push_back({c.lat + 1e-4 * i, c.lon - 2e-4 * i, std::nullopt});
+    }
+    std::vector<Point> out(in.size());
+    prj.geo_to_xy_batch(c, in, out);
+
+    // Через интерфейс — тот же результат
+    const mylib::IGeoPointToXY& base = prj;
+    std::vector<Point> out_base(in.size());
+    base.geo_to_xy_batch(c, in, out_base);
+
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        EXPECT_EQ(out[i], prj.geo_to_xy(c, in[i]));
+        EXPECT_EQ(out_base[i], out[i]);
+    }
+}
+
+TEST(geo_to_xy_equirectangular, batch_size_mismatch_throws)
+{
+    mylib::GeoToXYEquirectangular prj;
+    std::vector<GeoPoint> in(3);
+    std::vector<Point> out(2);
+    EXPECT_THROW(prj.geo_to_xy_batch({0, 0}, in, out), std::invalid_argument);
+}
+
+TEST(xy_to_geo_equirectangular, round_trip_is_accurate)
+{
+    mylib::GeoToXYEquirectangular prj;
+    const GeoPoint c{55.751244, 37.618423};
+    for (int i = -50; i <= 50; ++i) {
+        const GeoPoint g{c.lat + 1e-3 * i, c.lon - 2e-3 * i, std::nullopt};
+        const GeoPoint back = prj.xy_to_geo(c, prj.geo_to_xy(c, g));
+        EXPECT_NEAR(back.lat, g.lat, 1e-12);
+        EXPECT_NEAR(back.lon, g.lon, 1e-12);
+        EXPECT_FALSE(back.alt.has_value());
+    }
+}
+
+TEST(xy_to_geo_equirectangular, batch_round_trip)
+{
+    mylib::GeoToXYEquirectangular prj;
+    const GeoPoint c{-33.9, 18.4};
+    std::vector<GeoPoint> in;
+    for (int i = 0; i < 100; ++i) {
+        in.push_back({c.lat + 1e-4 * i, c.lon + 3e-4 * i, 10.0});
+    }
+    std::vector<Point> xy(in.size());
+    std::vector<GeoPoint> back(in.size());
+    prj.geo_to_xy_batch(c, in, xy);
+    prj.xy_to_geo_batch(c, xy, back);
+
+    const mylib::IGeoPointToXY& base = prj;
+    std::vector<GeoPoint> back_base(in.size());
+    base.xy_to_geo_batch(c, xy, back_base);
+
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        EXPECT_NEAR(back[i].lat, in[i].lat, 1e-12);
+        EXPECT_NEAR(back[i].lon, in[i].lon, 1e-12);
+        EXPECT_FALSE(back[i].alt.has_value());
+        EXPECT_NEAR(back_base[i].lat, back[i].lat, 1e-12);
+        EXPECT_NEAR(back_base[i].lon, back[i].lon, 1e-12);
+    }
+}
+
+TEST(xy_to_geo_interface, forward_only_implementation_still_compiles)
+{
+    // Реализация, написанная до появления обратного преобразования: переопределяет только geo_to_xy
+    class ForwardOnly final: public mylib::IGeoPointToXY {
+    public:
+        Point geo_to_xy(const GeoPoint&, const GeoPoint& g) const override { return {g.lon, g.lat}; }
+    };
+    const ForwardOnly prj;
+    EXPECT_EQ(prj.geo_to_xy({0, 0}, {1.0, 2.0}), Point(2.0, 1.0));
+    EXPECT_THROW((void)prj.xy_to_geo({0, 0}, {2.0, 1.0}), std::logic_error);
+    std::vector<Point> in(2);
+    std::vector<GeoPoint> out(2);
+    EXPECT_THROW(prj.xy_to_geo_batch({0, 0}, in, out), std::logic_error);
+}
+
+TEST(xy_to_geo_equirectangular, batch_size_mismatch_throws)
+{
+    mylib::GeoToXYEquirectangular prj;
+    std::vector<Point> in(3);
+    std::vector<GeoPoint> out(4);
+    EXPECT_THROW(prj.xy_to_geo_batch({0, 0}, in, out), std::invalid_argument);
+}
+
 TEST(geo_to_xy_common, utm_zone_from_lon_bounds)
 {
     EXPECT_EQ(mylib::GeoToXYUtm::utm_zone_from_lon(-180.0), 1);
     EXPECT_EQ(mylib::GeoToXYUtm::utm_zone_from_lon(179.999), 60);
 }
 
-#if !defined(MYLIB_WITH_PROJ)
-TEST(geo_to_xy_proj_required, aeqd_throws_without_proj)
+TEST(projector_key_test, aeqd_key_is_bound_to_center)
 {
-    mylib::GeoToXYAeqd prj;
-    EXPECT_THROW(([&]{
-        [[maybe_unused]] auto _ = prj.geo_to_xy({0,0}, {1,1});
-    }()), std::runtime_error);
+    const auto k1 = mylib::ProjectorKey::aeqd({55.75, 37.61});
+    const auto k2 = mylib::ProjectorKey::aeqd({55.75, 37.61});
+    const auto k3 = mylib::ProjectorKey::aeqd({55.75, 37.62});
+    EXPECT_EQ(k1.kind, mylib::ProjectionKind::Aeqd);
+    EXPECT_TRUE(k1 == k2);
+    EXPECT_FALSE(k1 == k3);
 }
 
-TEST(geo_to_xy_proj_required, utm_throws_without_proj)
+TEST(projector_key_test, utm_key_is_bound_to_zone_and_hemisphere)
 {
-    mylib::GeoToXYUtm prj;
-    EXPECT_THROW(([&]{
-        [[maybe_unused]] auto _ = prj.geo_to_xy({0,0}, {1,1});
-    }()), std::runtime_error);
+    const auto n37 = mylib::ProjectorKey::utm(37, true);
+    const auto s37 = mylib::ProjectorKey::utm(37, false);
+    EXPECT_EQ(n37.kind, mylib::ProjectionKind::Utm);
+    EXPECT_EQ(n37.zone, 37);
+    EXPECT_TRUE(n37 == mylib::ProjectorKey::utm(37, true));
+    EXPECT_FALSE(n37 == s37);
+    EXPECT_FALSE(n37 == mylib::ProjectorKey::utm(38, true));
+    EXPECT_EQ(n37.backend, mylib::ProjectorBackend::Native);
+    EXPECT_FALSE(n37 == mylib::ProjectorKey::utm(37, true, mylib::ProjectorBackend::Proj));
 }
-#else
-TEST(geo_to_xy_proj_available, aeqd_and_eq_coincide_at_center)
+
+TEST(geo_to_xy_projected, aeqd_and_eq_coincide_at_center)
 {
     mylib::GeoToXYAeqd aeqd;
     mylib::GeoToXYEquirectangular eq;
@@ -247,4 +475,266 @@ TEST(geo_to_xy_proj_available, aeqd_and_eq_coincide_at_center)
     expect_near_point(p1, mylib::Point{0.0, 0.0}, 1e-9);
     expect_near_point(p2, mylib::Point{0.0, 0.0}, 1e-9);
 }
+
+TEST(geo_to_xy_projected, aeqd_pipeline_is_cached_by_center)
+{
+    mylib::GeoToXYAeqd aeqd;
+    const mylib::GeoPoint c1{55.75, 37.61};
+    const mylib::GeoPoint c2{55.76, 37.61};
+    const mylib::GeoPoint g{55.751, 37.612};
+
+    // Преобразование точек строит проекцию на месте и в кэш не ходит
+    const auto p1 = aeqd.geo_to_xy(c1, g);
+    EXPECT_EQ(aeqd.cache_stats().misses, 0u);
+    EXPECT_EQ(aeqd.cache_stats().size, 0u);
+
+    const auto prj = aeqd.projector(c1);
+    EXPECT_EQ(aeqd.projector(c1), prj);
+    EXPECT_EQ(aeqd.cache_stats().misses, 1u);
+    EXPECT_EQ(aeqd.cache_stats().hits, 1u);
+
+    [[maybe_unused]] auto p3 = aeqd.projector(c2);
+    EXPECT_EQ(aeqd.cache_stats().misses, 2u);
+    EXPECT_EQ(aeqd.cache_stats().size, 2u);
+
+    // Привязанная к центру проекция даёт тот же результат
+    expect_near_point(prj->forward(g), p1, 0.0);
+}
+
+TEST(geo_to_xy_projected, utm_pipeline_is_cached_by_zone)
+{
+    mylib::GeoToXYUtm utm;
+    // Оба центра попадают в зону 37N
+    const auto p1 = utm.geo_to_xy({55.75, 37.61}, {55.751, 37.612});
+    const auto p2 = utm.geo_to_xy({50.0, 38.5}, {55.751, 37.612});
+    expect_near_point(p1, p2, 0.0);
+    EXPECT_EQ(utm.cache_stats().misses, 0u);
+
+    const auto prj = utm.projector({55.75, 37.61});
+    EXPECT_EQ(utm.projector({50.0, 38.5}), prj);
+    EXPECT_EQ(utm.cache_stats().misses, 1u);
+    EXPECT_EQ(utm.cache_stats().hits, 1u);
+    EXPECT_EQ(prj->key().zone, 37);
+    expect_near_point(prj->forward({55.751, 37.612}), p1, 0.0);
+}
+
+TEST(geo_to_xy_projected, batch_matches_per_point)
+{
+    const mylib::GeoPoint c{55.75, 37.61};
+    std::vector<mylib::GeoPoint> in;
+    for (int i = 0; i < 50; ++i) {
+        in.push_back({c.lat + 1e-3 * i, c.lon + 1e-3 * i, std::nullopt});
+    }
+    std::vector<mylib::Point> out(in.size());
+
+    mylib::GeoToXYAeqd aeqd;
+    aeqd.geo_to_xy_batch(c, in, out);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        expect_near_point(out[i], aeqd.geo_to_xy(c, in[i]), 1e-9);
+    }
+
+    mylib::GeoToXYUtm utm;
+    utm.geo_to_xy_batch(c, in, out);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        expect_near_point(out[i], utm.geo_to_xy(c, in[i]), 1e-9);
+    }
+}
+
+TEST(geo_to_xy_projected, round_trip_is_accurate)
+{
+    const mylib::GeoPoint c{55.75, 37.61};
+    std::vector<mylib::GeoPoint> in;
+    for (int i = -20; i <= 20; ++i) {
+        in.push_back({c.lat + 2e-3 * i, c.lon - 3e-3 * i, std::nullopt});
+    }
+    std::vector<mylib::Point> xy(in.size());
+    std::vector<mylib::GeoPoint> back(in.size());
+
+    mylib::GeoToXYAeqd aeqd;
+    mylib::GeoToXYUtm utm;
+    for (const mylib::IGeoPointToXY* prj: {static_cast<const mylib::IGeoPointToXY*>(&aeqd),
+                                           static_cast<const mylib::IGeoPointToXY*>(&utm)}) {
+        prj->geo_to_xy_batch(c, in, xy);
+        prj->xy_to_geo_batch(c, xy, back);
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            EXPECT_NEAR(back[i].lat, in[i].lat, 1e-9);
+            EXPECT_NEAR(back[i].lon, in[i].lon, 1e-9);
+
+            const mylib::GeoPoint single = prj->xy_to_geo(c, xy[i]);
+            EXPECT_NEAR(single.lat, back[i].lat, 1e-12);
+            EXPECT_NEAR(single.lon, back[i].lon, 1e-12);
+        }
+    }
+    // Прямое и обратное преобразование обходятся без кэша проекций
+    EXPECT_EQ(aeqd.cache_stats().misses, 0u);
+    EXPECT_EQ(utm.cache_stats().misses, 0u);
+}
+
+TEST(geo_to_xy_projected, registry_shares_projector_across_threads)
+{
+    mylib::ProjectorRegistry registry;
+    const auto key = mylib::ProjectorKey::aeqd({55.75, 37.61});
+    const auto first = registry.get(key);
+    EXPECT_EQ(registry.get(key), first); // повтор находится без блокировки
+    EXPECT_EQ(registry.stats().misses, 1u);
+    EXPECT_EQ(registry.stats().hits, 1u);
+
+    const mylib::GeoPoint g{55.751, 37.612};
+    const mylib::Point expected = first->forward(g);
+
+    // Потоки получают один и тот же экземпляр проекции
+    std::vector<std::shared_ptr<const mylib::GeoProjector>> seen(8);
+    std::vector<mylib::Point> results(seen.size());
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < seen.size(); ++t) {
+        threads.emplace_back([&, t] {
+            seen[t] = registry.get(key);
+            for (int i = 0; i < 1000; ++i) {
+                results[t] = seen[t]->forward(g);
+            }
+        });
+    }
+    for (auto& th: threads) {
+        th.join();
+    }
+    for (std::size_t t = 0; t < seen.size(); ++t) {
+        EXPECT_EQ(seen[t], first);
+        expect_near_point(results[t], expected, 0.0);
+    }
+    EXPECT_EQ(registry.stats().size, 1u);
+    EXPECT_EQ(registry.stats().hits, 1u + seen.size());
+
+    // После сброса строится новый экземпляр, выданный ранее остаётся рабочим
+    registry.clear();
+    registry.clear();
+    const auto rebuilt = registry.get(key);
+    EXPECT_NE(rebuilt, first);
+    expect_near_point(first->forward(g), rebuilt->forward(g), 0.0);
+}
+
+TEST(geo_to_xy_projected, registry_fills_while_threads_read)
+{
+    // Ключи добавляются, пока другие потоки ищут уже добавленные
+    mylib::ProjectorRegistry registry(256);
+    std::vector<mylib::ProjectorKey> keys;
+    for (int i = 0; i < 200; ++i) {
+        keys.push_back(mylib::ProjectorKey::aeqd({50.0 + 0.01 * i, 30.0 + 0.02 * i}));
+    }
+
+    std::vector<std::vector<const mylib::GeoProjector*>> seen(8, std::vector<const mylib::GeoProjector*>(keys.size()));
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < seen.size(); ++t) {
+        threads.emplace_back([&, t] {
+            for (int round = 0; round < 3; ++round) {
+                for (std::size_t k = 0; k < keys.size(); ++k) {
+                    const std::size_t i = (k + 25 * t) % keys.size();
+                    const mylib::GeoProjector* p = registry.get(keys[i]).get();
+                    if (round > 0) {
+                        EXPECT_EQ(p, seen[t][i]);
+                    }
+                    seen[t][i] = p;
+                }
+            }
+        });
+    }
+    for (auto& th: threads) {
+        th.join();
+    }
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_TRUE(seen[0][i]->key() == keys[i]);
+        for (std::size_t t = 1; t < seen.size(); ++t) {
+            EXPECT_EQ(seen[t][i], seen[0][i]);
+        }
+    }
+    EXPECT_EQ(registry.stats().size, keys.size());
+}
+
+TEST(geo_to_xy_projected, registry_generations_bound_memory)
+{
+    mylib::ProjectorRegistry registry(4);
+    std::vector<mylib::ProjectorKey> keys;
+    for (int i = 0; i < 6; ++i) {
+        keys.push_back(mylib::ProjectorKey::aeqd({50.0 + 0.01 * i, 30.0}));
+    }
+    const auto first = registry.get(keys[0]);
+    for (std::size_t i = 1; i < 4; ++i) {
+        (void)registry.get(keys[i]);
+    }
+    EXPECT_EQ(registry.stats().size, 4u);
+
+    // Пятый ключ начинает новую таблицу; выданные проекции остаются рабочими
+    (void)registry.get(keys[4]);
+    EXPECT_EQ(registry.stats().size, 1u);
+    const mylib::GeoPoint g{50.001, 30.002};
+    EXPECT_EQ(first->key(), keys[0]);
+    const mylib::Point before = first->forward(g);
+    const auto again = registry.get(keys[0]);
+    EXPECT_NE(again, first);
+    expect_near_point(again->forward(g), before, 0.0);
+    EXPECT_EQ(registry.stats().size, 2u);
+    EXPECT_EQ(registry.stats().misses, 6u);
+
+    // Ключ с NaN не равен сам себе и в реестр не попадает
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_THROW((void)mylib::ProjectorKey::aeqd({nan, 30.0}), std::invalid_argument);
+    mylib::ProjectorKey bad = keys[5];
+    bad.lon0 = nan;
+    EXPECT_THROW((void)registry.get(bad), std::invalid_argument);
+    EXPECT_EQ(registry.stats().size, 2u);
+}
+
+TEST(geo_to_xy_projected, registry_rotates_while_threads_read)
+{
+    // Таблица на один ключ: почти каждый промах снимает её, пока другие потоки ищут в ней
+    mylib::ProjectorRegistry registry(1);
+    const mylib::GeoPoint g{50.001, 30.002};
+    std::vector<std::thread> threads;
+    std::atomic<int> mismatches{0};
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 2000; ++i) {
+                const auto key = mylib::ProjectorKey::aeqd({50.0 + 0.001 * ((i + t) % 7), 30.0});
+                const auto p = registry.get(key);
+                if (!(p->key() == key) || !std::isfinite(p->forward(g).x)) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& th: threads) {
+        th.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(registry.stats().size, 1u);
+}
+#if !defined(MYLIB_WITH_PROJ)
+TEST(geo_to_xy_proj_required, proj_backend_throws_without_proj)
+{
+    mylib::ProjectorCache cache;
+    const auto key = mylib::ProjectorKey::utm(37, true, mylib::ProjectorBackend::Proj);
+    EXPECT_THROW(([&]{
+        [[maybe_unused]] auto _ = cache.get(key);
+    }()), std::runtime_error);
+    EXPECT_EQ(cache.stats().hits, 0u);
+    EXPECT_EQ(cache.stats().size, 0u);
+
+    // Встроенная реализация того же ключа доступна всегда
+    EXPECT_NE(cache.get(mylib::ProjectorKey::utm(37, true)), nullptr);
+    EXPECT_EQ(cache.stats().size, 1u);
+}
+
+TEST(geo_to_xy_proj_required, registry_throws_without_proj_and_caches_nothing)
+{
+    EXPECT_EQ(&mylib::ProjectorRegistry::global(), &mylib::ProjectorRegistry::global());
+
+    mylib::ProjectorRegistry registry;
+    const auto key = mylib::ProjectorKey::aeqd({55.75, 37.61}, mylib::ProjectorBackend::Proj);
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_THROW(([&]{
+            [[maybe_unused]] auto _ = registry.get(key);
+        }()), std::runtime_error);
+    }
+    EXPECT_EQ(registry.stats().misses, 2u);
+    EXPECT_EQ(registry.stats().size, 0u);
+}
 #endif
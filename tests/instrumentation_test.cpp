@@ -0,0 +1,102 @@
+// tests/instrumentation_test.cpp
+#include <mylib/geometry.h>
+#include <mylib/instrumentation.h>
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+std::vector<Point> zigzag(std::size_t n)
+{
+    std::vector<Point> pts(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        pts[i] = {static_cast<double>(i), i % 2 == 0 ? 0.0 : 1.0};
+    }
+    return pts;
+}
+
+} // namespace
+
+TEST(instrumentation_test, probe_names_are_distinct)
+{
+    for (std::size_t i = 0; i < kProbeCount; ++i) {
+        const char* a = probe_name(static_cast<Probe>(i));
+        ASSERT_NE(a, nullptr);
+        for (std::size_t j = 0; j < i; ++j) {
+            EXPECT_STRNE(a, probe_name(static_cast<Probe>(j)));
+        }
+    }
+    EXPECT_STREQ(probe_name(Probe::PolylineLengths), "polyline_lengths");
+}
+
+TEST(instrumentation_test, disabled_build_reports_zeros)
+{
+    if (instrumentation_enabled()) GTEST_SKIP() << "собрано с MYLIB_INSTRUMENTATION";
+
+    [[maybe_unused]] const auto s = polyline_lengths(zigzag(100));
+    const InstrumentationSnapshot snap = instrumentation_snapshot();
+    for (const ProbeStats& p: snap.probes) {
+        EXPECT_EQ(p.calls, 0u);
+        EXPECT_EQ(p.points, 0u);
+        EXPECT_EQ(p.nanoseconds, 0u);
+    }
+}
+
+TEST(instrumentation_test, counts_calls_points_and_time)
+{
+    if (!instrumentation_enabled()) GTEST_SKIP() << "собрано без MYLIB_INSTRUMENTATION";
+
+    const auto pts = zigzag(1000);
+    instrumentation_reset();
+    [[maybe_unused]] const auto s = polyline_lengths(pts);
+    [[maybe_unused]] const Point p = point_on_path(pts, 10.0);
+    [[maybe_unused]] const double d = dist(pts[0], pts[1]);
+
+    const Polygon poly(pts);
+    [[maybe_unused]] const double a1 = poly.area();
+    [[maybe_unused]] const double a2 = poly.area(); // из кэша: не пересчитывается
+
+    const InstrumentationSnapshot snap = instrumentation_snapshot();
+    // point_on_path внутри считает длины ещё раз
+    EXPECT_EQ(snap[Probe::PolylineLengths].calls, 2u);
+    EXPECT_EQ(snap[Probe::PolylineLengths].points, 2000u);
+    EXPECT_GT(snap[Probe::PolylineLengths].nanoseconds, 0u);
+    EXPECT_EQ(snap[Probe::PointOnPath].calls, 1u);
+    EXPECT_GE(snap[Probe::PointOnPath].nanoseconds, snap[Probe::PolylineLengths].nanoseconds / 2);
+    EXPECT_GT(snap[Probe::PointOnPath].nanoseconds, 0u);
+    EXPECT_EQ(snap[Probe::PolygonMetrics].calls, 1u);
+    EXPECT_EQ(snap[Probe::PolygonMetrics].points, 1000u);
+
+    instrumentation_reset();
+    EXPECT_EQ(instrumentation_snapshot()[Probe::PolylineLengths].calls, 0u);
+}
+
+TEST(instrumentation_test, sums_threads_including_finished_ones)
+{
+    if (!instrumentation_enabled()) GTEST_SKIP() << "собрано без MYLIB_INSTRUMENTATION";
+
+    instrumentation_reset();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            const GeoToXYEquirectangular eq;
+            const GeoPoint center{55.0, 37.0, std::nullopt};
+            const GeoPoint g{55.001, 37.001, std::nullopt};
+            for (int i = 0; i < 1000; ++i) {
+                [[maybe_unused]] const Point p = eq.geo_to_xy(center, g);
+            }
+        });
+    }
+    for (auto& th: threads) {
+        th.join();
+    }
+    // Потоки завершились: их счётчики перенесены в общие итоги
+    const ProbeStats fwd = instrumentation_snapshot()[Probe::EquirectForward];
+    EXPECT_EQ(fwd.calls, 4000u);
+    EXPECT_EQ(fwd.points, 4000u);
+    EXPECT_EQ(fwd.nanoseconds, 0u); // поточечные вызовы не замеряются по времени
+}
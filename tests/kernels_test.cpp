@@ -0,0 +1,74 @@
+// tests/kernels_test.cpp
+#include <mylib/kernels.h>
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+struct SoaTrack {
+    std::vector<double> lat;
+    std::vector<double> lon;
+};
+
+SoaTrack make_track(std::size_t n)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> dlat(-80.0, 80.0);
+    std::uniform_real_distribution<double> dlon(-180.0, 180.0);
+    SoaTrack t;
+    for (std::size_t i = 0; i < n; ++i) {
+        t.lat.push_back(dlat(rng));
+        t.lon.push_back(dlon(rng));
+    }
+    return t;
+}
+
+} // namespace
+
+TEST(simd_level_test, scalar_is_always_supported)
+{
+    EXPECT_TRUE(simd_level_supported(SimdLevel::Scalar));
+    EXPECT_TRUE(simd_level_supported(simd_level()));
+    EXPECT_STREQ(simd_level_name(SimdLevel::Avx2), "avx2");
+}
+
+TEST(equirect_soa_test, every_level_is_bit_identical_to_scalar_geo_to_xy)
+{
+    // 1037 — не кратно ширине векторов, проверяется и хвост
+    const SoaTrack t = make_track(1037);
+    const GeoPoint center{55.751244, 37.618423};
+    const GeoToXYEquirectangular prj;
+
+    for (SimdLevel level: {SimdLevel::Scalar, SimdLevel::Avx2, SimdLevel::Avx512}) {
+        if (!simd_level_supported(level)) continue;
+        SCOPED_TRACE(simd_level_name(level));
+
+        std::vector<double> x(t.lat.size()), y(t.lat.size());
+        equirect_forward_soa(center, t.lat, t.lon, x, y, level);
+        for (std::size_t i = 0; i < t.lat.size(); ++i) {
+            const Point expected = prj.geo_to_xy(center, {t.lat[i], t.lon[i], std::nullopt});
+            ASSERT_EQ(x[i], expected.x) << i;
+            ASSERT_EQ(y[i], expected.y) << i;
+        }
+    }
+}
+
+TEST(equirect_soa_test, size_mismatch_throws)
+{
+    std::vector<double> lat(4), lon(4), x(4), y(3);
+    EXPECT_THROW(equirect_forward_soa({0.0, 0.0, std::nullopt}, lat, lon, x, y), std::invalid_argument);
+}
+
+TEST(equirect_soa_test, unsupported_level_throws)
+{
+    if (simd_level_supported(SimdLevel::Avx512)) {
+        GTEST_SKIP() << "все уровни поддерживаются";
+    }
+    std::vector<double> v(8);
+    EXPECT_THROW(equirect_forward_soa({0.0, 0.0, std::nullopt}, v, v, v, v, SimdLevel::Avx512),
+                 std::invalid_argument);
+}
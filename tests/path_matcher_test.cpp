@@ -0,0 +1,225 @@
+// tests/path_matcher_test.cpp
+#include <mylib/path_matcher.h>
+#include <mylib/swath.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Челнок: проходы по 200 м через 12 м с разворотами, шаг 2 м
+std::vector<Point> shuttle(int passes)
+{
+    std::vector<Point> pts;
+    for (int k = 0; k < passes; ++k) {
+        for (int i = 0; i <= 100; ++i) {
+            const double x = 2.0 * (k % 2 == 0 ? i : 100 - i);
+            pts.push_back({x, 12.0 * k});
+        }
+    }
+    return pts;
+}
+
+// Перебор всех сегментов: минимальный квадрат расстояния
+double brute_force_d2(const std::vector<Point>& v, const Point& p)
+{
+    double best = std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i + 1 < v.size(); ++i) {
+        const double dx = v[i + 1].x - v[i].x, dy = v[i + 1].y - v[i].y;
+        const double len2 = dx * dx + dy * dy;
+        const double t = len2 > 0.0 ? std::clamp(((p.x - v[i].x) * dx + (p.y - v[i].y) * dy) / len2, 0.0, 1.0) : 0.0;
+        const double qx = v[i].x + t * dx - p.x, qy = v[i].y + t * dy - p.y;
+        best = std::min(best, qx * qx + qy * qy);
+    }
+    return best;
+}
+
+} // namespace
+
+TEST(path_matcher_test, straight_path_distance_and_signed_offset)
+{
+    const PathMatcher m({{0, 0}, {10, 0}, {10, 10}});
+
+    const PathProjection left = m.project({4, 1.5});
+    EXPECT_DOUBLE_EQ(left.distance, 4.0);
+    EXPECT_DOUBLE_EQ(left.offset, 1.5); // слева по ходу (+y при движении на восток)
+    EXPECT_EQ(left.segment, 0u);
+    EXPECT_EQ(left.point, Point(4, 0));
+
+    const PathProjection right = m.project({11, 3});
+    EXPECT_DOUBLE_EQ(right.distance, 13.0);
+    EXPECT_DOUBLE_EQ(right.offset, -1.0); // справа при движении на север
+    EXPECT_EQ(right.segment, 1u);
+
+    // За концами — ближайший конец пути
+    const PathProjection before = m.project({-3, -4});
+    EXPECT_EQ(before.distance, 0.0);
+    EXPECT_DOUBLE_EQ(std::abs(before.offset), 5.0);
+    const PathProjection after = m.project({10, 14});
+    EXPECT_EQ(after.distance, 20.0);
+    EXPECT_EQ(after.point, Point(10, 10));
+}
+
+TEST(path_matcher_test, matches_brute_force)
+{
+    const auto path = shuttle(9);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> ux(-30.0, 230.0), uy(-30.0, 130.0);
+
+    for (const double cell: {0.0, 0.5, 7.0, 500.0}) {
+        const PathMatcher m(path, cell);
+        PathMatcher::Hint hint;
+        for (int i = 0; i < 2000; ++i) {
+            const Point p{ux(rng), uy(rng)};
+            const double expected = brute_force_d2(path, p);
+            const PathProjection cold = m.project(p);
+            ASSERT_NEAR(cold.offset * cold.offset, expected, 1e-9 * (1.0 + expected)) << cell << " " << i;
+            ASSERT_NEAR(dist(cold.point, p), std::abs(cold.offset), 1e-9);
+            // Случайная (бесполезная) подсказка не меняет ответ
+            const PathProjection warm = m.project(p, hint);
+            ASSERT_NEAR(warm.offset * warm.offset, expected, 1e-9 * (1.0 + expected));
+            const Point on_path = m.path().point_at(warm.distance);
+            ASSERT_NEAR(on_path.x, warm.point.x, 1e-9);
+            ASSERT_NEAR(on_path.y, warm.point.y, 1e-9);
+        }
+    }
+}
+
+TEST(path_matcher_test, sequential_fixes_follow_path)
+{
+    const PathMatcher m(shuttle(5));
+    std::mt19937 rng(11);
+    std::normal_distribution<double> noise(0.0, 0.3);
+
+    // Фиксы с шумом вдоль всего пути, шаг 0,7 м
+    std::vector<Point> fixes;
+    std::vector<double> truth;
+    for (double d = 0.0; d <= m.path().length(); d += 0.7) {
+        const Point p = m.path().point_at(d);
+        fixes.push_back({p.x + noise(rng), p.y + noise(rng)});
+        truth.push_back(d);
+    }
+    std::vector<PathProjection> out(fixes.size());
+    m.project(fixes, out);
+
+    for (std::size_t i = 0; i < fixes.size(); ++i) {
+        // Проходы в 12 м друг от друга: шум 0,3 м не уводит на соседний проход
+        EXPECT_NEAR(out[i].distance, truth[i], 3.0) << i;
+        EXPECT_LT(std::abs(out[i].offset), 2.0);
+        const PathProjection single = m.project(fixes[i]);
+        EXPECT_EQ(single.offset * single.offset, out[i].offset * out[i].offset);
+    }
+
+    std::vector<PathProjection> short_out(2);
+    EXPECT_THROW(m.project(fixes, short_out), std::invalid_argument);
+}
+
+TEST(path_matcher_test, hint_resolves_retraced_path)
+{
+    // Путь туда и обратно по одной линии: обе ветви на одном расстоянии от фикса
+    const PathMatcher m({{0, 0}, {50, 0}, {100, 0}, {50, 0}, {0, 0}});
+    const Point fix{30, 0.5};
+
+    EXPECT_DOUBLE_EQ(m.project(fix).distance, 30.0); // без подсказки — первая ветвь
+
+    PathMatcher::Hint back;
+    back.segment = 3; // движемся по обратной ветви
+    const PathProjection r = m.project(fix, back);
+    EXPECT_DOUBLE_EQ(r.distance, 170.0);
+    EXPECT_EQ(r.segment, 3u);
+    EXPECT_DOUBLE_EQ(r.offset, -0.5); // на обратной ветви та же точка справа
+    EXPECT_EQ(back.segment, 3u);
+}
+
+TEST(path_matcher_test, degenerate_paths)
+{
+    EXPECT_THROW(PathMatcher(std::vector<Point>{}), std::invalid_argument);
+
+    const PathMatcher single({{5, 5}});
+    const PathProjection a = single.project({8, 9});
+    EXPECT_EQ(a.distance, 0.0);
+    EXPECT_DOUBLE_EQ(a.offset, 5.0);
+    EXPECT_EQ(a.point, Point(5, 5));
+
+    // Повторяющиеся точки: сегменты нулевой длины не выбираются
+    const PathMatcher dup({{0, 0}, {0, 0}, {4, 0}, {4, 0}, {4, 3}});
+    const PathProjection b = dup.project({2, -1});
+    EXPECT_EQ(b.segment, 1u);
+    EXPECT_DOUBLE_EQ(b.distance, 2.0);
+    EXPECT_DOUBLE_EQ(b.offset, -1.0);
+    PathMatcher::Hint hint;
+    hint.segment = 2;
+    EXPECT_EQ(dup.project({5, 1}, hint).segment, 3u);
+}
+
+TEST(path_matcher_test, non_finite_fix_is_not_matched)
+{
+    const PathMatcher m({{0, 0}, {10, 0}, {10, 10}});
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    constexpr double inf = std::numeric_limits<double>::infinity();
+
+    PathMatcher::Hint hint;
+    hint.segment = 1;
+    for (const Point& p: {Point{nan, 5}, Point{5, nan}, Point{inf, 0}, Point{0, -inf}}) {
+        const PathProjection r = m.project(p, hint);
+        EXPECT_EQ(r.segment, PathMatcher::npos);
+        EXPECT_TRUE(std::isnan(r.distance));
+        EXPECT_TRUE(std::isnan(r.offset));
+        EXPECT_EQ(hint.segment, 1u);
+    }
+
+    // Пропуск посреди последовательности не сбивает привязку следующих фиксов
+    const std::vector<Point> fixes{{2, 0.5}, {nan, nan}, {9.5, 4}};
+    std::vector<PathProjection> out(fixes.size());
+    m.project(fixes, out);
+    EXPECT_DOUBLE_EQ(out[0].distance, 2.0);
+    EXPECT_EQ(out[1].segment, PathMatcher::npos);
+    EXPECT_DOUBLE_EQ(out[2].distance, 14.0);
+}
+
+TEST(path_matcher_test, swath_plan_matches_brute_force)
+{
+    // Длинные проходы и короткие переезды: ячейка подбирается по расстоянию между проходами,
+    // а не по средней длине сегмента
+    const Polygon field({{0, 0}, {400, 60}, {380, 420}, {-20, 380}});
+    const SwathPlan plan = plan_swaths(field, {3.0, 30.0, 0.0});
+    ASSERT_GT(plan.path.size(), 200u);
+    const PathMatcher m(plan.path);
+    EXPECT_LE(m.cell_size(), 4.0);
+
+    std::mt19937 rng(8);
+    std::uniform_real_distribution<double> ux(-40.0, 440.0), uy(-40.0, 460.0);
+    for (int i = 0; i < 3000; ++i) {
+        const Point p{ux(rng), uy(rng)};
+        const double expected = brute_force_d2(plan.path, p);
+        const PathProjection r = m.project(p);
+        ASSERT_NEAR(r.offset * r.offset, expected, 1e-9 * (1.0 + expected)) << i;
+    }
+}
+
+TEST(path_matcher_test, diagonal_segments_match_brute_force)
+{
+    // Длинные наклонные сегменты раскладываются вдоль линии, а не по своему прямоугольнику
+    std::vector<Point> path;
+    for (int k = 0; k < 40; ++k) {
+        path.push_back({k % 2 == 0 ? 0.0 : 500.0, 7.0 * k + (k % 2 == 0 ? 0.0 : 300.0)});
+    }
+    for (const double cell: {0.0, 1.0, 13.0}) {
+        const PathMatcher m(path, cell);
+        std::mt19937 rng(21);
+        std::uniform_real_distribution<double> ux(-20.0, 520.0), uy(-20.0, 600.0);
+        for (int i = 0; i < 2000; ++i) {
+            const Point p{ux(rng), uy(rng)};
+            const double expected = brute_force_d2(path, p);
+            const PathProjection r = m.project(p);
+            ASSERT_NEAR(r.offset * r.offset, expected, 1e-9 * (1.0 + expected)) << cell << " " << i;
+        }
+    }
+}
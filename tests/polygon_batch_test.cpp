@@ -0,0 +1,156 @@
+// tests/polygon_batch_test.cpp
+#include <mylib/binary_format.h>
+#include <mylib/polygon_batch.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Полигоны в плоском виде вместе с хранилищем таблиц
+struct Flat {
+    std::vector<Point> points;
+    std::vector<std::size_t> ring_offsets{0};
+    std::vector<std::size_t> polygon_rings{0};
+
+    void add_ring(const std::vector<Point>& ring)
+    {
+        points.insert(points.end(), ring.begin(), ring.end());
+        ring_offsets.push_back(points.size());
+    }
+
+    void add(const Polygon& p)
+    {
+        add_ring(p.vertices());
+        for (const auto& h: p.holes()) {
+            add_ring(h);
+        }
+        polygon_rings.push_back(ring_offsets.size() - 1);
+    }
+
+    [[nodiscard]] FlatPolygons view() const { return {points, ring_offsets, polygon_rings}; }
+};
+
+// Звёздчатые поля разного размера, у части — дыры
+std::vector<Polygon> random_fields(std::size_t count)
+{
+    std::mt19937 rng(17);
+    std::uniform_int_distribution<int> size(3, 400);
+    std::uniform_real_distribution<double> jitter(0.7, 1.0);
+    std::vector<Polygon> out;
+    for (std::size_t k = 0; k < count; ++k) {
+        const double cx = 412000.0 + 3000.0 * static_cast<double>(k % 50);
+        const double cy = 6178000.0 + 3000.0 * static_cast<double>(k / 50);
+        const Point c{cx, cy};
+        const auto ring = [&](double radius, int n) {
+            std::vector<Point> r;
+            for (int i = 0; i < n; ++i) {
+                const double a = 2.0 * kPI * i / n;
+                const double rr = radius * jitter(rng);
+                r.push_back({c.x + rr * std::cos(a), c.y + rr * std::sin(a)});
+            }
+            return r;
+        };
+        Polygon p(ring(1000.0, size(rng)));
+        if (k % 3 == 0) p.add_hole(ring(200.0, 12));
+        out.push_back(std::move(p));
+    }
+    return out;
+}
+
+void expect_same(const PolygonMetrics& m, const Polygon& p)
+{
+    // Общий код расчёта: совпадение побитное
+    EXPECT_EQ(m.signed_area, p.signed_area());
+    EXPECT_EQ(m.area(), p.area());
+    EXPECT_EQ(m.perimeter, p.perimeter());
+    EXPECT_EQ(m.centroid, p.centroid());
+    EXPECT_EQ(m.bbox.min_x, p.bbox().min_x);
+    EXPECT_EQ(m.bbox.min_y, p.bbox().min_y);
+    EXPECT_EQ(m.bbox.max_x, p.bbox().max_x);
+    EXPECT_EQ(m.bbox.max_y, p.bbox().max_y);
+}
+
+} // namespace
+
+TEST(polygon_batch_test, matches_polygon_metrics_for_any_thread_count)
+{
+    const auto fields = random_fields(3000);
+    Flat flat;
+    for (const auto& p: fields) {
+        flat.add(p);
+    }
+
+    for (const std::size_t threads: {1u, 3u, 0u}) {
+        const auto metrics = polygon_metrics(flat.view(), threads);
+        ASSERT_EQ(metrics.size(), fields.size());
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            expect_same(metrics[i], fields[i]);
+        }
+    }
+}
+
+TEST(polygon_batch_test, closing_vertex_and_empty_polygons)
+{
+    Flat flat;
+    flat.add_ring({{0, 0}, {4, 0}, {4, 3}, {0, 3}, {0, 0}}); // с замыкающей вершиной
+    flat.add_ring({{1, 1}, {2, 1}, {2, 2}, {1, 2}});
+    flat.polygon_rings.push_back(2);
+    flat.polygon_rings.push_back(2); // полигон без колец
+    flat.add_ring({});
+    flat.polygon_rings.push_back(3); // пустой внешний контур
+
+    const auto m = polygon_metrics(flat.view());
+    ASSERT_EQ(m.size(), 3u);
+    EXPECT_DOUBLE_EQ(m[0].area(), 11.0);
+    EXPECT_DOUBLE_EQ(m[0].perimeter, 18.0);
+    EXPECT_DOUBLE_EQ(m[0].bbox.max_x, 4.0);
+    EXPECT_EQ(m[1].area(), 0.0);
+    EXPECT_TRUE(m[1].bbox.empty());
+    EXPECT_EQ(m[2].perimeter, 0.0);
+
+    EXPECT_TRUE(polygon_metrics(FlatPolygons{}).empty());
+}
+
+TEST(polygon_batch_test, rejects_inconsistent_tables)
+{
+    Flat flat;
+    flat.add(Polygon({{0, 0}, {1, 0}, {1, 1}}));
+
+    std::vector<PolygonMetrics> wrong(2);
+    EXPECT_THROW(polygon_metrics(flat.view(), wrong), std::invalid_argument);
+
+    Flat bad = flat;
+    bad.ring_offsets.back() = 10; // за концом вершин
+    EXPECT_THROW(polygon_metrics(bad.view()), std::invalid_argument);
+    bad = flat;
+    bad.polygon_rings.back() = 5; // за концом колец
+    EXPECT_THROW(polygon_metrics(bad.view()), std::invalid_argument);
+    bad = flat;
+    bad.ring_offsets = {2, 1};
+    EXPECT_THROW(polygon_metrics(bad.view()), std::invalid_argument);
+}
+
+TEST(polygon_batch_test, reads_polygons_file_in_place)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "mylib_polygon_batch.bin").string();
+    const auto fields = random_fields(500);
+    write_polygons_file(path, fields);
+    {
+        const PolygonsFile file(path);
+        std::vector<PolygonMetrics> out(file.size());
+        polygon_metrics(file, out, 2);
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            expect_same(out[i], fields[i]);
+        }
+    }
+    std::remove(path.c_str());
+}
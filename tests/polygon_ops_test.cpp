@@ -0,0 +1,279 @@
+// tests/polygon_ops_test.cpp
+#include <mylib/polygon_ops.h>
+
+#include "test_helpers.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+constexpr double kEps = 1e-9;
+
+// Отсечение выпуклым окном (Сазерленд — Ходжмен) — эталон для пересечения
+std::vector<Point> clip_convex(std::vector<Point> subject, const std::vector<Point>& window)
+{
+    for (std::size_t i = 0; i < window.size() && !subject.empty(); ++i) {
+        const Point& a = window[i];
+        const Point& b = window[(i + 1) % window.size()];
+        const auto side = [&](const Point& p) { return (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x); };
+        std::vector<Point> out;
+        for (std::size_t k = 0; k < subject.size(); ++k) {
+            const Point& p = subject[k];
+            const Point& q = subject[(k + 1) % subject.size()];
+            const double sp = side(p), sq = side(q);
+            if (sp >= 0.0) out.push_back(p);
+            if ((sp >= 0.0) != (sq >= 0.0)) {
+                const double t = sp / (sp - sq);
+                out.push_back({p.x + t * (q.x - p.x), p.y + t * (q.y - p.y)});
+            }
+        }
+        subject = std::move(out);
+    }
+    return subject;
+}
+
+std::vector<Point> field_ring(std::size_t n)
+{
+    std::vector<Point> ring(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double a = 2.0 * kPI * static_cast<double>(i) / static_cast<double>(n);
+        const double r = 500.0 + 37.0 * std::sin(7.0 * a);
+        ring[i] = {412345.0 + r * std::cos(a), 6178901.0 + r * std::sin(a)};
+    }
+    return ring;
+}
+
+} // namespace
+
+TEST(polygon_ops_test, overlapping_squares)
+{
+    const Polygon a = rect(0, 0, 2, 2);
+    const Polygon b = rect(1, 1, 3, 3);
+
+    const auto i = boolean_op(a, b, BooleanOp::Intersection);
+    ASSERT_EQ(i.size(), 1u);
+    EXPECT_NEAR(i[0].area(), 1.0, kEps);
+    EXPECT_EQ(i[0].vertices().size(), 4u);
+
+    const auto u = boolean_op(a, b, BooleanOp::Union);
+    ASSERT_EQ(u.size(), 1u);
+    EXPECT_NEAR(u[0].area(), 7.0, kEps);
+    EXPECT_EQ(u[0].vertices().size(), 8u);
+
+    const auto d = boolean_op(a, b, BooleanOp::Difference);
+    ASSERT_EQ(d.size(), 1u);
+    EXPECT_NEAR(d[0].area(), 3.0, kEps);
+    EXPECT_EQ(d[0].vertices().size(), 6u);
+
+    EXPECT_NEAR(total_area(boolean_op(a, b, BooleanOp::Xor)), 6.0, kEps);
+}
+
+TEST(polygon_ops_test, result_orientation_and_holes)
+{
+    // Внутренний квадрат вычитается из внешнего: одна дыра
+    const auto d = boolean_op(rect(0, 0, 10, 10), rect(3, 3, 6, 6), BooleanOp::Difference);
+    ASSERT_EQ(d.size(), 1u);
+    EXPECT_GT(d[0].signed_area(), 0.0);
+    ASSERT_EQ(d[0].holes().size(), 1u);
+    EXPECT_LT(ring_signed_area(d[0].holes()[0]), 0.0);
+    EXPECT_NEAR(d[0].area(), 91.0, kEps);
+    EXPECT_FALSE(d[0].contains({4.0, 4.0}));
+    EXPECT_TRUE(d[0].contains({1.0, 1.0}));
+}
+
+TEST(polygon_ops_test, disjoint_and_touching)
+{
+    const Polygon a = rect(0, 0, 1, 1);
+    EXPECT_TRUE(boolean_op(a, rect(5, 5, 6, 6), BooleanOp::Intersection).empty());
+    EXPECT_EQ(boolean_op(a, rect(5, 5, 6, 6), BooleanOp::Union).size(), 2u);
+
+    // Общее ребро: объединение — прямоугольник из четырёх вершин, пересечение пусто
+    const Polygon b = rect(1, 0, 2, 1);
+    const auto u = boolean_op(a, b, BooleanOp::Union);
+    ASSERT_EQ(u.size(), 1u);
+    EXPECT_EQ(u[0].vertices().size(), 4u);
+    EXPECT_NEAR(u[0].area(), 2.0, kEps);
+    EXPECT_TRUE(boolean_op(a, b, BooleanOp::Intersection).empty());
+
+    // Частично общее ребро (T-образные стыки)
+    const auto t = boolean_op(a, rect(1, 0.25, 3, 0.75), BooleanOp::Union);
+    ASSERT_EQ(t.size(), 1u);
+    EXPECT_NEAR(t[0].area(), 2.0, kEps);
+    EXPECT_EQ(t[0].vertices().size(), 8u);
+}
+
+TEST(polygon_ops_test, identical_operands)
+{
+    const Polygon a = rect(0, 0, 4, 3);
+    const auto i = boolean_op(a, a, BooleanOp::Intersection);
+    ASSERT_EQ(i.size(), 1u);
+    EXPECT_NEAR(i[0].area(), 12.0, kEps);
+    EXPECT_TRUE(boolean_op(a, a, BooleanOp::Difference).empty());
+    EXPECT_TRUE(boolean_op(a, a, BooleanOp::Xor).empty());
+}
+
+TEST(polygon_ops_test, orientation_of_input_is_irrelevant)
+{
+    const Polygon ccw = rect(0, 0, 2, 2);
+    const Polygon cw({{1, 1}, {1, 3}, {3, 3}, {3, 1}});
+    EXPECT_NEAR(total_area(boolean_op(ccw, cw, BooleanOp::Intersection)), 1.0, kEps);
+    EXPECT_NEAR(total_area(boolean_op(ccw, cw, BooleanOp::Union)), 7.0, kEps);
+}
+
+TEST(polygon_ops_test, strip_over_field_with_hole)
+{
+    // Полоса захвата поперёк поля с колком: колок вырезается из пересечения
+    const Polygon field({{0, 0}, {100, 0}, {100, 100}, {0, 100}}, {{{40, 40}, {60, 40}, {60, 60}, {40, 60}}});
+    const Polygon strip = rect(-10, 45, 110, 55);
+
+    const auto covered = boolean_op(field, strip, BooleanOp::Intersection);
+    ASSERT_EQ(covered.size(), 2u);
+    EXPECT_NEAR(total_area(covered), 800.0, kEps);
+
+    const auto rest = boolean_op(field, strip, BooleanOp::Difference);
+    ASSERT_EQ(rest.size(), 2u);
+    EXPECT_NEAR(total_area(rest), field.area() - 800.0, kEps);
+}
+
+TEST(polygon_ops_test, multiple_polygons_per_operand)
+{
+    // Перекрывающиеся полосы одного операнда объединяются
+    const std::vector<Polygon> strips{rect(0, 0, 10, 2), rect(0, 1, 10, 3), rect(0, 5, 10, 6)};
+    const std::vector<Polygon> field{rect(2, -1, 8, 10)};
+    const auto out = boolean_op(field, strips, BooleanOp::Intersection);
+    EXPECT_EQ(out.size(), 2u);
+    EXPECT_NEAR(total_area(out), 6.0 * 4.0, kEps);
+
+    EXPECT_NEAR(total_area(boolean_op(strips, {}, BooleanOp::Union)), 40.0, kEps);
+}
+
+TEST(polygon_ops_test, matches_convex_clip_on_large_field)
+{
+    const auto ring = field_ring(20000);
+    const Polygon field(ring);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> u(-600.0, 600.0);
+
+    for (int trial = 0; trial < 5; ++trial) {
+        // Случайный выпуклый многоугольник: правильный n-угольник со случайным центром и поворотом
+        const Point c{412345.0 + u(rng), 6178901.0 + u(rng)};
+        const double r = 300.0 + std::abs(u(rng)) * 0.5;
+        const double phase = u(rng);
+        std::vector<Point> window;
+        for (int k = 0; k < 37; ++k) {
+            const double a = phase + 2.0 * kPI * k / 37.0;
+            window.push_back({c.x + r * std::cos(a), c.y + r * std::sin(a)});
+        }
+
+        const double expected = std::abs(ring_signed_area(clip_convex(ring, window)));
+        const double got = total_area(boolean_op(field, Polygon(window), BooleanOp::Intersection));
+        EXPECT_NEAR(got, expected, 1e-6 * std::max(1.0, expected)) << "trial " << trial;
+
+        const double uni = total_area(boolean_op(field, Polygon(window), BooleanOp::Union));
+        EXPECT_NEAR(uni, field.area() + Polygon(window).area() - expected, 1e-6 * uni) << "trial " << trial;
+    }
+}
+
+TEST(polygon_ops_test, offset_square)
+{
+    const Polygon sq = rect(0, 0, 10, 10);
+
+    const auto in = offset_polygon(sq, -1.0);
+    ASSERT_EQ(in.size(), 1u);
+    EXPECT_NEAR(in[0].area(), 64.0, 1e-9);
+    EXPECT_EQ(in[0].vertices().size(), 4u);
+
+    const auto out = offset_polygon(sq, 1.0, 1e-4);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_NEAR(out[0].area(), 100.0 + 40.0 + kPI, 1e-3);
+    EXPECT_LE(out[0].area(), 100.0 + 40.0 + kPI);
+
+    EXPECT_TRUE(offset_polygon(sq, -5.5).empty());
+    EXPECT_NEAR(offset_polygon(sq, 0.0)[0].area(), 100.0, kEps);
+}
+
+TEST(polygon_ops_test, offset_with_hole_and_split)
+{
+    // Рост полигона сужает дыру
+    const Polygon ring_field({{0, 0}, {20, 0}, {20, 20}, {0, 20}}, {{{5, 5}, {15, 5}, {15, 15}, {5, 15}}});
+    const auto grown = offset_polygon(ring_field, 1.0, 1e-4);
+    ASSERT_EQ(grown.size(), 1u);
+    ASSERT_EQ(grown[0].holes().size(), 1u);
+    EXPECT_NEAR(std::abs(ring_signed_area(grown[0].holes()[0])), 64.0, 1e-9);
+
+    // Гантель с узкой перемычкой при сужении распадается на две части
+    const Polygon dumbbell({{0, 0}, {10, 0}, {10, 4.5}, {20, 4.5}, {20, 0}, {30, 0}, {30, 10}, {20, 10}, {20, 5.5},
+                            {10, 5.5}, {10, 10}, {0, 10}});
+    const auto parts = offset_polygon(dumbbell, -1.0);
+    ASSERT_EQ(parts.size(), 2u);
+    EXPECT_TRUE(parts[0].contains({5.0, 5.0}) != parts[1].contains({5.0, 5.0}));
+    EXPECT_TRUE(parts[0].contains({25.0, 5.0}) != parts[1].contains({25.0, 5.0}));
+    // Квадраты 8x8 и небольшие выступы между дугами у входа в перемычку
+    EXPECT_GT(total_area(parts), 2.0 * 64.0);
+    EXPECT_LT(total_area(parts), 2.0 * 64.0 + 0.5);
+
+    // Выпуклые углы L-образного поля при сужении остаются острыми, вогнутый скругляется дугой
+    const Polygon l({{0, 0}, {10, 0}, {10, 4}, {4, 4}, {4, 10}, {0, 10}});
+    const auto shrunk = offset_polygon(l, -1.0, 1e-4);
+    ASSERT_EQ(shrunk.size(), 1u);
+    EXPECT_NEAR(shrunk[0].area(), 28.0 + 1.0 - kPI / 4.0, 1e-3);
+}
+
+TEST(polygon_ops_test, offset_invalid_arguments)
+{
+    const Polygon sq = rect(0, 0, 1, 1);
+    EXPECT_THROW((void)offset_polygon(sq, std::nan("")), std::invalid_argument);
+    EXPECT_THROW((void)offset_polygon(sq, 1.0, 0.0), std::invalid_argument);
+}
+
+TEST(polygon_ops_test, area_identities_on_random_star_polygons)
+{
+    // Звёздчатые (невыпуклые) многоугольники со случайными радиусами
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> radius(20.0, 100.0);
+    std::uniform_real_distribution<double> shift(-60.0, 60.0);
+    const auto star = [&](const Point& c, int n) {
+        std::vector<Point> ring;
+        for (int k = 0; k < n; ++k) {
+            const double a = 2.0 * kPI * k / n;
+            const double r = radius(rng);
+            ring.push_back({c.x + r * std::cos(a), c.y + r * std::sin(a)});
+        }
+        return Polygon(std::move(ring));
+    };
+
+    for (int trial = 0; trial < 20; ++trial) {
+        const Polygon a = star({0.0, 0.0}, 200);
+        const Polygon b = star({shift(rng), shift(rng)}, 150);
+        const double i = total_area(boolean_op(a, b, BooleanOp::Intersection));
+        const double u = total_area(boolean_op(a, b, BooleanOp::Union));
+        const double d = total_area(boolean_op(a, b, BooleanOp::Difference));
+        const double x = total_area(boolean_op(a, b, BooleanOp::Xor));
+        const double tol = 1e-7 * (a.area() + b.area());
+
+        EXPECT_NEAR(u + i, a.area() + b.area(), tol) << "trial " << trial;
+        EXPECT_NEAR(d + i, a.area(), tol) << "trial " << trial;
+        EXPECT_NEAR(x, u - i, tol) << "trial " << trial;
+    }
+}
+
+TEST(polygon_ops_test, offset_large_field_headland)
+{
+    const Polygon field(field_ring(20000));
+    const auto inner = offset_polygon(field, -20.0);
+    ASSERT_EQ(inner.size(), 1u);
+    // Кольцо шириной 20 м: площадь между площадью периметр·20 и её оценкой без скруглений
+    const double band = field.area() - inner[0].area();
+    EXPECT_GT(band, 20.0 * field.perimeter() - 2.0 * kPI * 400.0);
+    EXPECT_LT(band, 20.0 * field.perimeter());
+
+    const auto outer = offset_polygon(field, 20.0);
+    ASSERT_EQ(outer.size(), 1u);
+    EXPECT_NEAR(outer[0].area() - field.area(), 20.0 * field.perimeter() + kPI * 400.0, 0.02 * field.area());
+}
@@ -0,0 +1,259 @@
+// tests/polygon_set_test.cpp
+#include <mylib/coverage.h>
+#include <mylib/polygon_batch.h>
+#include <mylib/polygon_ops.h>
+#include <mylib/polygon_set.h>
+#include <mylib/simplify.h>
+#include <mylib/swath.h>
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Счётчик выделений поверх кучи
+class CountingResource final: public std::pmr::memory_resource {
+public:
+    std::size_t allocations{0};
+    std::size_t deallocations{0};
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t align) override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t align) override
+    {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& o) const noexcept override { return this == &o; }
+};
+
+// Поле 100 x 60 с дырой 20 x 10
+Polygon field_with_hole()
+{
+    return Polygon({{0, 0}, {100, 0}, {100, 60}, {0, 60}}, {{{40, 20}, {60, 20}, {60, 30}, {40, 30}}});
+}
+
+} // namespace
+
+TEST(polygon_set_test, views_match_polygon)
+{
+    const Polygon a = field_with_hole();
+    const Polygon b({{0, 0}, {3, 0}, {0, 4}});
+
+    PolygonSet set;
+    EXPECT_EQ(set.add(a), 0u);
+    EXPECT_EQ(set.add(b), 1u);
+    ASSERT_EQ(set.size(), 2u);
+    EXPECT_EQ(set.ring_count(), 3u);
+    EXPECT_EQ(set.point_count(), 11u);
+
+    const PolygonView v = set[0];
+    ASSERT_EQ(v.vertices().size(), 4u);
+    EXPECT_EQ(v.vertices()[2], Point(100, 60));
+    std::size_t holes = 0;
+    for (const span<const Point> h: v.holes()) {
+        EXPECT_EQ(h.size(), 4u);
+        ++holes;
+    }
+    EXPECT_EQ(holes, 1u);
+
+    EXPECT_EQ(v.area(), a.area());
+    EXPECT_EQ(v.perimeter(), a.perimeter());
+    EXPECT_EQ(v.centroid(), a.centroid());
+    EXPECT_EQ(v.bbox().max_y, 60.0);
+    EXPECT_TRUE(v.contains({10, 10}));
+    EXPECT_FALSE(v.contains({50, 25})); // в дыре
+    EXPECT_DOUBLE_EQ(set[1].area(), 6.0);
+    EXPECT_TRUE(set[1].holes().empty());
+
+    const Polygon copy = v.to_polygon();
+    EXPECT_EQ(copy.vertices(), a.vertices());
+    EXPECT_EQ(copy.holes(), a.holes());
+
+    // Плоский вид — для пакетных метрик
+    const auto metrics = polygon_metrics(set.flat());
+    ASSERT_EQ(metrics.size(), 2u);
+    EXPECT_EQ(metrics[0].area(), a.area());
+    EXPECT_EQ(metrics[1].perimeter, b.perimeter());
+}
+
+TEST(polygon_set_test, views_accepted_by_field_consumers)
+{
+    const Polygon field = field_with_hole();
+    PolygonSet set;
+    set.add(field);
+
+    const SwathParams params{6.0, 30.0, 0.0};
+    const SwathPlan from_polygon = plan_swaths(field, params);
+    const SwathPlan from_view = plan_swaths(set[0], params);
+    EXPECT_EQ(from_view.path, from_polygon.path);
+    EXPECT_EQ(from_view.working_length, from_polygon.working_length);
+
+    const HeadingSweepParams sweep{6.0, 0.0, 50.0, 2};
+    EXPECT_EQ(sweep_headings(set[0], 15.0, sweep).best, sweep_headings(field, 15.0, sweep).best);
+
+    const CoverageAccumulator cov_polygon(field, 0.5);
+    const CoverageAccumulator cov_view(set[0], 0.5);
+    EXPECT_EQ(cov_view.field_area(), cov_polygon.field_area());
+
+    // Читающие алгоритмы полигонов
+    const Polygon clip({{50, -10}, {150, -10}, {150, 70}, {50, 70}});
+    PolygonSet clips;
+    clips.add(clip);
+    const auto expect_same = [](const std::vector<Polygon>& a, const std::vector<Polygon>& b) {
+        ASSERT_EQ(a.size(), b.size());
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            EXPECT_EQ(a[i].vertices(), b[i].vertices());
+            EXPECT_EQ(a[i].holes(), b[i].holes());
+        }
+    };
+    const auto by_polygon = boolean_op(field, clip, BooleanOp::Difference);
+    expect_same(boolean_op(set[0], clips[0], BooleanOp::Difference), by_polygon);
+    expect_same(boolean_op(set.flat(), clips.flat(), BooleanOp::Difference), by_polygon);
+    expect_same(offset_polygon(set[0], -3.0), offset_polygon(field, -3.0));
+
+    Simplifier simplifier(SimplifyMethod::Visvalingam, 1.0);
+    SimplifyStats stats_view;
+    SimplifyStats stats_polygon;
+    const Polygon sv = simplifier.simplify(set[0], &stats_view);
+    const Polygon sp = simplifier.simplify(field, &stats_polygon);
+    EXPECT_EQ(sv.vertices(), sp.vertices());
+    EXPECT_EQ(sv.holes(), sp.holes());
+    EXPECT_EQ(stats_view.output_size, stats_polygon.output_size);
+}
+
+TEST(polygon_set_test, moved_from_sets_are_empty_and_reusable)
+{
+    PolygonSet set;
+    set.add(field_with_hole());
+    PolygonSet moved(std::move(set));
+    EXPECT_EQ(moved.size(), 1u);
+
+    // NOLINTNEXTLINE(bugprone-use-after-move): перемещённый набор остаётся пригодным
+    EXPECT_EQ(set.size(), 0u);
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(set.ring_count(), 0u);
+    EXPECT_EQ(set.flat().size(), 0u);
+    EXPECT_THROW(set.add_hole(std::vector<Point>{{0, 0}, {1, 0}, {0, 1}}), std::logic_error);
+    EXPECT_EQ(set.add(Polygon({{0, 0}, {3, 0}, {0, 4}})), 0u);
+    set.add_hole(std::vector<Point>{{0.5, 0.5}, {1, 0.5}, {0.5, 1}});
+    ASSERT_EQ(set.size(), 1u);
+    EXPECT_EQ(set.ring_count(), 2u);
+    EXPECT_EQ(set[0].holes().size(), 1u);
+
+    moved = std::move(set);
+    EXPECT_EQ(moved[0].vertices().size(), 3u);
+    EXPECT_TRUE(set.empty());
+
+    TrackStore store;
+    store.add(std::vector<GeoPoint>{{55.0, 37.0, std::nullopt}});
+    TrackStore other(std::move(store));
+    EXPECT_EQ(other.size(), 1u);
+    EXPECT_TRUE(store.empty());
+    EXPECT_THROW(store.append(std::vector<GeoPoint>{{55.0, 37.0, std::nullopt}}), std::logic_error);
+    EXPECT_EQ(store.add(std::vector<GeoPoint>{{56.0, 38.0, std::nullopt}}), 0u);
+    ASSERT_EQ(store.size(), 1u);
+    EXPECT_EQ(store[0].size(), 1u);
+}
+
+TEST(polygon_set_test, add_from_same_set)
+{
+    // Источник лежит в буферах самого набора; каждое добавление может их перевыделить
+    PolygonSet set;
+    set.add(field_with_hole());
+    for (int i = 0; i < 6; ++i) {
+        set.add(set[0]);
+        set.add(set[0].vertices());
+        set.add_hole(set[0].holes()[0]);
+    }
+    ASSERT_EQ(set.size(), 13u);
+    const Polygon expected = field_with_hole();
+    for (std::size_t i = 0; i < set.size(); ++i) {
+        ASSERT_EQ(set[i].holes().size(), 1u);
+        EXPECT_DOUBLE_EQ(set[i].area(), expected.area());
+    }
+
+    TrackStore store;
+    store.add(std::vector<GeoPoint>{{55.0, 37.0, std::nullopt}, {55.1, 37.1, 150.0}});
+    for (int i = 0; i < 6; ++i) {
+        store.add(store[0]);
+        store.append(store[0]);
+    }
+    ASSERT_EQ(store.size(), 7u);
+    ASSERT_EQ(store[6].size(), 4u);
+    EXPECT_EQ(store[6][3].alt, 150.0);
+    EXPECT_EQ(store[6][2].lat, 55.0);
+}
+
+TEST(polygon_set_test, arena_and_clear_without_reallocation)
+{
+    CountingResource counting;
+    PolygonSet set(&counting);
+    set.reserve(1000, 1000, 4000);
+    const std::size_t reserved = counting.allocations;
+    const std::size_t released = counting.deallocations;
+
+    const std::vector<Point> ring{{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    for (int k = 0; k < 3; ++k) {
+        for (int i = 0; i < 1000; ++i) {
+            set.add(ring);
+        }
+        EXPECT_EQ(set.size(), 1000u);
+        EXPECT_EQ(counting.allocations, reserved); // ни одного выделения на полигон
+        set.clear();
+        EXPECT_TRUE(set.empty());
+        EXPECT_EQ(set.point_count(), 0u);
+    }
+    EXPECT_EQ(counting.deallocations, released);
+    EXPECT_EQ(set.resource(), &counting);
+
+    // Арена: выделения идут блоками, память возвращается целиком через release()
+    std::pmr::monotonic_buffer_resource arena(&counting);
+    const std::size_t before = counting.allocations;
+    {
+        PolygonSet in_arena(&arena);
+        for (int i = 0; i < 100; ++i) {
+            in_arena.add(ring);
+        }
+        const PolygonSet copy(in_arena);
+        EXPECT_EQ(copy.size(), 100u);
+        EXPECT_EQ(copy.resource(), std::pmr::get_default_resource());
+    }
+    EXPECT_GT(counting.allocations, before);
+    arena.release();
+    EXPECT_EQ(counting.deallocations - released, counting.allocations - before);
+
+    EXPECT_THROW(PolygonSet().add_hole(ring), std::logic_error);
+}
+
+TEST(polygon_set_test, track_store)
+{
+    TrackStore store;
+    const std::vector<GeoPoint> a{{55.0, 37.0, std::nullopt}, {55.1, 37.1, 150.0}};
+    const std::vector<GeoPoint> b{{56.0, 38.0, std::nullopt}};
+    EXPECT_EQ(store.add(a), 0u);
+    EXPECT_EQ(store.add(b), 1u);
+    store.append(a); // порция в последний трек
+
+    ASSERT_EQ(store.size(), 2u);
+    EXPECT_EQ(store.point_count(), 5u);
+    EXPECT_EQ(store[0].size(), 2u);
+    ASSERT_EQ(store[1].size(), 3u);
+    EXPECT_EQ(store[1][2].alt, 150.0);
+    EXPECT_EQ(store.offsets().size(), 3u);
+
+    store.clear();
+    EXPECT_TRUE(store.empty());
+    EXPECT_THROW(store.append(a), std::logic_error);
+}
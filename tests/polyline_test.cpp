@@ -0,0 +1,261 @@
+// tests/polyline_test.cpp
+#include <mylib/kernels.h>
+#include <mylib/polyline.h>
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <vector>
+
+// Подсчёт выделений памяти во всём тестовом бинарнике: операторы new/delete заменяются глобально
+namespace {
+std::atomic<std::size_t> g_allocations{0};
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+using namespace mylib;
+
+namespace {
+
+std::vector<Point> spiral(std::size_t n)
+{
+    std::vector<Point> pts;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double t = 0.01 * static_cast<double>(i);
+        pts.push_back({t * std::cos(t) * 100.0, t * std::sin(t) * 100.0});
+    }
+    return pts;
+}
+
+std::vector<Point> zigzag()
+{
+    // Содержит нулевой сегмент
+    return {{0, 0}, {2, 0}, {2, 0}, {2, 2}, {5, 6}, {5, 6}, {0, 6}};
+}
+
+} // namespace
+
+TEST(polyline_index_test, lengths_match_polyline_lengths)
+{
+    const PolylineIndex idx(zigzag());
+    EXPECT_EQ(idx.lengths(), polyline_lengths(zigzag()));
+    EXPECT_DOUBLE_EQ(idx.length(), 2.0 + 2.0 + 5.0 + 5.0);
+}
+
+TEST(polyline_index_test, point_at_matches_point_on_path)
+{
+    const auto pts = zigzag();
+    const PolylineIndex idx(pts);
+    for (double d = 0.0; d <= idx.length(); d += 0.25) {
+        EXPECT_EQ(idx.point_at(d), point_on_path(pts, d)) << d;
+    }
+    EXPECT_EQ(idx.point_at(idx.length()), pts.back());
+}
+
+TEST(polyline_index_test, cursor_matches_binary_search_forward_and_backward)
+{
+    const PolylineIndex idx(zigzag());
+    PolylineIndex::Cursor cursor;
+    for (double d = 0.0; d <= idx.length(); d += 0.1) {
+        EXPECT_EQ(idx.point_at(d, cursor), idx.point_at(d)) << d;
+    }
+    // Шаг назад после прохода
+    EXPECT_EQ(idx.point_at(1.0, cursor), Point(1.0, 0.0));
+    EXPECT_EQ(idx.point_at(3.0, cursor), Point(2.0, 1.0));
+}
+
+TEST(polyline_index_test, invalid_arguments_throw)
+{
+    EXPECT_THROW(PolylineIndex(std::vector<Point>{}), std::invalid_argument);
+
+    const PolylineIndex idx({{0, 0}, {1, 0}});
+    EXPECT_THROW([[maybe_unused]] auto p = idx.point_at(-0.1), std::invalid_argument);
+    EXPECT_THROW([[maybe_unused]] auto p = idx.point_at(1.1), std::invalid_argument);
+    EXPECT_THROW([[maybe_unused]] auto p = idx.point_at(std::numeric_limits<double>::infinity()), std::invalid_argument);
+
+    // NaN отвергается и без курсора, и с прогретым курсором
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_THROW([[maybe_unused]] auto p = idx.point_at(nan), std::invalid_argument);
+    PolylineIndex::Cursor cursor;
+    [[maybe_unused]] const Point warm = idx.point_at(0.5, cursor);
+    EXPECT_THROW([[maybe_unused]] auto p = idx.point_at(nan, cursor), std::invalid_argument);
+    EXPECT_THROW([[maybe_unused]] auto r = idx.resample(0.0), std::invalid_argument);
+}
+
+TEST(polyline_index_test, resample_walks_path_with_fixed_step)
+{
+    const PolylineIndex idx({{0, 0}, {10, 0}, {10, 5.5}});
+    const auto pts = idx.resample(1.0);
+    // 0..15 через 1 м и конечная точка 15.5
+    ASSERT_EQ(pts.size(), 17u);
+    for (std::size_t k = 0; k < 16; ++k) {
+        EXPECT_EQ(pts[k], idx.point_at(static_cast<double>(k)));
+    }
+    EXPECT_EQ(pts.back(), Point(10.0, 5.5));
+}
+
+TEST(polyline_index_test, resample_exact_multiple_has_no_duplicate_end)
+{
+    const PolylineIndex idx({{0, 0}, {4, 0}});
+    const auto pts = idx.resample(2.0);
+    ASSERT_EQ(pts.size(), 3u);
+    EXPECT_EQ(pts.back(), Point(4.0, 0.0));
+}
+
+TEST(polyline_index_test, single_point_path)
+{
+    const PolylineIndex idx({{3, 4}});
+    EXPECT_DOUBLE_EQ(idx.length(), 0.0);
+    EXPECT_EQ(idx.point_at(0.0), Point(3, 4));
+    ASSERT_EQ(idx.resample(1.0).size(), 1u);
+}
+
+TEST(polyline_lengths_buffer_test, span_overload_matches_vector_version)
+{
+    const auto pts = spiral(1001);
+    std::vector<double> out(pts.size());
+    polyline_lengths(pts, out);
+    EXPECT_EQ(out, polyline_lengths(pts));
+
+    std::vector<double> one(1);
+    polyline_lengths(span<const Point>(), one);
+    EXPECT_EQ(one[0], 0.0);
+}
+
+TEST(polyline_lengths_buffer_test, wrong_output_size_throws)
+{
+    const auto pts = spiral(10);
+    std::vector<double> out(9);
+    EXPECT_THROW(polyline_lengths(pts, out), std::invalid_argument);
+
+    std::vector<double> xs(10), ys(9), out10(10);
+    EXPECT_THROW(polyline_lengths(xs, ys, out10), std::invalid_argument);
+}
+
+TEST(polyline_lengths_buffer_test, soa_overload_matches_aos_within_rounding)
+{
+    const auto pts = spiral(1001);
+    std::vector<double> xs, ys;
+    for (const auto& p: pts) {
+        xs.push_back(p.x);
+        ys.push_back(p.y);
+    }
+    std::vector<double> soa(pts.size());
+    polyline_lengths(xs, ys, soa);
+
+    const auto aos = polyline_lengths(pts);
+    for (std::size_t i = 0; i < pts.size(); ++i) {
+        EXPECT_NEAR(soa[i], aos[i], 1e-12 * (1.0 + aos[i]));
+    }
+}
+
+TEST(segment_lengths_soa_test, every_level_is_bit_identical)
+{
+    const auto pts = spiral(1037);
+    std::vector<double> xs, ys;
+    for (const auto& p: pts) {
+        xs.push_back(p.x);
+        ys.push_back(p.y);
+    }
+    std::vector<double> ref(pts.size() - 1);
+    segment_lengths_soa(xs, ys, ref, SimdLevel::Scalar);
+
+    for (SimdLevel level: {SimdLevel::Avx2, SimdLevel::Avx512}) {
+        if (!simd_level_supported(level)) continue;
+        std::vector<double> out(pts.size() - 1);
+        segment_lengths_soa(xs, ys, out, level);
+        EXPECT_EQ(out, ref) << simd_level_name(level);
+    }
+}
+
+TEST(polyline_length_accumulator_test, chunked_appends_match_full_length)
+{
+    const auto pts = spiral(1000);
+    const auto s = polyline_lengths(pts);
+
+    PolylineLengthAccumulator acc;
+    EXPECT_TRUE(acc.empty());
+    std::vector<double> out(64);
+    for (std::size_t begin = 0; begin < pts.size(); begin += 64) {
+        const std::size_t n = std::min<std::size_t>(64, pts.size() - begin);
+        acc.append(span<const Point>(pts).subspan(begin, n), span<double>(out).first(n));
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(out[i], s[begin + i]);
+        }
+    }
+    EXPECT_EQ(acc.size(), pts.size());
+    EXPECT_EQ(acc.length(), s.back());
+    EXPECT_EQ(acc.last(), pts.back());
+
+    acc.reset();
+    EXPECT_EQ(acc.length(), 0.0);
+    EXPECT_TRUE(acc.empty());
+}
+
+TEST(polyline_length_accumulator_test, soa_appends_match_aos)
+{
+    const auto pts = spiral(1000);
+    std::vector<double> xs, ys;
+    for (const auto& p: pts) {
+        xs.push_back(p.x);
+        ys.push_back(p.y);
+    }
+
+    PolylineLengthAccumulator aos, soa;
+    aos.append(pts);
+    // Куски разной длины, включая больше блока ядра
+    soa.append(span<const double>(xs).first(1), span<const double>(ys).first(1));
+    soa.append(span<const double>(xs).subspan(1, 600), span<const double>(ys).subspan(1, 600));
+    soa.append(span<const double>(xs).subspan(601), span<const double>(ys).subspan(601));
+
+    EXPECT_EQ(soa.size(), aos.size());
+    EXPECT_EQ(soa.last(), aos.last());
+    EXPECT_NEAR(soa.length(), aos.length(), 1e-9 * aos.length());
+}
+
+TEST(polyline_lengths_buffer_test, hot_path_does_not_allocate)
+{
+    const auto pts = spiral(5000);
+    std::vector<double> xs, ys;
+    for (const auto& p: pts) {
+        xs.push_back(p.x);
+        ys.push_back(p.y);
+    }
+    std::vector<double> out(pts.size());
+    PolylineLengthAccumulator acc;
+
+    const std::size_t before = g_allocations.load();
+    polyline_lengths(pts, out);
+    polyline_lengths(xs, ys, out);
+    acc.append(pts);
+    acc.append(span<const Point>(pts).first(100), span<double>(out).first(100));
+    acc.append(xs, ys);
+    const std::size_t after = g_allocations.load();
+
+    EXPECT_EQ(after - before, 0u);
+
+    // Контроль самого счётчика
+    [[maybe_unused]] const auto copy = polyline_lengths(pts);
+    EXPECT_GT(g_allocations.load(), after);
+}
@@ -0,0 +1,215 @@
+// tests/projection_test.cpp
+#include <mylib/geometry.h>
+#include <mylib/projection.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+double dms(double deg, double min, double sec)
+{
+    const double v = std::abs(deg) + min / 60.0 + sec / 3600.0;
+    return deg < 0.0 ? -v : v;
+}
+
+// Длина дуги меридиана от экватора, численно (Симпсон) — независимо от рядов Крюгера
+double meridian_arc(double lat_deg)
+{
+    const double e2 = kWgs84F * (2.0 - kWgs84F);
+    const auto m = [e2](double phi) {
+        const double s = std::sin(phi);
+        return kWgs84A * (1.0 - e2) / std::pow(1.0 - e2 * s * s, 1.5);
+    };
+    const int n = 20000;
+    const double h = deg2rad(lat_deg) / n;
+    double sum = m(0.0) + m(deg2rad(lat_deg));
+    for (int i = 1; i < n; ++i) {
+        sum += (i % 2 == 1 ? 4.0 : 2.0) * m(i * h);
+    }
+    return sum * h / 3.0;
+}
+
+} // namespace
+
+TEST(projection_test, utm_central_meridian_is_scaled_meridian_arc)
+{
+    const TransverseMercator north = TransverseMercator::utm(37, true);
+    const TransverseMercator south = TransverseMercator::utm(37, false);
+    EXPECT_EQ(north.central_meridian(), 39.0);
+    for (const double lat: {0.0, 10.0, 45.0, 55.75, 70.0, 84.0}) {
+        const Point n = north.forward({lat, 39.0, std::nullopt});
+        EXPECT_NEAR(n.x, 500000.0, 1e-9) << lat;
+        EXPECT_NEAR(n.y, 0.9996 * meridian_arc(lat), 1e-4) << lat;
+
+        const Point s = south.forward({-lat, 39.0, std::nullopt});
+        EXPECT_NEAR(s.y, 10000000.0 - 0.9996 * meridian_arc(lat), 1e-4) << lat;
+    }
+}
+
+TEST(projection_test, transverse_mercator_is_conformal)
+{
+    // Конформность: масштаб по меридиану и по параллели совпадает, а их образы перпендикулярны
+    const TransverseMercator tm(0.0, 1.0);
+    const double e2 = kWgs84F * (2.0 - kWgs84F);
+    const double d = 1e-6; // градусов
+    for (const double lat: {-60.0, -5.0, 30.0, 55.0, 75.0}) {
+        for (const double dlon: {0.5, 3.0, 8.0}) {
+            const Point p = tm.forward({lat, dlon, std::nullopt});
+            const Point pn = tm.forward({lat + d, dlon, std::nullopt});
+            const Point pe = tm.forward({lat, dlon + d, std::nullopt});
+            const double s = std::sin(deg2rad(lat));
+            const double w = std::sqrt(1.0 - e2 * s * s);
+            const double meridian = kWgs84A * (1.0 - e2) / (w * w * w) * deg2rad(d);
+            const double parallel = kWgs84A / w * std::cos(deg2rad(lat)) * deg2rad(d);
+            const double h = dist(p, pn) / meridian;
+            const double k = dist(p, pe) / parallel;
+            EXPECT_NEAR(h / k, 1.0, 1e-6) << lat << " " << dlon;
+            EXPECT_NEAR(dot(pn.x - p.x, pn.y - p.y, pe.x - p.x, pe.y - p.y) / (dist(p, pn) * dist(p, pe)), 0.0, 1e-6);
+            EXPECT_GE(k, 1.0); // на осевом меридиане масштаб 1, в сторону растёт
+        }
+    }
+}
+
+TEST(projection_test, transverse_mercator_round_trip)
+{
+    for (const bool north: {true, false}) {
+        const TransverseMercator tm = TransverseMercator::utm(north ? 33 : 19, north);
+        for (double lat = 0.0; lat <= 84.0; lat += 6.0) {
+            for (double dlon = -9.0; dlon <= 9.0; dlon += 1.5) {
+                const GeoPoint g{north ? lat : -lat, tm.central_meridian() + dlon, std::nullopt};
+                const GeoPoint back = tm.inverse(tm.forward(g));
+                EXPECT_NEAR(back.lat, g.lat, 1e-11) << g.lat << " " << g.lon;
+                EXPECT_NEAR(back.lon, g.lon, 1e-11) << g.lat << " " << g.lon;
+            }
+        }
+    }
+}
+
+TEST(projection_test, aeqd_matches_vincenty_reference_line)
+{
+    // Flinders Peak -> Buninyong (Vincenty, 1975): 54 972.271 м, азимут 306°52'05.37"
+    const GeoPoint flinders{dms(-37, 57, 3.72030), dms(144, 25, 29.52440), std::nullopt};
+    const GeoPoint buninyong{dms(-37, 39, 10.15610), dms(143, 55, 35.38390), std::nullopt};
+    const AzimuthalEquidistant aeqd(flinders);
+
+    const Point p = aeqd.forward(buninyong);
+    EXPECT_NEAR(std::hypot(p.x, p.y), 54972.271, 1e-3);
+    EXPECT_NEAR(rad2deg(std::atan2(p.x, p.y)) + 360.0, dms(306, 52, 5.37), 1e-5);
+
+    const GeoPoint back = aeqd.inverse(p);
+    EXPECT_NEAR(back.lat, buninyong.lat, 1e-11);
+    EXPECT_NEAR(back.lon, buninyong.lon, 1e-11);
+}
+
+TEST(projection_test, aeqd_preserves_distance_from_center)
+{
+    // По меридиану — разность дуг меридиана, по экватору — дуга экватора
+    const AzimuthalEquidistant field({55.75, 37.61, std::nullopt});
+    const Point n = field.forward({56.25, 37.61, std::nullopt});
+    EXPECT_NEAR(n.x, 0.0, 1e-9);
+    EXPECT_NEAR(n.y, meridian_arc(56.25) - meridian_arc(55.75), 1e-4);
+
+    const AzimuthalEquidistant equator({0.0, 10.0, std::nullopt});
+    const Point e = equator.forward({0.0, 10.5, std::nullopt});
+    EXPECT_NEAR(e.x, kWgs84A * deg2rad(0.5), 1e-4);
+    EXPECT_NEAR(e.y, 0.0, 1e-9);
+
+    EXPECT_EQ(field.forward({55.75, 37.61, std::nullopt}), Point(0.0, 0.0));
+    const GeoPoint c = field.inverse({0.0, 0.0});
+    EXPECT_EQ(c.lat, 55.75);
+    EXPECT_EQ(c.lon, 37.61);
+}
+
+TEST(projection_test, aeqd_round_trip_over_poles_and_antimeridian)
+{
+    const std::vector<GeoPoint> centers{
+        {55.75, 37.61, std::nullopt}, {-33.9, 18.4, std::nullopt}, {89.9, 0.0, std::nullopt},
+        {90.0, 0.0, std::nullopt},    {0.0, 179.9, std::nullopt},  {-60.0, -179.95, std::nullopt}};
+    for (const GeoPoint& c: centers) {
+        const AzimuthalEquidistant aeqd(c);
+        for (int i = 0; i < 24; ++i) {
+            const double az = deg2rad(15.0 * i);
+            const double r = 200.0 + 40000.0 * i;
+            const Point xy{r * std::sin(az), r * std::cos(az)};
+            const GeoPoint g = aeqd.inverse(xy);
+            const Point back = aeqd.forward(g);
+            EXPECT_NEAR(back.x, xy.x, 1e-6) << c.lat << " " << c.lon << " " << i;
+            EXPECT_NEAR(back.y, xy.y, 1e-6) << c.lat << " " << c.lon << " " << i;
+            EXPECT_LE(std::abs(g.lon), 180.0);
+        }
+    }
+}
+
+TEST(projection_test, batch_matches_per_point)
+{
+    const GeoPoint c{55.75, 37.61, std::nullopt};
+    std::vector<GeoPoint> in;
+    for (int i = -20; i <= 20; ++i) {
+        in.push_back({c.lat + 2e-3 * i, c.lon - 3e-3 * i, std::nullopt});
+    }
+    std::vector<Point> xy(in.size());
+    std::vector<GeoPoint> back(in.size());
+
+    const AzimuthalEquidistant aeqd(c);
+    aeqd.forward(in, xy);
+    aeqd.inverse(xy, back);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        EXPECT_EQ(xy[i], aeqd.forward(in[i]));
+        EXPECT_EQ(back[i].lat, aeqd.inverse(xy[i]).lat);
+    }
+
+    const TransverseMercator tm = TransverseMercator::utm(37, true);
+    tm.forward(in, xy);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        EXPECT_EQ(xy[i], tm.forward(in[i]));
+    }
+
+    std::vector<Point> short_out(3);
+    EXPECT_THROW(tm.forward(in, short_out), std::invalid_argument);
+    EXPECT_THROW(aeqd.inverse(short_out, back), std::invalid_argument);
+}
+
+TEST(projection_test, geo_projector_uses_native_engines)
+{
+    const GeoPoint c{55.75, 37.61, std::nullopt};
+    const GeoPoint g{55.76, 37.63, std::nullopt};
+
+    const GeoProjector aeqd(ProjectorKey::aeqd(c));
+    EXPECT_EQ(aeqd.forward(g), AzimuthalEquidistant(c).forward(g));
+    EXPECT_EQ(aeqd.definition().rfind("+proj=aeqd", 0), 0u);
+
+    const GeoProjector utm(ProjectorKey::utm(37, true));
+    EXPECT_EQ(utm.forward(g), TransverseMercator::utm(37, true).forward(g));
+    EXPECT_NEAR(GeoToXYUtm{}.xy_to_geo(c, utm.forward(g)).lon, g.lon, 1e-12);
+}
+
+#if defined(MYLIB_WITH_PROJ)
+TEST(projection_test, native_matches_proj_within_millimetre)
+{
+    const GeoPoint c{55.75, 37.61, std::nullopt};
+    std::vector<GeoPoint> in;
+    for (int i = -10; i <= 10; ++i) {
+        for (int j = -10; j <= 10; ++j) {
+            in.push_back({c.lat + 0.05 * i, c.lon + 0.3 * j, std::nullopt});
+        }
+    }
+    std::vector<Point> native(in.size());
+    std::vector<Point> proj(in.size());
+
+    for (const ProjectorKey& key: {ProjectorKey::aeqd(c), ProjectorKey::utm(37, true)}) {
+        ProjectorKey proj_key = key;
+        proj_key.backend = ProjectorBackend::Proj;
+        GeoProjector(key).forward(in, native);
+        GeoProjector(proj_key).forward(in, proj);
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            EXPECT_NEAR(native[i].x, proj[i].x, 1e-3) << in[i].lat << " " << in[i].lon;
+            EXPECT_NEAR(native[i].y, proj[i].y, 1e-3) << in[i].lat << " " << in[i].lon;
+        }
+    }
+}
+#endif
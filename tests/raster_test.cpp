@@ -0,0 +1,223 @@
+// tests/raster_test.cpp
+#include <mylib/polygon_set.h>
+#include <mylib/raster.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Растр с собственным буфером
+struct OwnedGrid {
+    std::vector<float> data;
+    RasterGrid grid;
+
+    OwnedGrid(Point origin, double cell, std::size_t cols, std::size_t rows, float fill = 0.0f)
+        : data(cols * rows, fill)
+        , grid{origin, cell, cols, rows, span<float>(data)}
+    {
+    }
+
+    // Покрытая площадь в м² при value = 1
+    [[nodiscard]] double covered() const
+    {
+        const double sum = std::accumulate(data.begin(), data.end(), 0.0);
+        return sum * grid.cell_size * grid.cell_size;
+    }
+};
+
+// Поле, не выровненное по сетке, с дырой
+Polygon field_with_hole()
+{
+    return Polygon({{3.3, 2.1}, {81.7, 9.4}, {74.2, 63.9}, {11.5, 55.2}},
+                   {{{30.2, 25.7}, {50.9, 24.3}, {46.1, 40.8}}});
+}
+
+} // namespace
+
+TEST(raster_test, exact_coverage_sums_to_area)
+{
+    const Polygon field = field_with_hole();
+    OwnedGrid g({0, 0}, 0.7, 130, 100);
+    rasterize(field, g.grid, RasterParams{});
+    EXPECT_NEAR(g.covered(), field.area(), 1e-3);
+    for (float v: g.data) {
+        ASSERT_GE(v, 0.0f);
+        ASSERT_LE(v, 1.0f);
+    }
+
+    // Ориентация колец не влияет на результат
+    std::vector<Point> outer(field.vertices().rbegin(), field.vertices().rend());
+    std::vector<Point> hole(field.holes()[0].rbegin(), field.holes()[0].rend());
+    OwnedGrid reversed({0, 0}, 0.7, 130, 100);
+    rasterize(Polygon(outer, {hole}), reversed.grid, RasterParams{});
+    for (std::size_t i = 0; i < g.data.size(); ++i) {
+        ASSERT_NEAR(reversed.data[i], g.data[i], 1e-6f);
+    }
+
+    // Вид из PolygonSet даёт тот же растр
+    PolygonSet set;
+    set.add(field);
+    OwnedGrid from_view({0, 0}, 0.7, 130, 100);
+    rasterize(set[0], from_view.grid, RasterParams{});
+    EXPECT_EQ(from_view.data, g.data);
+}
+
+TEST(raster_test, cell_center_matches_contains)
+{
+    const Polygon field = field_with_hole();
+    OwnedGrid g({0, 0}, 1.3, 70, 55);
+    RasterParams params;
+    params.coverage = RasterCoverage::CellCenter;
+    rasterize(field, g.grid, params);
+
+    for (std::size_t row = 0; row < g.grid.rows; ++row) {
+        for (std::size_t col = 0; col < g.grid.cols; ++col) {
+            const Point center{(static_cast<double>(col) + 0.5) * 1.3, (static_cast<double>(row) + 0.5) * 1.3};
+            ASSERT_EQ(g.grid.at(col, row), field.contains(center) ? 1.0f : 0.0f) << col << ' ' << row;
+        }
+    }
+}
+
+TEST(raster_test, threads_do_not_change_result)
+{
+    const Polygon field = field_with_hole();
+    const std::vector<Point> path{{5, 5}, {70, 12}, {60, 50}, {10, 40}};
+    RasterParams params;
+    params.threads = 1;
+    OwnedGrid one({0, 0}, 0.25, 340, 270);
+    rasterize(field, one.grid, params);
+    rasterize_strip(path, 6.0, one.grid, params);
+
+    params.threads = 4;
+    OwnedGrid four({0, 0}, 0.25, 340, 270);
+    rasterize(field, four.grid, params);
+    rasterize_strip(path, 6.0, four.grid, params);
+    EXPECT_EQ(four.data, one.data);
+}
+
+TEST(raster_test, merge_modes)
+{
+    // Квадрат [1, 3] x [1, 2.5]: ячейки строки 2 покрыты наполовину
+    const Polygon square({{1, 1}, {3, 1}, {3, 2.5}, {1, 2.5}});
+    RasterParams params;
+    params.value = 6.0;
+
+    OwnedGrid replace({0, 0}, 1.0, 4, 4, 2.0f);
+    rasterize(square, replace.grid, params);
+    EXPECT_FLOAT_EQ(replace.grid.at(1, 1), 6.0f);
+    EXPECT_FLOAT_EQ(replace.grid.at(2, 2), 4.0f); // 2 + 0.5 * (6 - 2)
+    EXPECT_FLOAT_EQ(replace.grid.at(0, 0), 2.0f); // вне фигуры не трогается
+
+    params.merge = RasterMerge::Max;
+    OwnedGrid max({0, 0}, 1.0, 4, 4, 4.0f);
+    rasterize(square, max.grid, params);
+    EXPECT_FLOAT_EQ(max.grid.at(1, 1), 6.0f);
+    EXPECT_FLOAT_EQ(max.grid.at(2, 2), 4.0f); // max(4, 0.5 * 6)
+
+    params.merge = RasterMerge::Add;
+    OwnedGrid add({0, 0}, 1.0, 4, 4, 1.0f);
+    rasterize(square, add.grid, params);
+    rasterize(square, add.grid, params);
+    EXPECT_FLOAT_EQ(add.grid.at(1, 1), 13.0f);
+    EXPECT_FLOAT_EQ(add.grid.at(2, 2), 7.0f);
+}
+
+TEST(raster_test, clips_to_grid)
+{
+    // Растр [10, 20] x [10, 15] целиком внутри фигуры
+    const Polygon big({{-50, -40}, {90, -30}, {80, 70}, {-60, 60}});
+    OwnedGrid inside({10, 10}, 0.5, 20, 10);
+    rasterize(big, inside.grid, RasterParams{});
+    for (float v: inside.data) {
+        ASSERT_FLOAT_EQ(v, 1.0f);
+    }
+
+    // Ромб выходит за все края растра: сумма — площадь пересечения
+    const Polygon diamond({{5, -3}, {13, 5}, {5, 13}, {-3, 5}});
+    OwnedGrid clipped({0, 0}, 0.5, 20, 20);
+    rasterize(diamond, clipped.grid, RasterParams{});
+    // Ромб площадью 128 без четырёх вершин за краями: треугольники высотой 3 и основанием 6
+    EXPECT_NEAR(clipped.covered(), 128.0 - 4 * 9.0, 1e-4);
+
+    // Фигура вне растра не меняет его
+    OwnedGrid outside({100, 100}, 1.0, 5, 5);
+    rasterize(diamond, outside.grid, RasterParams{});
+    EXPECT_EQ(outside.covered(), 0.0);
+
+    // Растр без столбцов или без строк: нечего заполнять
+    const Polygon band({{-5, 1}, {5, 1}, {5, 8}, {-5, 8}});
+    const std::vector<Point> path{{-5, 1}, {5, 8}};
+    for (const RasterGrid& empty: {RasterGrid{{0, 0}, 1.0, 0, 10, {}}, RasterGrid{{0, 0}, 1.0, 10, 0, {}}}) {
+        for (const RasterCoverage coverage: {RasterCoverage::Exact, RasterCoverage::CellCenter}) {
+            RasterParams params;
+            params.coverage = coverage;
+            EXPECT_NO_THROW(rasterize(band, empty, params));
+            EXPECT_NO_THROW(rasterize_strip(path, 2.0, empty, params));
+        }
+    }
+}
+
+TEST(raster_test, strip_area)
+{
+    // Прямой проход: прямоугольник длина x ширина
+    const std::vector<Point> straight{{2.3, 10.1}, {52.3, 18.4}};
+    OwnedGrid g({0, 0}, 0.2, 300, 150);
+    rasterize_strip(straight, 6.0, g.grid, RasterParams{});
+    const double length = std::hypot(50.0, 8.3);
+    EXPECT_NEAR(g.covered(), length * 6.0, 1e-3);
+
+    // Поворот на 90°: два прямоугольника минус перекрытие h² плюс четверть круга снаружи
+    const std::vector<Point> turn{{5, 5}, {45, 5}, {45, 25}};
+    OwnedGrid t({0, 0}, 0.2, 300, 200);
+    rasterize_strip(turn, 4.0, t.grid, RasterParams{});
+    const double expected = 40.0 * 4.0 + 20.0 * 4.0 - 4.0 + kPI * 4.0 / 4.0;
+    EXPECT_NEAR(t.covered(), expected, 0.01 * expected);
+
+    // Повторные и одиночные точки не дают полосы
+    const std::vector<Point> point{{5, 5}, {5, 5}};
+    OwnedGrid empty({0, 0}, 1.0, 10, 10);
+    rasterize_strip(point, 4.0, empty.grid, RasterParams{});
+    EXPECT_EQ(empty.covered(), 0.0);
+}
+
+TEST(raster_test, strip_breaks_at_non_finite_points)
+{
+    // Пропуск решения между проходами: две отдельные полосы, без перемычки через пропуск
+    const double nan = std::nan("");
+    const std::vector<Point> path{{5, 5}, {45, 5}, {nan, nan}, {45, 25}, {5, 25}};
+    OwnedGrid g({0, 0}, 0.2, 300, 200);
+    rasterize_strip(path, 4.0, g.grid, RasterParams{});
+    EXPECT_NEAR(g.covered(), 2.0 * 40.0 * 4.0, 1e-3);
+
+    const std::vector<Point> broken{{nan, 5}, {5, std::numeric_limits<double>::infinity()}, {5, 5}};
+    OwnedGrid e({0, 0}, 1.0, 10, 10);
+    rasterize_strip(broken, 4.0, e.grid, RasterParams{});
+    EXPECT_EQ(e.covered(), 0.0);
+}
+
+TEST(raster_test, invalid_arguments)
+{
+    const Polygon square({{0, 0}, {1, 0}, {1, 1}, {0, 1}});
+    const std::vector<Point> path{{0, 0}, {1, 1}};
+    OwnedGrid g({0, 0}, 1.0, 4, 4);
+
+    RasterGrid bad_cell = g.grid;
+    bad_cell.cell_size = 0.0;
+    EXPECT_THROW(rasterize(square, bad_cell, RasterParams{}), std::invalid_argument);
+
+    RasterGrid bad_size = g.grid;
+    bad_size.rows = 5;
+    EXPECT_THROW(rasterize(square, bad_size, RasterParams{}), std::invalid_argument);
+    EXPECT_THROW(rasterize_strip(path, 1.0, bad_size, RasterParams{}), std::invalid_argument);
+
+    EXPECT_THROW(rasterize_strip(path, 0.0, g.grid, RasterParams{}), std::invalid_argument);
+    EXPECT_THROW(rasterize_strip(path, std::nan(""), g.grid, RasterParams{}), std::invalid_argument);
+}
@@ -0,0 +1,218 @@
+// tests/simplify_test.cpp
+#include <mylib/simplify.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+constexpr double kEps = 1e-9;
+
+// Шумная ломаная из прямых участков с поворотами: 4 отрезка по 1000 точек
+std::vector<Point> noisy_zigzag(double noise, unsigned seed = 7)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> u(-noise, noise);
+    const std::vector<Point> corners{{0.0, 0.0}, {1000.0, 0.0}, {1000.0, 500.0}, {0.0, 500.0}, {0.0, 1000.0}};
+    std::vector<Point> pts;
+    for (std::size_t c = 0; c + 1 < corners.size(); ++c) {
+        for (int k = 0; k < 1000; ++k) {
+            const double t = k / 1000.0;
+            pts.push_back({corners[c].x + t * (corners[c + 1].x - corners[c].x) + u(rng),
+                           corners[c].y + t * (corners[c + 1].y - corners[c].y) + u(rng)});
+        }
+    }
+    pts.push_back(corners.back());
+    return pts;
+}
+
+double dist_to_segment(const Point& p, const Point& a, const Point& b)
+{
+    const double dx = b.x - a.x, dy = b.y - a.y;
+    const double len2 = dx * dx + dy * dy;
+    const double t = len2 > 0.0 ? std::clamp(((p.x - a.x) * dx + (p.y - a.y) * dy) / len2, 0.0, 1.0) : 0.0;
+    return std::hypot(p.x - a.x - t * dx, p.y - a.y - t * dy);
+}
+
+} // namespace
+
+TEST(simplify_test, douglas_peucker_keeps_corners_of_noisy_track)
+{
+    const auto pts = noisy_zigzag(0.1);
+    const auto out = simplify_polyline(pts, SimplifyMethod::DouglasPeucker, 0.5);
+
+    // Вдоль прямых участков шум ниже допуска; лишняя вершина возможна там, где шум даёт максимум отклонения
+    EXPECT_LE(out.size(), 8u);
+    for (const Point& c: {Point{1000.0, 0.0}, Point{1000.0, 500.0}, Point{0.0, 500.0}}) {
+        const bool found = std::any_of(out.begin(), out.end(),
+                                       [&](const Point& p) { return std::hypot(p.x - c.x, p.y - c.y) < 0.5; });
+        EXPECT_TRUE(found) << c.x << ", " << c.y;
+    }
+    EXPECT_EQ(out.front().x, pts.front().x);
+    EXPECT_EQ(out.back().x, pts.back().x);
+}
+
+TEST(simplify_test, douglas_peucker_respects_tolerance)
+{
+    const auto pts = noisy_zigzag(3.0);
+    const double tol = 2.0;
+    const auto out = simplify_polyline(pts, SimplifyMethod::DouglasPeucker, tol);
+    ASSERT_LT(out.size(), pts.size());
+
+    // Каждая исходная точка — не дальше допуска от упрощённой ломаной на своём участке
+    std::size_t j = 0;
+    for (const Point& p: pts) {
+        if (j + 1 < out.size() && p.x == out[j + 1].x && p.y == out[j + 1].y) ++j;
+        const Point& b = out[std::min(j + 1, out.size() - 1)];
+        EXPECT_LE(dist_to_segment(p, out[j], b), tol + kEps);
+    }
+}
+
+TEST(simplify_test, visvalingam_removes_small_triangles_only)
+{
+    // Площади: 0.05, 0.1 (после удаления соседа 0.15), 2.55 (затем 7.5), 5, 2.5
+    const std::vector<Point> pts{{0, 0}, {1, 0}, {2, 0.1}, {3, 0}, {4, 5}, {5, 0}, {6, 0}};
+    const auto out = simplify_polyline(pts, SimplifyMethod::Visvalingam, 1.0);
+
+    ASSERT_EQ(out.size(), 5u);
+    EXPECT_EQ(out[0].x, 0.0);
+    EXPECT_EQ(out[1].x, 3.0);
+    EXPECT_EQ(out[2].x, 4.0);
+    EXPECT_EQ(out[3].x, 5.0);
+    EXPECT_EQ(out[4].x, 6.0);
+
+    // С допуском 3 уходит и вершина 5
+    EXPECT_EQ(simplify_polyline(pts, SimplifyMethod::Visvalingam, 3.0).size(), 4u);
+}
+
+TEST(simplify_test, zero_tolerance_drops_only_collinear_points)
+{
+    const std::vector<Point> pts{{0, 0}, {1, 0}, {2, 0}, {2, 1}, {2, 2}, {3, 3}};
+    for (const auto method: {SimplifyMethod::DouglasPeucker, SimplifyMethod::Visvalingam}) {
+        const auto out = simplify_polyline(pts, method, 0.0);
+        EXPECT_GE(out.size(), 4u);
+        EXPECT_LE(out.size(), pts.size());
+    }
+    const auto dp = simplify_polyline(pts, SimplifyMethod::DouglasPeucker, 0.0);
+    EXPECT_EQ(dp.size(), 4u);
+}
+
+TEST(simplify_test, in_place_matches_buffer_and_reports_ratio)
+{
+    const auto pts = noisy_zigzag(0.1);
+    for (const auto method: {SimplifyMethod::DouglasPeucker, SimplifyMethod::Visvalingam}) {
+        Simplifier s(method, method == SimplifyMethod::DouglasPeucker ? 0.5 : 5.0);
+
+        std::vector<Point> buf(pts.size());
+        const SimplifyStats a = s.simplify(pts, buf);
+        std::vector<Point> in_place = pts;
+        const SimplifyStats b = s.simplify(in_place);
+
+        EXPECT_EQ(a.input_size, pts.size());
+        EXPECT_EQ(a.output_size, b.output_size);
+        ASSERT_EQ(in_place.size(), b.output_size);
+        for (std::size_t i = 0; i < in_place.size(); ++i) {
+            EXPECT_EQ(in_place[i].x, buf[i].x);
+            EXPECT_EQ(in_place[i].y, buf[i].y);
+        }
+        EXPECT_GT(a.ratio(), 10.0);
+        EXPECT_DOUBLE_EQ(a.ratio(), static_cast<double>(a.input_size) / static_cast<double>(a.output_size));
+    }
+}
+
+TEST(simplify_test, short_and_empty_input)
+{
+    Simplifier s(SimplifyMethod::Visvalingam, 100.0);
+    std::vector<Point> empty;
+    EXPECT_EQ(s.simplify(empty).output_size, 0u);
+    EXPECT_EQ(SimplifyStats{}.ratio(), 0.0);
+
+    std::vector<Point> two{{0, 0}, {1, 1}};
+    EXPECT_EQ(s.simplify(two).output_size, 2u);
+
+    Simplifier dp(SimplifyMethod::DouglasPeucker, 100.0);
+    std::vector<Point> one{{3, 4}};
+    EXPECT_EQ(dp.simplify(one).output_size, 1u);
+}
+
+TEST(simplify_test, invalid_arguments)
+{
+    EXPECT_THROW(Simplifier(SimplifyMethod::DouglasPeucker, -1.0), std::invalid_argument);
+    EXPECT_THROW(Simplifier(SimplifyMethod::Visvalingam, std::nan("")), std::invalid_argument);
+
+    Simplifier s(SimplifyMethod::DouglasPeucker, 1.0);
+    const std::vector<Point> pts{{0, 0}, {1, 0}, {2, 0}};
+    std::vector<Point> small(2);
+    EXPECT_THROW(s.simplify(pts, small), std::invalid_argument);
+    EXPECT_THROW(s.simplify_ring(pts, small), std::invalid_argument);
+}
+
+TEST(simplify_test, ring_keeps_at_least_three_vertices)
+{
+    std::vector<Point> ring;
+    for (int i = 0; i < 360; ++i) {
+        const double a = 2.0 * kPI * i / 360.0;
+        ring.push_back({100.0 * std::cos(a), 100.0 * std::sin(a)});
+    }
+    for (const auto method: {SimplifyMethod::DouglasPeucker, SimplifyMethod::Visvalingam}) {
+        Simplifier s(method, 1e9);
+        std::vector<Point> out(ring.size());
+        const SimplifyStats stats = s.simplify_ring(ring, out);
+        EXPECT_EQ(stats.output_size, 3u);
+        out.resize(stats.output_size);
+        EXPECT_GT(std::abs(ring_signed_area(out)), 1000.0);
+    }
+}
+
+TEST(simplify_test, ring_douglas_peucker_close_to_original_area)
+{
+    std::vector<Point> ring;
+    for (int i = 0; i < 3600; ++i) {
+        const double a = 2.0 * kPI * i / 3600.0;
+        ring.push_back({500.0 * std::cos(a), 500.0 * std::sin(a)});
+    }
+    Simplifier s(SimplifyMethod::DouglasPeucker, 0.1);
+    std::vector<Point> out(ring.size());
+    const SimplifyStats stats = s.simplify_ring(ring, out);
+    out.resize(stats.output_size);
+
+    EXPECT_GT(stats.ratio(), 10.0);
+    EXPECT_NEAR(ring_signed_area(out), ring_signed_area(ring), 2.0 * kPI * 500.0 * 0.1);
+}
+
+TEST(simplify_test, polygon_with_holes)
+{
+    auto densify = [](std::vector<Point> corners) {
+        std::vector<Point> ring;
+        for (std::size_t c = 0; c < corners.size(); ++c) {
+            const Point& a = corners[c];
+            const Point& b = corners[(c + 1) % corners.size()];
+            for (int k = 0; k < 100; ++k) {
+                ring.push_back({a.x + (b.x - a.x) * k / 100.0, a.y + (b.y - a.y) * k / 100.0});
+            }
+        }
+        return ring;
+    };
+    const Polygon poly(densify({{0, 0}, {100, 0}, {100, 100}, {0, 100}}),
+                       {densify({{40, 40}, {40, 60}, {60, 60}, {60, 40}})});
+
+    for (const auto method: {SimplifyMethod::DouglasPeucker, SimplifyMethod::Visvalingam}) {
+        Simplifier s(method, 0.01);
+        SimplifyStats stats;
+        const Polygon out = s.simplify(poly, &stats);
+
+        EXPECT_EQ(out.vertices().size(), 4u);
+        ASSERT_EQ(out.holes().size(), 1u);
+        EXPECT_EQ(out.holes()[0].size(), 4u);
+        EXPECT_EQ(stats.input_size, 800u);
+        EXPECT_EQ(stats.output_size, 8u);
+        EXPECT_NEAR(out.area(), poly.area(), 1e-6);
+        EXPECT_NEAR(out.area(), 9600.0, 1e-6);
+    }
+}
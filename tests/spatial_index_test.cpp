@@ -0,0 +1,132 @@
+// tests/spatial_index_test.cpp
+#include <mylib/spatial_index.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+// Случайные звёздчатые (невыпуклые) полигоны, частично перекрывающиеся
+std::vector<Polygon> random_polygons(std::size_t n, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> pos(0.0, 1000.0);
+    std::uniform_real_distribution<double> rad(5.0, 40.0);
+    std::vector<Polygon> out;
+    for (std::size_t i = 0; i < n; ++i) {
+        const Point c{pos(rng), pos(rng)};
+        std::vector<Point> v;
+        for (int k = 0; k < 7; ++k) {
+            const double a = 2.0 * kPI * k / 7.0;
+            const double r = rad(rng);
+            v.push_back({c.x + r * std::cos(a), c.y + r * std::sin(a)});
+        }
+        out.emplace_back(std::move(v));
+    }
+    return out;
+}
+
+} // namespace
+
+TEST(polygon_contains_test, square_and_concave)
+{
+    const Polygon sq({{0, 0}, {2, 0}, {2, 2}, {0, 2}});
+    EXPECT_TRUE(sq.contains({1, 1}));
+    EXPECT_FALSE(sq.contains({3, 1}));
+    EXPECT_FALSE(sq.contains({1, -0.5}));
+
+    // Буква «П»: выемка сверху
+    const Polygon u({{0, 0}, {3, 0}, {3, 3}, {2, 3}, {2, 1}, {1, 1}, {1, 3}, {0, 3}});
+    EXPECT_TRUE(u.contains({0.5, 2.5}));
+    EXPECT_TRUE(u.contains({1.5, 0.5}));
+    EXPECT_FALSE(u.contains({1.5, 2.0}));
+}
+
+TEST(polygon_contains_test, degenerate_polygon_contains_nothing)
+{
+    const Polygon seg({{0, 0}, {1, 1}});
+    EXPECT_FALSE(seg.contains({0.5, 0.5}));
+}
+
+TEST(bbox_test, expand_contains_intersects)
+{
+    BBox b;
+    EXPECT_TRUE(b.empty());
+    b.expand(Point{0, 0});
+    b.expand(Point{2, 1});
+    EXPECT_FALSE(b.empty());
+    EXPECT_TRUE(b.contains({2, 1}));
+    EXPECT_FALSE(b.contains({2.1, 1}));
+    EXPECT_TRUE(b.intersects(BBox{2, 1, 3, 3}));
+    EXPECT_FALSE(b.intersects(BBox{2.5, 0, 3, 3}));
+}
+
+TEST(polygon_index_test, point_queries_match_linear_scan)
+{
+    const auto polys = random_polygons(2000, 1);
+    const PolygonIndex idx(polys);
+    ASSERT_EQ(idx.size(), polys.size());
+
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<double> pos(-50.0, 1050.0);
+    std::vector<std::size_t> got;
+    for (int q = 0; q < 2000; ++q) {
+        const Point p{pos(rng), pos(rng)};
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 0; i < polys.size(); ++i) {
+            if (polys[i].contains(p)) expected.push_back(i);
+        }
+        idx.query_point(p, got);
+        ASSERT_EQ(got, expected);
+
+        const std::size_t first = idx.locate(p);
+        if (expected.empty()) {
+            EXPECT_EQ(first, PolygonIndex::npos);
+        } else {
+            EXPECT_TRUE(polys[first].contains(p));
+        }
+    }
+}
+
+TEST(polygon_index_test, bbox_queries_match_linear_scan)
+{
+    const auto polys = random_polygons(1000, 3);
+    for (std::size_t capacity: {2u, 4u, 16u}) {
+        const PolygonIndex idx(polys, capacity);
+        const BBox q{200, 300, 450, 380};
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 0; i < polys.size(); ++i) {
+            BBox b;
+            for (const auto& v: polys[i].vertices()) b.expand(v);
+            if (b.intersects(q)) expected.push_back(i);
+        }
+        EXPECT_EQ(idx.query_bbox(q), expected) << capacity;
+    }
+}
+
+TEST(polygon_index_test, batch_locate)
+{
+    const PolygonIndex idx({
+        Polygon({{0, 0}, {1, 0}, {1, 1}, {0, 1}}),
+        Polygon({{2, 0}, {3, 0}, {3, 1}, {2, 1}}),
+    });
+    const std::vector<Point> pts{{0.5, 0.5}, {2.5, 0.5}, {1.5, 0.5}};
+    std::vector<std::size_t> out(pts.size());
+    idx.locate(pts, out);
+    EXPECT_EQ(out, (std::vector<std::size_t>{0, 1, PolygonIndex::npos}));
+
+    std::vector<std::size_t> small(2);
+    EXPECT_THROW(idx.locate(pts, small), std::invalid_argument);
+}
+
+TEST(polygon_index_test, empty_index)
+{
+    const PolygonIndex idx({});
+    EXPECT_EQ(idx.locate({0, 0}), PolygonIndex::npos);
+    EXPECT_TRUE(idx.query_point({0, 0}).empty());
+    EXPECT_TRUE(idx.query_bbox(BBox{0, 0, 1, 1}).empty());
+}
@@ -0,0 +1,169 @@
+// tests/swath_test.cpp
+#include <mylib/swath.h>
+
+#include "test_helpers.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+constexpr double kEps = 1e-9;
+
+void expect_near_point(const Point& p, const Point& q)
+{
+    EXPECT_NEAR(p.x, q.x, kEps);
+    EXPECT_NEAR(p.y, q.y, kEps);
+}
+
+} // namespace
+
+TEST(swath_test, rectangle_along_y_alternates_direction)
+{
+    const SwathPlan plan = plan_swaths(rect(0.0, 0.0, 100.0, 30.0), {10.0, 0.0, 0.0});
+
+    ASSERT_EQ(plan.swaths.size(), 10u);
+    EXPECT_EQ(plan.turns(), 9u);
+    expect_near_point(plan.swaths[0].start, {5.0, 0.0});
+    expect_near_point(plan.swaths[0].end, {5.0, 30.0});
+    expect_near_point(plan.swaths[1].start, {15.0, 30.0});
+    expect_near_point(plan.swaths[1].end, {15.0, 0.0});
+    expect_near_point(plan.swaths[9].end, {95.0, 0.0});
+
+    EXPECT_NEAR(plan.working_length, 300.0, kEps);
+    EXPECT_NEAR(plan.transition_length, 90.0, kEps);
+}
+
+TEST(swath_test, heading_rotates_swaths)
+{
+    const SwathPlan plan = plan_swaths(rect(0.0, 0.0, 100.0, 30.0), {10.0, 90.0, 0.0});
+
+    ASSERT_EQ(plan.swaths.size(), 3u);
+    for (const BoundPoints& s: plan.swaths) {
+        EXPECT_NEAR(s.start.y, s.end.y, kEps);
+        EXPECT_NEAR(std::abs(s.end.x - s.start.x), 100.0, kEps);
+    }
+    EXPECT_NEAR(plan.working_length, 300.0, kEps);
+}
+
+TEST(swath_test, hole_splits_swaths)
+{
+    const Polygon field({{0.0, 0.0}, {100.0, 0.0}, {100.0, 100.0}, {0.0, 100.0}},
+                        {{{40.0, 40.0}, {60.0, 40.0}, {60.0, 60.0}, {40.0, 60.0}}});
+    const SwathPlan plan = plan_swaths(field, {10.0, 0.0, 0.0});
+
+    // Линии x = 45 и x = 55 проходят через дыру и делятся надвое
+    EXPECT_EQ(plan.swaths.size(), 12u);
+    EXPECT_NEAR(plan.working_length, 1000.0 - 2.0 * 20.0, kEps);
+    for (const BoundPoints& s: plan.swaths) {
+        const Point mid{0.5 * (s.start.x + s.end.x), 0.5 * (s.start.y + s.end.y)};
+        EXPECT_TRUE(field.contains(mid));
+    }
+}
+
+TEST(swath_test, concave_field_swaths_stay_inside_and_path_is_connected)
+{
+    // Г-образное поле под произвольным углом
+    const Polygon field({{0.0, 0.0}, {200.0, 0.0}, {200.0, 50.0}, {60.0, 50.0}, {60.0, 150.0}, {0.0, 150.0}});
+    const SwathPlan plan = plan_swaths(field, {6.0, 33.0, 0.0});
+
+    ASSERT_FALSE(plan.swaths.empty());
+    ASSERT_EQ(plan.path.size(), 2 * plan.swaths.size());
+
+    double working = 0.0;
+    double transitions = 0.0;
+    for (std::size_t i = 0; i < plan.swaths.size(); ++i) {
+        const BoundPoints& s = plan.swaths[i];
+        const Point mid{0.5 * (s.start.x + s.end.x), 0.5 * (s.start.y + s.end.y)};
+        EXPECT_TRUE(field.contains(mid));
+        EXPECT_EQ(plan.path[2 * i], s.start);
+        EXPECT_EQ(plan.path[2 * i + 1], s.end);
+        working += dist(s.start, s.end);
+        if (i > 0) transitions += dist(plan.swaths[i - 1].end, s.start);
+    }
+    EXPECT_NEAR(plan.working_length, working, 1e-6);
+    EXPECT_NEAR(plan.transition_length, transitions, 1e-6);
+    // Покрытие: площадь ≈ длина проходов * ширина
+    EXPECT_NEAR(plan.working_length * 6.0, field.area(), 0.05 * field.area());
+}
+
+TEST(swath_test, min_length_drops_short_swaths)
+{
+    // Треугольник: проходы у вершины короткие
+    const Polygon tri({{0.0, 0.0}, {100.0, 0.0}, {0.0, 100.0}});
+    const SwathPlan all = plan_swaths(tri, {10.0, 0.0, 0.0});
+    const SwathPlan longer = plan_swaths(tri, {10.0, 0.0, 30.0});
+    EXPECT_EQ(all.swaths.size(), 10u);
+    EXPECT_EQ(longer.swaths.size(), 7u);
+    for (const BoundPoints& s: longer.swaths) {
+        EXPECT_GE(dist(s.start, s.end), 30.0);
+    }
+}
+
+TEST(swath_test, degenerate_field_and_invalid_width)
+{
+    EXPECT_TRUE(plan_swaths(Polygon({{0.0, 0.0}, {1.0, 1.0}}), {1.0, 0.0, 0.0}).swaths.empty());
+    EXPECT_THROW(plan_swaths(rect(0.0, 0.0, 1.0, 1.0), {0.0, 0.0, 0.0}), std::invalid_argument);
+    EXPECT_THROW(plan_swaths(rect(0.0, 0.0, 1.0, 1.0), {-1.0, 0.0, 0.0}), std::invalid_argument);
+}
+
+TEST(heading_sweep_test, prefers_fewer_turns_on_long_rectangle)
+{
+    const Polygon field = rect(0.0, 0.0, 100.0, 30.0);
+    const HeadingSweepResult r = sweep_headings(field, 90.0, {10.0, 0.0, 50.0, 2});
+
+    ASSERT_EQ(r.table.size(), 2u);
+    EXPECT_DOUBLE_EQ(r.table[0].heading_deg, 0.0);
+    EXPECT_DOUBLE_EQ(r.table[1].heading_deg, 90.0);
+    EXPECT_EQ(r.table[0].turns, 9u);
+    EXPECT_EQ(r.table[1].turns, 2u);
+    EXPECT_NEAR(r.table[0].cost, 300.0 + 90.0 + 50.0 * 9, 1e-9);
+    EXPECT_EQ(r.best, 1u);
+    EXPECT_DOUBLE_EQ(r.best_cost().heading_deg, 90.0);
+}
+
+TEST(heading_sweep_test, table_matches_plan_swaths)
+{
+    const Polygon field({{0.0, 0.0}, {200.0, 0.0}, {200.0, 50.0}, {60.0, 50.0}, {60.0, 150.0}, {0.0, 150.0}},
+                        {{{10.0, 10.0}, {30.0, 10.0}, {30.0, 30.0}, {10.0, 30.0}}});
+    const std::vector<double> headings{0.0, 17.5, 45.0, 90.0, 133.0};
+    const HeadingSweepResult r = sweep_headings(field, headings, {6.0, 1.0, 0.0, 3});
+
+    ASSERT_EQ(r.table.size(), headings.size());
+    for (std::size_t i = 0; i < headings.size(); ++i) {
+        const SwathPlan plan = plan_swaths(field, {6.0, headings[i], 1.0});
+        EXPECT_EQ(r.table[i].swaths, plan.swaths.size());
+        EXPECT_EQ(r.table[i].turns, plan.turns());
+        EXPECT_DOUBLE_EQ(r.table[i].working_length, plan.working_length);
+        EXPECT_DOUBLE_EQ(r.table[i].transition_length, plan.transition_length);
+    }
+}
+
+TEST(heading_sweep_test, result_does_not_depend_on_thread_count)
+{
+    const Polygon field({{0.0, 0.0}, {200.0, 0.0}, {200.0, 50.0}, {60.0, 50.0}, {60.0, 150.0}, {0.0, 150.0}});
+    const HeadingSweepResult one = sweep_headings(field, 1.0, {6.0, 0.0, 20.0, 1});
+    const HeadingSweepResult many = sweep_headings(field, 1.0, {6.0, 0.0, 20.0, 8});
+
+    ASSERT_EQ(one.table.size(), 180u);
+    ASSERT_EQ(many.table.size(), one.table.size());
+    EXPECT_EQ(one.best, many.best);
+    for (std::size_t i = 0; i < one.table.size(); ++i) {
+        EXPECT_EQ(one.table[i].cost, many.table[i].cost);
+    }
+}
+
+TEST(heading_sweep_test, ties_resolve_to_first_heading_and_bad_input_throws)
+{
+    const Polygon field = rect(0.0, 0.0, 100.0, 30.0);
+    const std::vector<double> same{90.0, 90.0};
+    EXPECT_EQ(sweep_headings(field, same, {10.0, 0.0, 0.0, 2}).best, 0u);
+
+    EXPECT_THROW(sweep_headings(field, std::vector<double>{}, {10.0, 0.0, 0.0, 0}), std::invalid_argument);
+    EXPECT_THROW(sweep_headings(field, 0.0, {10.0, 0.0, 0.0, 0}), std::invalid_argument);
+    EXPECT_THROW(sweep_headings(field, 10.0, {0.0, 0.0, 0.0, 0}), std::invalid_argument);
+}
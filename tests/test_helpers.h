@@ -0,0 +1,21 @@
+// tests/test_helpers.h
+// Общие построители фигур для тестов полигональных модулей
+#pragma once
+
+#include <mylib/geometry.h>
+
+#include <numeric>
+#include <vector>
+
+/// Прямоугольник со сторонами вдоль осей, обход против часовой стрелки
+inline mylib::Polygon rect(double x0, double y0, double x1, double y1)
+{
+    return mylib::Polygon({{x0, y0}, {x1, y0}, {x1, y1}, {x0, y1}});
+}
+
+/// Суммарная площадь набора полигонов
+inline double total_area(const std::vector<mylib::Polygon>& polys)
+{
+    return std::accumulate(polys.begin(), polys.end(), 0.0,
+                           [](double s, const mylib::Polygon& p) { return s + p.area(); });
+}
@@ -0,0 +1,257 @@
+// tests/track_stream_test.cpp
+#include <mylib/polyline.h>
+#include <mylib/track_stream.h>
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace mylib;
+
+namespace {
+
+const GeoPoint kCenter{55.75, 37.62, std::nullopt};
+
+std::vector<GeoPoint> make_track(std::size_t n)
+{
+    std::vector<GeoPoint> track;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double t = static_cast<double>(i) * 1e-3;
+        track.push_back({kCenter.lat + 0.01 * std::sin(t), kCenter.lon + 0.01 * std::cos(3.0 * t), std::nullopt});
+    }
+    return track;
+}
+
+// Проекция, падающая на первом же блоке
+class FailingProjection final: public IGeoPointToXY {
+public:
+    Point geo_to_xy(const GeoPoint&, const GeoPoint&) const override { return {}; }
+    GeoPoint xy_to_geo(const GeoPoint&, const Point&) const override { return {}; }
+    void geo_to_xy_batch(const GeoPoint&, span<const GeoPoint>, span<Point>) const override
+    {
+        throw std::runtime_error("сбой проекции");
+    }
+};
+
+} // namespace
+
+TEST(track_pipeline_test, push_matches_batch_computation)
+{
+    const auto track = make_track(10007);
+    const GeoToXYEquirectangular proj;
+
+    std::vector<Point> xy(track.size());
+    proj.geo_to_xy_batch(kCenter, track, xy);
+    const double expected = polyline_lengths(xy).back();
+
+    // Маленькие блоки и неровные порции: проверка стыков блоков
+    TrackPipeline pipeline(proj, kCenter, {64, 3});
+    std::size_t pos = 0;
+    for (std::size_t step = 1; pos < track.size(); step = step * 3 % 97 + 1) {
+        const std::size_t m = std::min(step, track.size() - pos);
+        pipeline.push(span<const GeoPoint>(track.data() + pos, m));
+        pos += m;
+    }
+    const TrackStats stats = pipeline.finish();
+
+    EXPECT_EQ(stats.points_in, track.size());
+    EXPECT_EQ(stats.points_accepted, track.size());
+    EXPECT_NEAR(stats.length, expected, expected * 1e-12);
+    EXPECT_EQ(stats.first, xy.front());
+    EXPECT_EQ(stats.last, xy.back());
+    EXPECT_NEAR(stats.enclosed_area, ring_signed_area(xy), std::abs(ring_signed_area(xy)) * 1e-9);
+
+    // Повторный finish возвращает тот же итог, push после finish запрещён
+    EXPECT_EQ(pipeline.finish().points_in, stats.points_in);
+    EXPECT_THROW(pipeline.push(track.front()), std::logic_error);
+}
+
+TEST(track_pipeline_test, filter_drops_jitter_outliers_and_nan)
+{
+    const GeoToXYEquirectangular proj;
+    TrackPipelineConfig config;
+    config.min_step = 0.5;
+    config.max_step = 100.0;
+    TrackPipeline pipeline(proj, kCenter, config);
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double m = 1.0 / 111319.49; // ~1 м по широте в градусах
+    pipeline.push({kCenter.lat, kCenter.lon, std::nullopt});
+    pipeline.push({kCenter.lat + 0.1 * m, kCenter.lon, std::nullopt}); // дрожание
+    pipeline.push({kCenter.lat + 10.0 * m, kCenter.lon, std::nullopt});
+    pipeline.push({kCenter.lat + 5000.0 * m, kCenter.lon, std::nullopt}); // выброс
+    pipeline.push({nan, kCenter.lon, std::nullopt});
+    pipeline.push({kCenter.lat + 20.0 * m, kCenter.lon, std::nullopt});
+    const TrackStats stats = pipeline.finish();
+
+    EXPECT_EQ(stats.points_in, 6u);
+    EXPECT_EQ(stats.points_accepted, 3u);
+    EXPECT_NEAR(stats.length, 20.0, 1e-3);
+}
+
+TEST(track_pipeline_test, glitched_first_fix_is_dropped)
+{
+    const GeoToXYEquirectangular proj;
+    TrackPipelineConfig config;
+    config.max_step = 50.0;
+    TrackPipeline pipeline(proj, kCenter, config);
+
+    // Первая точка в 5 км от трека, дальше 1000 точек через ~1.1 м
+    pipeline.push(proj.xy_to_geo(kCenter, {5000.0, 0.0}));
+    for (int i = 0; i < 1000; ++i) {
+        pipeline.push(proj.xy_to_geo(kCenter, {1.1 * i, 0.0}));
+    }
+    const TrackStats stats = pipeline.finish();
+
+    EXPECT_EQ(stats.points_in, 1001u);
+    EXPECT_EQ(stats.points_accepted, 1000u);
+    EXPECT_EQ(stats.gaps, 0u);
+    EXPECT_NEAR(stats.length, 1.1 * 999, 1e-6);
+    EXPECT_NEAR(stats.first.x, 0.0, 1e-6);
+}
+
+TEST(track_pipeline_test, track_continues_after_gap)
+{
+    const GeoToXYEquirectangular proj;
+    TrackPipelineConfig config;
+    config.max_step = 10.0;
+
+    // Обход квадрата 100 x 100 с шагом 1 м; на нижней стороне нет точек между x = 40 и x = 60
+    std::vector<Point> contour;
+    for (int i = 0; i < 100; ++i) {
+        if (i <= 40 || i >= 60) contour.push_back({1.0 * i, 0.0});
+    }
+    for (int i = 0; i < 100; ++i) contour.push_back({100.0, 1.0 * i});
+    for (int i = 0; i < 100; ++i) contour.push_back({100.0 - i, 100.0});
+    for (int i = 0; i < 100; ++i) contour.push_back({0.0, 100.0 - i});
+
+    TrackPipeline pipeline(proj, kCenter, config);
+    for (const Point& p: contour) {
+        pipeline.push(proj.xy_to_geo(kCenter, p));
+    }
+    const TrackStats stats = pipeline.finish();
+
+    EXPECT_EQ(stats.points_accepted, contour.size());
+    EXPECT_EQ(stats.gaps, 1u);
+    EXPECT_NEAR(stats.length, 400.0 - 1.0 - 20.0, 1e-6); // без замыкания и без скачка
+    EXPECT_NEAR(stats.enclosed_area, 10000.0, 1e-6);
+
+    // Без продолжения все точки после разрыва отвергаются
+    config.reanchor_after = 0;
+    TrackPipeline strict(proj, kCenter, config);
+    for (const Point& p: contour) {
+        strict.push(proj.xy_to_geo(kCenter, p));
+    }
+    EXPECT_EQ(strict.finish().points_accepted, 41u);
+}
+
+TEST(track_pipeline_test, enclosed_area_of_square_contour)
+{
+    const GeoToXYEquirectangular proj;
+    TrackPipeline pipeline(proj, kCenter);
+    // Обход квадрата против часовой стрелки (x — восток, y — север), без замыкающей точки
+    std::vector<Point> square{{0.0, 0.0}, {100.0, 0.0}, {100.0, 100.0}, {0.0, 100.0}};
+    for (const Point& p: square) {
+        pipeline.push(proj.xy_to_geo(kCenter, p));
+    }
+    EXPECT_NEAR(pipeline.finish().enclosed_area, 10000.0, 1e-6);
+}
+
+TEST(track_pipeline_test, projection_error_is_rethrown)
+{
+    const FailingProjection proj;
+    const auto track = make_track(1000);
+    TrackPipeline pipeline(proj, kCenter, {16, 2});
+    EXPECT_THROW(
+        {
+            pipeline.push(track);
+            (void)pipeline.finish();
+        },
+        std::runtime_error);
+}
+
+TEST(track_pipeline_test, projection_error_surfaces_on_next_push)
+{
+    const FailingProjection proj;
+    const auto track = make_track(4096);
+    TrackPipeline pipeline(proj, kCenter, {4096, 2});
+    pipeline.push(track); // полный блок уходит в обработку
+
+    // Следующий блок за 2000 точек не заполняется, так что ошибку может сообщить только проверка в самом push
+    bool thrown = false;
+    for (int i = 0; i < 2000 && !thrown; ++i) {
+        try {
+            pipeline.push(track.front());
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(thrown);
+    EXPECT_THROW(pipeline.push(track.front()), std::runtime_error);
+    EXPECT_THROW((void)pipeline.finish(), std::runtime_error);
+}
+
+TEST(track_pipeline_test, invalid_config_throws)
+{
+    const GeoToXYEquirectangular proj;
+    EXPECT_THROW(TrackPipeline(proj, kCenter, {0, 4}), std::invalid_argument);
+    EXPECT_THROW(TrackPipeline(proj, kCenter, {16, 0}), std::invalid_argument);
+    TrackPipelineConfig bad;
+    bad.min_step = 2.0;
+    bad.max_step = 1.0;
+    EXPECT_THROW(TrackPipeline(proj, kCenter, bad), std::invalid_argument);
+}
+
+TEST(csv_source_test, parses_lines_across_block_boundaries)
+{
+    std::ostringstream text;
+    text << "lat,lon,alt\n# комментарий\n\n";
+    for (int i = 0; i < 500; ++i) {
+        text << 55.0 + i * 1e-6 << ", " << 37.0 - i * 1e-6;
+        if (i % 2 == 0) text << "," << i;
+        text << (i % 3 == 0 ? "\r\n" : "\n");
+    }
+    text << "+56.5,38.25"; // последняя строка без перевода строки
+    std::istringstream in(text.str());
+
+    CsvGeoPointSource source(in, true, 64);
+    std::vector<GeoPoint> all;
+    std::vector<GeoPoint> buf(7);
+    for (std::size_t n; (n = source.read(buf)) > 0;) {
+        all.insert(all.end(), buf.begin(), buf.begin() + static_cast<std::ptrdiff_t>(n));
+    }
+
+    ASSERT_EQ(all.size(), 501u);
+    EXPECT_DOUBLE_EQ(all[0].lat, 55.0);
+    ASSERT_TRUE(all[0].alt.has_value());
+    EXPECT_FALSE(all[1].alt.has_value());
+    EXPECT_DOUBLE_EQ(*all[498].alt, 498.0);
+    EXPECT_DOUBLE_EQ(all[500].lat, 56.5);
+    EXPECT_DOUBLE_EQ(all[500].lon, 38.25);
+}
+
+TEST(csv_source_test, malformed_line_throws)
+{
+    std::istringstream in("55.0,37.0\n55.1;37.1\n");
+    CsvGeoPointSource source(in);
+    std::vector<GeoPoint> buf(4);
+    EXPECT_THROW((void)source.read(buf), std::runtime_error);
+}
+
+TEST(csv_source_test, pipeline_runs_from_source)
+{
+    std::istringstream in("55.75,37.62\n55.76,37.62\n55.77,37.62\n");
+    CsvGeoPointSource source(in);
+    const GeoToXYEquirectangular proj;
+    TrackPipeline pipeline(proj, kCenter, {2, 2});
+    pipeline.run(source);
+    const TrackStats stats = pipeline.finish();
+    EXPECT_EQ(stats.points_in, 3u);
+    EXPECT_NEAR(stats.length, deg2rad(0.02) * kEarthRadius, 1e-6);
+}